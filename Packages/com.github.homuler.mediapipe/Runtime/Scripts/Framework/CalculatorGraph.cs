@@ -5,6 +5,7 @@
 // https://opensource.org/licenses/MIT.
 
 using System;
+using System.Collections.Generic;
 using System.Runtime.InteropServices;
 
 using Google.Protobuf;
@@ -67,6 +68,63 @@ namespace Mediapipe
       return config;
     }
 
+    /// <summary>
+    ///   Returns the startup phases recorded by <see cref="StartupProfiler" />.
+    /// </summary>
+    /// <remarks>
+    ///   If the graph is started, the startup window is closed, i.e. <see cref="StartupPhaseType.Open" /> and <see cref="StartupPhaseType.FirstProcess" />
+    ///   are no longer recorded.
+    /// </remarks>
+    /// <returns>An empty list if <see cref="StartupProfiler" /> was disabled when the graph was initialized.</returns>
+    public List<StartupPhase> GetStartupPhases()
+    {
+      UnsafeNativeMethods.mp_CalculatorGraph__GetStartupPhases(mpPtr, out var nativePhases).Assert();
+      GC.KeepAlive(this);
+
+      return StartupProfiler.Copy(nativePhases);
+    }
+
+    /// <summary>
+    ///   Turns the profiler on or off. It's off when the graph is created, and it can be turned on while the graph is running.
+    /// </summary>
+    /// <exception cref="BadStatusException">
+    ///   Thrown if the profiler is not configured, i.e. neither <see cref="GraphProfiling" /> was enabled when the graph was created nor <c>profiler_config</c> is set.
+    /// </exception>
+    public void SetProfilingEnabled(bool enabled)
+    {
+      UnsafeNativeMethods.mp_CalculatorGraph__SetProfilingEnabled__b(mpPtr, enabled, out var statusPtr).Assert();
+
+      GC.KeepAlive(this);
+      AssertStatusOk(statusPtr);
+    }
+
+    /// <summary>
+    ///   Returns the stats of the calculators collected while the profiler is on.
+    /// </summary>
+    /// <returns>An empty list if the profiler is not configured.</returns>
+    public List<CalculatorProfileStats> GetCalculatorProfiles()
+    {
+      UnsafeNativeMethods.mp_CalculatorGraph__GetCalculatorProfiles(mpPtr, out var statusPtr, out var nativeProfiles).Assert();
+
+      GC.KeepAlive(this);
+      AssertStatusOk(statusPtr);
+      return GraphProfiling.Copy(nativeProfiles);
+    }
+
+    /// <summary>
+    ///   Writes the trace of the last <paramref name="seconds" /> to <paramref name="path" /> in the Chrome trace event format, which can be opened by Perfetto.
+    /// </summary>
+    /// <remarks>
+    ///   The tracer keeps a limited number of the recent events, so the trace may be shorter.
+    /// </remarks>
+    public void WriteTrace(string path, double seconds)
+    {
+      UnsafeNativeMethods.mp_CalculatorGraph__WriteTrace__PKc_d(mpPtr, path, seconds, out var statusPtr).Assert();
+
+      GC.KeepAlive(this);
+      AssertStatusOk(statusPtr);
+    }
+
     public void ObserveOutputStream(string streamName, int streamId, NativePacketCallback nativePacketCallback, bool observeTimestampBounds = false)
     {
       UnsafeNativeMethods.mp_CalculatorGraph__ObserveOutputStream__PKc_PF_b(mpPtr, streamName, streamId, nativePacketCallback, observeTimestampBounds, out var statusPtr).Assert();
@@ -137,6 +195,29 @@ namespace Mediapipe
       AssertStatusOk(statusPtr);
     }
 
+    /// <summary>
+    ///   Closes the input streams, waits until the current run is done, and starts a new run.
+    /// </summary>
+    /// <remarks>
+    ///   The timestamps and the calculator states are reset, but unlike recreating the graph, the executors, the GPU resources,
+    ///   and the output stream observers are reused.
+    ///   If <see cref="SharedModelCache" /> is enabled, the model files are kept in memory, so they are not read again.
+    ///   The TFLite interpreters are still built again, since the calculators are created again for each run.
+    /// </remarks>
+    public void Reset()
+    {
+      Reset(new PacketMap());
+    }
+
+    public void Reset(PacketMap sidePacket)
+    {
+      UnsafeNativeMethods.mp_CalculatorGraph__Reset__Rsp(mpPtr, sidePacket.mpPtr, out var statusPtr).Assert();
+
+      GC.KeepAlive(sidePacket);
+      GC.KeepAlive(this);
+      AssertStatusOk(statusPtr);
+    }
+
     public void WaitUntilIdle()
     {
       UnsafeNativeMethods.mp_CalculatorGraph__WaitUntilIdle(mpPtr, out var statusPtr).Assert();
@@ -212,6 +293,26 @@ namespace Mediapipe
       return SafeNativeMethods.mp_CalculatorGraph__UnthrottleSources(mpPtr);
     }
 
+    /// <summary>
+    ///   Sets the executor that runs the calculators. It must be called before the graph is initialized.
+    /// </summary>
+    /// <remarks>
+    ///   Sharing one <see cref="ThreadPoolExecutor" /> among graphs bounds the number of the worker threads in the process.
+    ///   To run the calculators on the thread that waits for the graph (e.g. <see cref="WaitUntilIdle" />),
+    ///   add <c>executor { type: "ApplicationThreadExecutor" }</c> to the config instead.
+    /// </remarks>
+    /// <param name="name">
+    ///   The executor name referred to by the nodes in the config. If it's empty, <paramref name="executor" /> is used as the default executor.
+    /// </param>
+    public void SetExecutor(string name, Executor executor)
+    {
+      UnsafeNativeMethods.mp_CalculatorGraph__SetExecutor__PKc_SPe(mpPtr, name, executor.sharedPtr, out var statusPtr).Assert();
+
+      GC.KeepAlive(executor);
+      GC.KeepAlive(this);
+      AssertStatusOk(statusPtr);
+    }
+
     public GpuResources GetGpuResources()
     {
       UnsafeNativeMethods.mp_CalculatorGraph__GetGpuResources(mpPtr, out var gpuResourcesPtr).Assert();
@@ -0,0 +1,65 @@
+// Copyright (c) 2026 homuler
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+using System;
+
+namespace Mediapipe
+{
+  /// <summary>
+  ///   An executor that runs the calculators, which can be shared by multiple <see cref="CalculatorGraph" />s and <see cref="Tasks.Core.TaskRunner" />s.
+  /// </summary>
+  /// <remarks>
+  ///   The native executor is kept alive while any graph uses it, even after this instance is disposed.
+  /// </remarks>
+  public abstract class Executor : MpResourceHandle
+  {
+    private SharedPtrHandle _sharedPtrHandle;
+
+    /// <param name="ptr">Shared pointer of mediapipe::Executor</param>
+    protected Executor(IntPtr ptr) : base()
+    {
+      _sharedPtrHandle = new SharedPtr(ptr);
+      this.ptr = _sharedPtrHandle.Get();
+    }
+
+    protected override void DisposeManaged()
+    {
+      if (_sharedPtrHandle != null)
+      {
+        _sharedPtrHandle.Dispose();
+        _sharedPtrHandle = null;
+      }
+      base.DisposeManaged();
+    }
+
+    protected override void DeleteMpPtr()
+    {
+      // Do nothing
+    }
+
+    public IntPtr sharedPtr => _sharedPtrHandle == null ? IntPtr.Zero : _sharedPtrHandle.mpPtr;
+
+    private class SharedPtr : SharedPtrHandle
+    {
+      public SharedPtr(IntPtr ptr) : base(ptr) { }
+
+      protected override void DeleteMpPtr()
+      {
+        UnsafeNativeMethods.mp_SharedExecutor__delete(ptr);
+      }
+
+      public override IntPtr Get()
+      {
+        return SafeNativeMethods.mp_SharedExecutor__get(mpPtr);
+      }
+
+      public override void Reset()
+      {
+        UnsafeNativeMethods.mp_SharedExecutor__reset(mpPtr);
+      }
+    }
+  }
+}
@@ -0,0 +1,72 @@
+// Copyright (c) 2026 homuler
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+using System.Runtime.InteropServices;
+
+namespace Mediapipe
+{
+  [StructLayout(LayoutKind.Sequential)]
+  public readonly struct ExpandedConfigCacheStats
+  {
+    /// <summary>
+    ///   The number of the configs found in memory.
+    /// </summary>
+    public readonly long hits;
+    /// <summary>
+    ///   The number of the configs loaded from the persistent directory.
+    /// </summary>
+    public readonly long diskHits;
+    /// <summary>
+    ///   The number of the configs expanded by the cache.
+    /// </summary>
+    public readonly long misses;
+    /// <summary>
+    ///   The number of the configs currently in memory.
+    /// </summary>
+    public readonly long entries;
+  }
+
+  /// <summary>
+  ///   A process-wide cache of the graph configs whose subgraphs are expanded.
+  /// </summary>
+  /// <remarks>
+  ///   When it's enabled, <see cref="CalculatorGraph" /> and <see cref="ValidatedGraphConfig" /> are initialized with the cached expanded config
+  ///   if the same config (and the same side packet signature) has been used before, so subgraph expansion is skipped.
+  ///   The configs that cannot be initialized from their expanded form in the same way (e.g. the MediaPipe Tasks graphs) are used as is.
+  /// </remarks>
+  public static class ExpandedConfigCache
+  {
+    /// <summary>
+    ///   It's <c>false</c> by default, because the first initialization of each config takes a little longer to verify that it can be cached.
+    /// </summary>
+    public static bool enabled
+    {
+      get => SafeNativeMethods.mp_ExpandedConfigCache__enabled();
+      set => SafeNativeMethods.mp_ExpandedConfigCache__set_enabled__b(value);
+    }
+
+    /// <summary>
+    ///   Persists the expanded configs to <paramref name="directory" />, so that they are reused after the application restarts.
+    /// </summary>
+    /// <param name="directory">
+    ///   An existing directory (e.g. under <c>Application.temporaryCachePath</c>).
+    ///   The configs written by another build of the native library are ignored, because the expansion depends on the registered subgraphs.
+    ///   If it's <c>null</c> or empty, the configs are not persisted.
+    /// </param>
+    public static void SetDirectory(string directory) => UnsafeNativeMethods.mp_ExpandedConfigCache__SetDirectory__PKc(directory ?? "");
+
+    /// <summary>
+    ///   Removes the configs in memory. The persisted ones are not removed.
+    /// </summary>
+    public static void Clear() => SafeNativeMethods.mp_ExpandedConfigCache__Clear();
+
+    public static ExpandedConfigCacheStats GetStats()
+    {
+      SafeNativeMethods.mp_ExpandedConfigCache__GetStats(out var stats);
+      return stats;
+    }
+  }
+}
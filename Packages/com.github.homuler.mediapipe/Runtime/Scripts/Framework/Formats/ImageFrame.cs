@@ -205,6 +205,88 @@ namespace Mediapipe
       CopyToBuffer(UnsafeNativeMethods.mp_ImageFrame__CopyToBuffer__Pf_i, buffer);
     }
 
+    /// <summary>
+    ///   Resizes the mask to <paramref name="width"/> x <paramref name="height"/> with bilinear filtering and writes it to <paramref name="buffer"/> as uint8.
+    /// </summary>
+    /// <remarks>
+    ///   The format of the mask must be <see cref="ImageFormat.Types.Format.Vec32F1"/> or <see cref="ImageFormat.Types.Format.Gray8"/>.
+    /// </remarks>
+    /// <param name="threshold">
+    ///   If negative, the confidence is scaled to [0, 255].
+    ///   Otherwise, each pixel becomes 255 if its confidence is greater than or equal to <paramref name="threshold"/>, and 0 if not.
+    /// </param>
+    public void ExportMask(int width, int height, byte[] buffer, float threshold = -1)
+    {
+      unsafe
+      {
+        fixed (byte* bufferPtr = buffer)
+        {
+          ExportMask(width, height, (IntPtr)bufferPtr, buffer.Length, threshold);
+        }
+      }
+    }
+
+    /// <inheritdoc cref="ExportMask(int, int, byte[], float)"/>
+    /// <remarks>
+    ///   <paramref name="buffer"/> can be the raw data of a <see cref="Texture2D"/>, so that the mask can be exported without copying.
+    /// </remarks>
+    public void ExportMask(int width, int height, NativeArray<byte> buffer, float threshold = -1)
+    {
+      unsafe
+      {
+        ExportMask(width, height, (IntPtr)NativeArrayUnsafeUtility.GetUnsafePtr(buffer), buffer.Length, threshold);
+      }
+    }
+
+    /// <summary>
+    ///   Resizes the category mask to <paramref name="width"/> x <paramref name="height"/> and writes the color of each category to <paramref name="buffer"/> in RGBA32.
+    /// </summary>
+    /// <param name="colors">
+    ///   <c>colors[i]</c> is the color of the i-th category.
+    ///   Categories that are out of range are written as <c>(0, 0, 0, 0)</c>.
+    /// </param>
+    public void ExportCategoryMask(int width, int height, Color32[] colors, byte[] buffer)
+    {
+      unsafe
+      {
+        fixed (byte* bufferPtr = buffer)
+        {
+          ExportCategoryMask(width, height, colors, (IntPtr)bufferPtr, buffer.Length);
+        }
+      }
+    }
+
+    /// <inheritdoc cref="ExportCategoryMask(int, int, Color32[], byte[])"/>
+    public void ExportCategoryMask(int width, int height, Color32[] colors, NativeArray<byte> buffer)
+    {
+      unsafe
+      {
+        ExportCategoryMask(width, height, colors, (IntPtr)NativeArrayUnsafeUtility.GetUnsafePtr(buffer), buffer.Length);
+      }
+    }
+
+    private void ExportMask(int width, int height, IntPtr buffer, int bufferSize, float threshold)
+    {
+      UnsafeNativeMethods.mp_ImageFrame__ExportMask__i_i_f_Pui8_i(mpPtr, width, height, threshold, buffer, bufferSize, out var statusPtr).Assert();
+
+      GC.KeepAlive(this);
+      AssertStatusOk(statusPtr);
+    }
+
+    private void ExportCategoryMask(int width, int height, Color32[] colors, IntPtr buffer, int bufferSize)
+    {
+      unsafe
+      {
+        fixed (Color32* colorsPtr = colors)
+        {
+          UnsafeNativeMethods.mp_ImageFrame__ExportCategoryMask__i_i_Pui_i_Pui8_i(mpPtr, width, height, (IntPtr)colorsPtr, colors?.Length ?? 0, buffer, bufferSize, out var statusPtr).Assert();
+
+          GC.KeepAlive(this);
+          AssertStatusOk(statusPtr);
+        }
+      }
+    }
+
     private delegate MpReturnCode CopyToBufferHandler(IntPtr ptr, IntPtr buffer, int bufferSize);
 
     private void CopyToBuffer<T>(CopyToBufferHandler handler, T[] buffer) where T : unmanaged
@@ -0,0 +1,164 @@
+// Copyright (c) 2026 homuler
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+using System;
+using System.Runtime.InteropServices;
+using Google.Protobuf;
+
+namespace Mediapipe
+{
+  [StructLayout(LayoutKind.Sequential)]
+  public readonly struct GraphPoolStats
+  {
+    /// <summary>
+    ///   The number of the packets added to the graph input streams.
+    /// </summary>
+    public readonly long packetsIn;
+    /// <summary>
+    ///   The number of the packets rejected because the input streams were full.
+    /// </summary>
+    public readonly long packetsRejected;
+    /// <summary>
+    ///   The number of the packets passed to the output stream observers.
+    /// </summary>
+    public readonly long packetsOut;
+    /// <summary>
+    ///   <see cref="packetsOut" /> per second since <see cref="GraphPool.StartRun()" />.
+    /// </summary>
+    public readonly double throughput;
+  }
+
+  /// <summary>
+  ///   Runs one <see cref="CalculatorGraph" /> per stream (e.g. per camera) using the same config.
+  ///   The graphs share one <see cref="Executor" /> and the model assets, and the packets are routed to the graphs by the stream id.
+  /// </summary>
+  /// <remarks>
+  ///   Since the worker threads are shared, they are spent on whichever streams have work to do.
+  ///   To keep a busy stream from occupying them, set <c>maxQueueSize</c> so that <see cref="TryAddPacketToInputStream" /> rejects the packets
+  ///   instead of queueing them.
+  /// </remarks>
+  public class GraphPool : MpResourceHandle
+  {
+    public delegate StatusArgs NativePacketCallback(int streamId, int callbackId, IntPtr packetPtr);
+
+    /// <param name="poolSize">The number of the streams</param>
+    /// <param name="executor">
+    ///   The executor shared by the graphs. If it's <c>null</c>, a thread pool whose size is the number of the CPU cores is created.
+    /// </param>
+    /// <param name="maxQueueSize">
+    ///   The maximum number of the packets queued in each input stream of each graph. If it's not positive, the input streams are not bounded.
+    /// </param>
+    public static GraphPool Create(CalculatorGraphConfig config, int poolSize, Executor executor = null, int maxQueueSize = 0)
+    {
+      var bytes = config.ToByteArray();
+      var executorPtr = executor == null ? IntPtr.Zero : executor.sharedPtr;
+      UnsafeNativeMethods.mp_GraphPool_Create__PKc_i_i_Pe_i(bytes, bytes.Length, poolSize, executorPtr, maxQueueSize, out var statusPtr, out var graphPoolPtr).Assert();
+      GC.KeepAlive(executor);
+
+      AssertStatusOk(statusPtr);
+      return new GraphPool(graphPoolPtr);
+    }
+
+    private GraphPool(IntPtr ptr) : base(ptr) { }
+
+    protected override void DeleteMpPtr()
+    {
+      UnsafeNativeMethods.mp_GraphPool__delete(ptr);
+    }
+
+    public int poolSize => SafeNativeMethods.mp_GraphPool__pool_size(mpPtr);
+
+    /// <summary>
+    ///   Observes <paramref name="streamName" /> of all the graphs. It must be called before <see cref="StartRun()" />.
+    /// </summary>
+    /// <remarks>
+    ///   <paramref name="nativePacketCallback" /> is called on the graph threads with the stream id and <paramref name="callbackId" />.
+    /// </remarks>
+    public void ObserveOutputStream(string streamName, int callbackId, NativePacketCallback nativePacketCallback)
+    {
+      UnsafeNativeMethods.mp_GraphPool__ObserveOutputStream__PKc_i_PF(mpPtr, streamName, callbackId, nativePacketCallback, out var statusPtr).Assert();
+
+      GC.KeepAlive(this);
+      AssertStatusOk(statusPtr);
+    }
+
+    public void StartRun()
+    {
+      StartRun(new PacketMap());
+    }
+
+    public void StartRun(PacketMap sidePacket)
+    {
+      UnsafeNativeMethods.mp_GraphPool__StartRun__Rsp(mpPtr, sidePacket.mpPtr, out var statusPtr).Assert();
+
+      GC.KeepAlive(sidePacket);
+      GC.KeepAlive(this);
+      AssertStatusOk(statusPtr);
+    }
+
+    /// <returns>
+    ///   <c>false</c> if the input stream of the graph for <paramref name="streamId" /> is full.
+    /// </returns>
+    public bool TryAddPacketToInputStream<T>(int streamId, string streamName, Packet<T> packet)
+    {
+      UnsafeNativeMethods.mp_GraphPool__AddPacketToInputStream__i_PKc_Ppacket(mpPtr, streamId, streamName, packet.mpPtr, out var statusPtr).Assert();
+      packet.Dispose(); // respect move semantics
+      GC.KeepAlive(this);
+
+      using (var status = new Status(statusPtr, true))
+      {
+        if (status.Code() == StatusCode.Unavailable)
+        {
+          return false;
+        }
+        status.AssertOk();
+      }
+      return true;
+    }
+
+    /// <summary>
+    ///   Closes the input streams of the graph for <paramref name="streamId" />, and waits until it's done.
+    /// </summary>
+    public void CloseStream(int streamId)
+    {
+      UnsafeNativeMethods.mp_GraphPool__CloseStream__i(mpPtr, streamId, out var statusPtr).Assert();
+
+      GC.KeepAlive(this);
+      AssertStatusOk(statusPtr);
+    }
+
+    /// <summary>
+    ///   Closes the input streams of all the graphs, and waits until they are done.
+    /// </summary>
+    public void Close()
+    {
+      UnsafeNativeMethods.mp_GraphPool__Close(mpPtr, out var statusPtr).Assert();
+
+      GC.KeepAlive(this);
+      AssertStatusOk(statusPtr);
+    }
+
+    public GraphPoolStats GetStreamStats(int streamId)
+    {
+      UnsafeNativeMethods.mp_GraphPool__GetStreamStats__i(mpPtr, streamId, out var statusPtr, out var stats).Assert();
+
+      GC.KeepAlive(this);
+      AssertStatusOk(statusPtr);
+      return stats;
+    }
+
+    /// <summary>
+    ///   Returns the sum of the stats of all the streams.
+    /// </summary>
+    public GraphPoolStats GetStats()
+    {
+      SafeNativeMethods.mp_GraphPool__GetStats(mpPtr, out var stats);
+
+      GC.KeepAlive(this);
+      return stats;
+    }
+  }
+}
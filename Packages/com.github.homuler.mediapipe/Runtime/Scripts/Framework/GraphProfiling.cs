@@ -0,0 +1,83 @@
+// Copyright (c) 2026 homuler
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+using System.Collections.Generic;
+
+namespace Mediapipe
+{
+  public readonly struct CalculatorProfileStats
+  {
+    /// <summary>
+    ///   The name of the calculator node.
+    /// </summary>
+    public readonly string name;
+    public readonly long openRuntimeUs;
+    public readonly long closeRuntimeUs;
+    /// <summary>
+    ///   The number of the <c>Process</c> calls.
+    /// </summary>
+    public readonly long processCount;
+    /// <summary>
+    ///   The total time taken by <c>Process</c>, in microseconds.
+    /// </summary>
+    public readonly long processRuntimeUs;
+    public readonly long intervalSizeUs;
+    /// <summary>
+    ///   The histogram of the time taken by <c>Process</c>.
+    ///   The i-th bucket counts the calls that took [i, i + 1) * <see cref="intervalSizeUs" />, and the last bucket also counts the slower calls.
+    /// </summary>
+    public readonly long[] processHistogram;
+
+    internal CalculatorProfileStats(NativeCalculatorProfileStats nativeStats)
+    {
+      name = nativeStats.name;
+      openRuntimeUs = nativeStats.openRuntimeUs;
+      closeRuntimeUs = nativeStats.closeRuntimeUs;
+      processCount = nativeStats.processCount;
+      processRuntimeUs = nativeStats.processRuntimeUs;
+      intervalSizeUs = nativeStats.intervalSizeUs;
+      processHistogram = nativeStats.processHistogram.ToArray();
+    }
+
+    public override string ToString() => $"{{ name: \"{name}\", openRuntimeUs: {openRuntimeUs}, closeRuntimeUs: {closeRuntimeUs}, processCount: {processCount}, processRuntimeUs: {processRuntimeUs} }}";
+  }
+
+  /// <summary>
+  ///   Lets <see cref="CalculatorGraph" /> be profiled by the MediaPipe profiler.
+  /// </summary>
+  /// <remarks>
+  ///   <para>
+  ///     The profiler and the tracer of the graphs created while it's enabled are configured unless <c>profiler_config</c> is set,
+  ///     but they are paused until <see cref="CalculatorGraph.SetProfilingEnabled" /> is called, so the overhead is small.
+  ///   </para>
+  ///   <para>
+  ///     The stats are retrieved by <see cref="CalculatorGraph.GetCalculatorProfiles" />, and the trace is written by <see cref="CalculatorGraph.WriteTrace" />.
+  ///     They are not available if the native library is built without the MediaPipe profiler (see <c>build.py --profiling</c>).
+  ///   </para>
+  /// </remarks>
+  public static class GraphProfiling
+  {
+    /// <summary>
+    ///   It's <c>false</c> by default. Only the graphs created while it's <c>true</c> can be profiled.
+    /// </summary>
+    public static bool enabled
+    {
+      get => SafeNativeMethods.mp_GraphProfiling__enabled();
+      set => SafeNativeMethods.mp_GraphProfiling__set_enabled__b(value);
+    }
+
+    internal static List<CalculatorProfileStats> Copy(NativeCalculatorProfileStatsArray nativeProfiles)
+    {
+      var profiles = new List<CalculatorProfileStats>(nativeProfiles.size);
+      foreach (var nativeStats in nativeProfiles.AsReadOnlySpan())
+      {
+        profiles.Add(new CalculatorProfileStats(nativeStats));
+      }
+      nativeProfiles.Dispose();
+      return profiles;
+    }
+  }
+}
@@ -0,0 +1,185 @@
+// Copyright (c) 2026 homuler
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+using System;
+using System.Runtime.InteropServices;
+using Google.Protobuf;
+
+namespace Mediapipe
+{
+  /// <summary>
+  ///   Runs a graph whose node options and side packets can be updated while it's running (e.g. a detection threshold or the number of hands).
+  /// </summary>
+  /// <remarks>
+  ///   <para>
+  ///     Since the calculators read their options only when they are opened, <see cref="ApplyUpdates" /> starts another graph with the updated config in the background.
+  ///     When it's ready, the input packets are switched to it at the next timestamp, so the running graph is never stopped and the outputs are never reordered.
+  ///   </para>
+  ///   <para>
+  ///     The subgraphs are expanded, so the nodes in them can be updated by their expanded names (see <see cref="Config" />).
+  ///   </para>
+  /// </remarks>
+  public class LiveGraph : MpResourceHandle
+  {
+    public LiveGraph(CalculatorGraphConfig config) : base()
+    {
+      var bytes = config.ToByteArray();
+      UnsafeNativeMethods.mp_LiveGraph_Create__PKc_i(bytes, bytes.Length, out var statusPtr, out var ptr).Assert();
+
+      AssertStatusOk(statusPtr);
+      this.ptr = ptr;
+    }
+
+    public LiveGraph(string textFormatConfig) : this(CalculatorGraphConfig.Parser.ParseFromTextFormat(textFormatConfig)) { }
+
+    protected override void DeleteMpPtr()
+    {
+      UnsafeNativeMethods.mp_LiveGraph__delete(ptr);
+    }
+
+    /// <summary>
+    ///   The number of times the graph has been switched to the updated one.
+    /// </summary>
+    public long generation => SafeNativeMethods.mp_LiveGraph__generation(mpPtr);
+
+    /// <summary>
+    ///   Returns the expanded config with the updates made so far.
+    /// </summary>
+    public CalculatorGraphConfig Config()
+    {
+      UnsafeNativeMethods.mp_LiveGraph__Config(mpPtr, out var serializedProto).Assert();
+      GC.KeepAlive(this);
+
+      var config = serializedProto.Deserialize(CalculatorGraphConfig.Parser);
+      serializedProto.Dispose();
+
+      return config;
+    }
+
+    /// <remarks>
+    ///   Must be called before <see cref="StartRun()" />. The callback is called by every graph this instance starts.
+    /// </remarks>
+    public void ObserveOutputStream(string streamName, int streamId, CalculatorGraph.NativePacketCallback nativePacketCallback)
+    {
+      UnsafeNativeMethods.mp_LiveGraph__ObserveOutputStream__PKc_i_PF(mpPtr, streamName, streamId, nativePacketCallback, out var statusPtr).Assert();
+
+      GC.KeepAlive(this);
+      AssertStatusOk(statusPtr);
+    }
+
+    public void ObserveOutputStream<T>(string streamName, CalculatorGraph.PacketCallback<T> packetCallback, out GCHandle callbackHandle)
+    {
+      CalculatorGraph.NativePacketCallback nativePacketCallback = (IntPtr graphPtr, int streamId, IntPtr packetPtr) =>
+      {
+        try
+        {
+          var packet = Packet<T>.CreateForReference(packetPtr);
+          packetCallback(packet);
+          return StatusArgs.Ok();
+        }
+        catch (Exception e)
+        {
+          return StatusArgs.Internal(e.ToString());
+        }
+      };
+      callbackHandle = GCHandle.Alloc(nativePacketCallback, GCHandleType.Pinned);
+
+      ObserveOutputStream(streamName, 0, nativePacketCallback);
+    }
+
+    public void StartRun()
+    {
+      StartRun(new PacketMap());
+    }
+
+    public void StartRun(PacketMap sidePacket)
+    {
+      UnsafeNativeMethods.mp_LiveGraph__StartRun__Rsp(mpPtr, sidePacket.mpPtr, out var statusPtr).Assert();
+
+      GC.KeepAlive(sidePacket);
+      GC.KeepAlive(this);
+      AssertStatusOk(statusPtr);
+    }
+
+    /// <summary>
+    ///   Merges <c>options</c> and <c>node_options</c> of <paramref name="patch" /> into the node named <paramref name="nodeName" />.
+    /// </summary>
+    /// <remarks>
+    ///   The options are merged as protobuf messages, so the repeated fields are appended.
+    ///   The update is not applied until <see cref="ApplyUpdates" /> is called.
+    /// </remarks>
+    public void UpdateNodeOptions(string nodeName, CalculatorGraphConfig.Types.Node patch)
+    {
+      var bytes = patch.ToByteArray();
+      UnsafeNativeMethods.mp_LiveGraph__UpdateNodeOptions__PKc_PKc_i(mpPtr, nodeName, bytes, bytes.Length, out var statusPtr).Assert();
+
+      GC.KeepAlive(this);
+      AssertStatusOk(statusPtr);
+    }
+
+    /// <remarks>
+    ///   The update is not applied until <see cref="ApplyUpdates" /> is called.
+    /// </remarks>
+    public void UpdateSidePacket<T>(string name, Packet<T> packet)
+    {
+      UnsafeNativeMethods.mp_LiveGraph__UpdateSidePacket__PKc_Ppacket(mpPtr, name, packet.mpPtr).Assert();
+      packet.Dispose(); // respect move semantics
+
+      GC.KeepAlive(this);
+    }
+
+    /// <summary>
+    ///   Starts a graph with the updates in the background. It returns immediately.
+    /// </summary>
+    /// <remarks>
+    ///   If it's called again before the graph is ready, the graph is discarded in favor of the newer one.
+    /// </remarks>
+    public void ApplyUpdates()
+    {
+      UnsafeNativeMethods.mp_LiveGraph__ApplyUpdates(mpPtr, out var statusPtr).Assert();
+
+      GC.KeepAlive(this);
+      AssertStatusOk(statusPtr);
+    }
+
+    /// <summary>
+    ///   Waits until the graph started by the last <see cref="ApplyUpdates" /> is ready.
+    /// </summary>
+    /// <exception cref="BadStatusException">Thrown if the graph has failed to start, e.g. the updated options are invalid</exception>
+    public void WaitForUpdate()
+    {
+      UnsafeNativeMethods.mp_LiveGraph__WaitForUpdate(mpPtr, out var statusPtr).Assert();
+
+      GC.KeepAlive(this);
+      AssertStatusOk(statusPtr);
+    }
+
+    public void AddPacketToInputStream<T>(string streamName, Packet<T> packet)
+    {
+      UnsafeNativeMethods.mp_LiveGraph__AddPacketToInputStream__PKc_Ppacket(mpPtr, streamName, packet.mpPtr, out var statusPtr).Assert();
+      packet.Dispose(); // respect move semantics
+
+      GC.KeepAlive(this);
+      AssertStatusOk(statusPtr);
+    }
+
+    public void CloseAllPacketSources()
+    {
+      UnsafeNativeMethods.mp_LiveGraph__CloseAllPacketSources(mpPtr, out var statusPtr).Assert();
+
+      GC.KeepAlive(this);
+      AssertStatusOk(statusPtr);
+    }
+
+    public void WaitUntilDone()
+    {
+      UnsafeNativeMethods.mp_LiveGraph__WaitUntilDone(mpPtr, out var statusPtr).Assert();
+
+      GC.KeepAlive(this);
+      AssertStatusOk(statusPtr);
+    }
+  }
+}
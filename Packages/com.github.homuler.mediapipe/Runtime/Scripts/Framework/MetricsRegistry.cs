@@ -0,0 +1,111 @@
+// Copyright (c) 2026 homuler
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+using System;
+using System.Runtime.InteropServices;
+
+namespace Mediapipe
+{
+  [StructLayout(LayoutKind.Sequential)]
+  public unsafe struct GraphMetricsSnapshot
+  {
+    public const int QueueDepthHistogramSize = 16;
+
+    /// <summary>
+    ///   A unique id of the graph, which is not reused in the process.
+    /// </summary>
+    public long graphId;
+    public long inputPackets;
+    /// <summary>
+    ///   The number of the input packets whose timestamps have not reached any observed output stream yet.
+    /// </summary>
+    public long queueDepth;
+    /// <summary>
+    ///   The number of the times a node became throttled as found by <see cref="CalculatorGraph.IsNodeThrottled" />,
+    ///   or the graph rejected an input packet because it was throttled.
+    /// </summary>
+    public long throttleEvents;
+    /// <summary>
+    ///   The number of the input packets rejected by the graph, and the ones whose timestamps were skipped by every output stream
+    ///   observed with <c>observeTimestampBounds</c>, e.g. the frames dropped by <c>FlowLimiterCalculator</c>.
+    /// </summary>
+    /// <remarks>
+    ///   A stream observed without the timestamp bounds cannot tell a dropped frame from a sparse output, so it does not count the dropped frames.
+    /// </remarks>
+    public long droppedFrames;
+    /// <summary>
+    ///   <c>queueDepthCounts[i]</c> is the number of the input packets that were added when <c>i</c> packets were in flight.
+    ///   The last bucket also counts the deeper queues.
+    /// </summary>
+    public fixed long queueDepthCounts[QueueDepthHistogramSize];
+  }
+
+  [StructLayout(LayoutKind.Sequential)]
+  public unsafe struct StreamMetricsSnapshot
+  {
+    public const int LatencyHistogramSize = 12;
+    /// <summary>
+    ///   The upper bounds (exclusive) of the <see cref="latencyCounts" /> buckets except the last one, in microseconds.
+    /// </summary>
+    public static readonly long[] LatencyBucketUpperBoundsMicrosec = new long[] { 1000, 2000, 5000, 10000, 20000, 33000, 50000, 100000, 200000, 500000, 1000000 };
+
+    /// <summary>
+    ///   The id of the graph to which the stream belongs.
+    /// </summary>
+    public long graphId;
+    private IntPtr _name;
+    public long packets;
+    /// <summary>
+    ///   The total time from when the input packets of the same timestamps were added until the packets were observed, in microseconds.
+    /// </summary>
+    public long latencyTotalUs;
+    public fixed long latencyCounts[LatencyHistogramSize];
+
+    /// <summary>
+    ///   The name of the output stream.
+    /// </summary>
+    public string name => Marshal.PtrToStringAnsi(_name);
+  }
+
+  /// <summary>
+  ///   Records the metrics of <see cref="CalculatorGraph" />, i.e. the latency of the observed output streams, the number of the input packets in flight,
+  ///   the throttling events, and the dropped frames.
+  /// </summary>
+  /// <remarks>
+  ///   <para>
+  ///     The metrics are updated without locks, and <see cref="Snapshot" /> copies them without stopping the graphs.
+  ///   </para>
+  ///   <para>
+  ///     Only the output streams observed by <see cref="CalculatorGraph.ObserveOutputStream(string, int, CalculatorGraph.NativePacketCallback, bool)" /> are measured.
+  ///     At most 32 graphs and 16 streams per graph are recorded at the same time.
+  ///   </para>
+  /// </remarks>
+  public static class MetricsRegistry
+  {
+    /// <summary>
+    ///   It's <c>false</c> by default. While it's <c>false</c>, no new graph is recorded.
+    /// </summary>
+    public static bool enabled
+    {
+      get => SafeNativeMethods.mp_MetricsRegistry__enabled();
+      set => SafeNativeMethods.mp_MetricsRegistry__set_enabled__b(value);
+    }
+
+    /// <summary>
+    ///   Copies the metrics of the alive graphs to the buffers, which can be reused to avoid allocations.
+    /// </summary>
+    /// <param name="graphsSize">
+    ///   The number of the graphs. If it's greater than the length of <paramref name="graphs" />, the rest are not copied.
+    /// </param>
+    /// <param name="streamsSize">
+    ///   The number of the streams. If it's greater than the length of <paramref name="streams" />, the rest are not copied.
+    /// </param>
+    public static void Snapshot(GraphMetricsSnapshot[] graphs, out int graphsSize, StreamMetricsSnapshot[] streams, out int streamsSize)
+    {
+      SafeNativeMethods.mp_MetricsRegistry__Snapshot(graphs, graphs?.Length ?? 0, out graphsSize, streams, streams?.Length ?? 0, out streamsSize);
+    }
+  }
+}
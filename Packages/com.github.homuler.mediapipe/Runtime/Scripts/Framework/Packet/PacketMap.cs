@@ -67,6 +67,16 @@ namespace Mediapipe
       GC.KeepAlive(this);
     }
 
+    /// <summary>
+    ///   Same as <see cref="Emplace{T}" />, but the value is overwritten if <paramref name="key" /> exists.
+    /// </summary>
+    public void InsertOrAssign<T>(string key, Packet<T> packet)
+    {
+      UnsafeNativeMethods.mp_PacketMap__insert_or_assign__PKc_Rp(mpPtr, key, packet.mpPtr).Assert();
+      packet.Dispose(); // respect move semantics
+      GC.KeepAlive(this);
+    }
+
     public int Erase(string key)
     {
       UnsafeNativeMethods.mp_PacketMap__erase__PKc(mpPtr, key, out var count).Assert();
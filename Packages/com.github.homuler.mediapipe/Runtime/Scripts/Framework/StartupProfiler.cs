@@ -0,0 +1,116 @@
+// Copyright (c) 2026 homuler
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+using System.Collections.Generic;
+
+namespace Mediapipe
+{
+  public enum StartupPhaseType
+  {
+    /// <summary>
+    ///   Parsing the serialized config, including the expansion by <see cref="ExpandedConfigCache" /> if it's enabled.
+    /// </summary>
+    ConfigParse = 0,
+    /// <summary>
+    ///   Validating the config and expanding the subgraphs.
+    ///   It includes <c>GetContract</c> of every calculator, which is not broken down.
+    /// </summary>
+    Validation = 1,
+    /// <summary>
+    ///   Reading a resource, e.g. a model asset.
+    /// </summary>
+    ModelLoad = 2,
+    /// <summary>
+    ///   Building an interpreter and applying the delegate to it.
+    /// </summary>
+    DelegateInit = 3,
+    /// <summary>
+    ///   Starting the graph. For <see cref="Tasks.Core.TaskRunner" />, it also includes <see cref="Validation" />.
+    /// </summary>
+    StartRun = 4,
+    /// <summary>
+    ///   <c>Open</c> of a calculator.
+    /// </summary>
+    Open = 5,
+    /// <summary>
+    ///   The first <c>Process</c> of a calculator, or the first <c>TaskRunner.Process</c>.
+    /// </summary>
+    FirstProcess = 6,
+  }
+
+  public readonly struct StartupPhase
+  {
+    public readonly StartupPhaseType type;
+    /// <summary>
+    ///   The id of the calculator node, or -1 if the phase is not of a calculator.
+    /// </summary>
+    public readonly int nodeId;
+    /// <summary>
+    ///   The name of the calculator node, or the path of the resource.
+    /// </summary>
+    public readonly string name;
+    /// <summary>
+    ///   The time elapsed since the startup began, in microseconds.
+    /// </summary>
+    public readonly long startUs;
+    public readonly long durationUs;
+
+    internal StartupPhase(NativeStartupPhase nativePhase)
+    {
+      type = (StartupPhaseType)nativePhase.type;
+      nodeId = nativePhase.nodeId;
+      name = nativePhase.name;
+      startUs = nativePhase.startUs;
+      durationUs = nativePhase.durationUs;
+    }
+
+    public override string ToString() => $"{{ type: {type}, nodeId: {nodeId}, name: \"{name}\", startUs: {startUs}, durationUs: {durationUs} }}";
+  }
+
+  /// <summary>
+  ///   Records the startup of <see cref="CalculatorGraph" /> and <see cref="Tasks.Core.TaskRunner" />, so that the slow startup can be broken down.
+  /// </summary>
+  /// <remarks>
+  ///   <para>
+  ///     The phases are retrieved by <see cref="CalculatorGraph.GetStartupPhases" /> or <see cref="Tasks.Core.TaskRunner.GetStartupPhases" />.
+  ///   </para>
+  ///   <para>
+  ///     To record <see cref="StartupPhaseType.Open" /> and <see cref="StartupPhaseType.FirstProcess" />, the tracer of the graph
+  ///     is enabled unless <c>profiler_config</c> is set. They are not recorded if the native library is built without the MediaPipe profiler.
+  ///   </para>
+  ///   <para>
+  ///     The tracer records every event of the graph, which costs some time per <c>Process</c>, until the startup window is closed.
+  ///     It's closed when <c>GetStartupPhases</c> is called after the graph is started, after the first <c>TaskRunner.Process</c>,
+  ///     or when an input is sent more than 5 seconds after the startup began. Then the tracer is paused.
+  ///   </para>
+  ///   <para>
+  ///     The resources read and the delegates initialized on the thread starting a graph are attributed to it.
+  ///     The ones on the executor threads are attributed to the graph being started, and are not recorded while several graphs are being started concurrently.
+  ///   </para>
+  /// </remarks>
+  public static class StartupProfiler
+  {
+    /// <summary>
+    ///   It's <c>false</c> by default. Only the graphs created while it's <c>true</c> are recorded.
+    /// </summary>
+    public static bool enabled
+    {
+      get => SafeNativeMethods.mp_StartupProfiler__enabled();
+      set => SafeNativeMethods.mp_StartupProfiler__set_enabled__b(value);
+    }
+
+    internal static List<StartupPhase> Copy(NativeStartupPhaseArray nativePhases)
+    {
+      var phases = new List<StartupPhase>(nativePhases.size);
+      foreach (var nativePhase in nativePhases.AsReadOnlySpan())
+      {
+        phases.Add(new StartupPhase(nativePhase));
+      }
+      nativePhases.Dispose();
+      return phases;
+    }
+  }
+}
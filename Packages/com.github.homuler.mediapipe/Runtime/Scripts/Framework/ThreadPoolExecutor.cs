@@ -0,0 +1,42 @@
+// Copyright (c) 2026 homuler
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+using System;
+
+namespace Mediapipe
+{
+  /// <summary>
+  ///   A fixed-size thread pool that can be shared by multiple <see cref="CalculatorGraph" />s and <see cref="Tasks.Core.TaskRunner" />s.
+  /// </summary>
+  /// <remarks>
+  ///   By default, each graph creates its own thread pool, so running many graphs in one process can oversubscribe the cores.
+  /// </remarks>
+  public class ThreadPoolExecutor : Executor
+  {
+    /// <param name="ptr">Shared pointer of mediapipe::Executor</param>
+    private ThreadPoolExecutor(IntPtr ptr) : base(ptr) { }
+
+    public int numThreads => SafeNativeMethods.mp_ThreadPoolExecutor__num_threads(mpPtr);
+
+    /// <param name="numThreads">The number of the worker threads, which must be positive</param>
+    /// <param name="threadNamePrefix">The prefix of the worker thread names</param>
+    /// <param name="nicePriorityLevel">
+    ///   The nice value of the worker threads. It's ignored on the platforms that don't support it.
+    /// </param>
+    /// <param name="cpuSet">
+    ///   The CPUs on which the worker threads can run. If it's <c>null</c> or empty, the threads are not pinned.
+    ///   It's ignored on the platforms that don't support CPU affinity.
+    /// </param>
+    public static ThreadPoolExecutor Create(int numThreads, string threadNamePrefix = null, int nicePriorityLevel = 0, int[] cpuSet = null)
+    {
+      var cpus = cpuSet ?? Array.Empty<int>();
+      UnsafeNativeMethods.mp_ThreadPoolExecutor_Create__i_PKc_i_Pi_i(numThreads, threadNamePrefix, nicePriorityLevel, cpus, cpus.Length, out var statusPtr, out var executorPtr).Assert();
+      AssertStatusOk(statusPtr);
+
+      return new ThreadPoolExecutor(executorPtr);
+    }
+  }
+}
@@ -0,0 +1,107 @@
+// Copyright (c) 2026 homuler
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+using System;
+using System.Runtime.InteropServices;
+
+namespace Mediapipe
+{
+  /// <summary>
+  ///   A running <see cref="CalculatorGraph" /> acquired from <see cref="WarmGraphPool" />.
+  /// </summary>
+  /// <remarks>
+  ///   Disposing it cancels the graph if <see cref="WaitUntilDone" /> has not been called.
+  /// </remarks>
+  public class WarmGraph : MpResourceHandle
+  {
+    internal WarmGraph(IntPtr ptr) : base(ptr) { }
+
+    protected override void DeleteMpPtr()
+    {
+      UnsafeNativeMethods.mp_WarmGraph__delete(ptr);
+    }
+
+    /// <summary>
+    ///   Passes the packets of <paramref name="streamName" /> to <paramref name="nativePacketCallback" /> from now on.
+    /// </summary>
+    /// <remarks>
+    ///   Since the graph is already running, <paramref name="streamName" /> must be one of the output streams observed by the pool.
+    /// </remarks>
+    public void ObserveOutputStream(string streamName, int streamId, CalculatorGraph.NativePacketCallback nativePacketCallback)
+    {
+      UnsafeNativeMethods.mp_WarmGraph__ObserveOutputStream__PKc_i_PF(mpPtr, streamName, streamId, nativePacketCallback, out var statusPtr).Assert();
+
+      GC.KeepAlive(this);
+      AssertStatusOk(statusPtr);
+    }
+
+    public void ObserveOutputStream<T>(string streamName, CalculatorGraph.PacketCallback<T> packetCallback, out GCHandle callbackHandle)
+    {
+      CalculatorGraph.NativePacketCallback nativePacketCallback = (IntPtr graphPtr, int streamId, IntPtr packetPtr) =>
+      {
+        try
+        {
+          var packet = Packet<T>.CreateForReference(packetPtr);
+          packetCallback(packet);
+          return StatusArgs.Ok();
+        }
+        catch (Exception e)
+        {
+          return StatusArgs.Internal(e.ToString());
+        }
+      };
+      callbackHandle = GCHandle.Alloc(nativePacketCallback, GCHandleType.Pinned);
+
+      ObserveOutputStream(streamName, 0, nativePacketCallback);
+    }
+
+    public void AddPacketToInputStream<T>(string streamName, Packet<T> packet)
+    {
+      UnsafeNativeMethods.mp_WarmGraph__AddPacketToInputStream__PKc_Ppacket(mpPtr, streamName, packet.mpPtr, out var statusPtr).Assert();
+      packet.Dispose(); // respect move semantics
+
+      GC.KeepAlive(this);
+      AssertStatusOk(statusPtr);
+    }
+
+    public void CloseInputStream(string streamName)
+    {
+      UnsafeNativeMethods.mp_WarmGraph__CloseInputStream__PKc(mpPtr, streamName, out var statusPtr).Assert();
+
+      GC.KeepAlive(this);
+      AssertStatusOk(statusPtr);
+    }
+
+    public void CloseAllPacketSources()
+    {
+      UnsafeNativeMethods.mp_WarmGraph__CloseAllPacketSources(mpPtr, out var statusPtr).Assert();
+
+      GC.KeepAlive(this);
+      AssertStatusOk(statusPtr);
+    }
+
+    public void WaitUntilIdle()
+    {
+      UnsafeNativeMethods.mp_WarmGraph__WaitUntilIdle(mpPtr, out var statusPtr).Assert();
+
+      GC.KeepAlive(this);
+      AssertStatusOk(statusPtr);
+    }
+
+    public void WaitUntilDone()
+    {
+      UnsafeNativeMethods.mp_WarmGraph__WaitUntilDone(mpPtr, out var statusPtr).Assert();
+
+      GC.KeepAlive(this);
+      AssertStatusOk(statusPtr);
+    }
+
+    public bool HasError()
+    {
+      return SafeNativeMethods.mp_WarmGraph__HasError(mpPtr);
+    }
+  }
+}
@@ -0,0 +1,77 @@
+// Copyright (c) 2026 homuler
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+using System;
+using Google.Protobuf;
+
+namespace Mediapipe
+{
+  /// <summary>
+  ///   Prepares <see cref="WarmGraph" />s of the same config in the background,
+  ///   so that a new stream (e.g. after a scene switch or for a new camera) can start at the steady-state latency.
+  /// </summary>
+  /// <remarks>
+  ///   Each graph is initialized, started, and fed <c>warmupInputs</c> to load the models and run the first inference. Their outputs are discarded.
+  ///   When a graph is acquired, the pool starts preparing another one.
+  ///   If it fails, the pool retries with an exponential backoff (from 100 ms up to 10 s) until it's disposed.
+  ///   <para>
+  ///     The graphs are not reset after the warmup, so the stateful calculators (e.g. tracking loops or smoothing filters) keep the state of <c>warmupInputs</c>.
+  ///     Use the inputs that leave no state (e.g. a blank image, in which nothing is detected).
+  ///   </para>
+  /// </remarks>
+  public class WarmGraphPool : MpResourceHandle
+  {
+    /// <param name="poolSize">The number of the graphs kept ready</param>
+    /// <param name="warmupInputs">
+    ///   The packets sent to the graph input streams, keyed by the stream names (e.g. a blank image of the expected size).
+    /// </param>
+    /// <param name="warmupTimestamp">
+    ///   The timestamp of <paramref name="warmupInputs" /> in microseconds. The packets sent to an acquired graph must have greater timestamps.
+    /// </param>
+    /// <param name="outputStreams">
+    ///   The output streams that can be observed after a graph is acquired. If it's <c>null</c>, the graph output streams of <paramref name="config" /> are used.
+    /// </param>
+    public static WarmGraphPool Create(CalculatorGraphConfig config, int poolSize, PacketMap warmupInputs, long warmupTimestamp = 0,
+        string[] outputStreams = null, PacketMap sidePackets = null)
+    {
+      var bytes = config.ToByteArray();
+      outputStreams = outputStreams ?? new string[0];
+      sidePackets = sidePackets ?? new PacketMap();
+      UnsafeNativeMethods.mp_WarmGraphPool_Create__PKc_i_i_PPKc_i_Rsp_ll_Rsp(bytes, bytes.Length, poolSize, outputStreams, outputStreams.Length,
+          warmupInputs.mpPtr, warmupTimestamp, sidePackets.mpPtr, out var statusPtr, out var warmGraphPoolPtr).Assert();
+      GC.KeepAlive(warmupInputs);
+      GC.KeepAlive(sidePackets);
+
+      AssertStatusOk(statusPtr);
+      return new WarmGraphPool(warmGraphPoolPtr);
+    }
+
+    private WarmGraphPool(IntPtr ptr) : base(ptr) { }
+
+    protected override void DeleteMpPtr()
+    {
+      UnsafeNativeMethods.mp_WarmGraphPool__delete(ptr);
+    }
+
+    /// <summary>
+    ///   The number of the graphs that can be acquired without waiting.
+    /// </summary>
+    public int readyCount => SafeNativeMethods.mp_WarmGraphPool__ready_count(mpPtr);
+
+    /// <summary>
+    ///   Returns a ready graph, blocking until one is ready if necessary.
+    /// </summary>
+    /// <exception cref="BadStatusException">Thrown if no graph is ready and the last attempt to prepare one has failed</exception>
+    public WarmGraph Acquire()
+    {
+      UnsafeNativeMethods.mp_WarmGraphPool__Acquire(mpPtr, out var statusPtr, out var warmGraphPtr).Assert();
+
+      GC.KeepAlive(this);
+      AssertStatusOk(statusPtr);
+      return new WarmGraph(warmGraphPtr);
+    }
+  }
+}
@@ -0,0 +1,57 @@
+// Copyright (c) 2026 homuler
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+using System;
+using System.Runtime.InteropServices;
+
+namespace Mediapipe
+{
+  [StructLayout(LayoutKind.Sequential)]
+  internal readonly struct NativeCalculatorProfileStats
+  {
+    private readonly IntPtr _name;
+    public readonly long openRuntimeUs;
+    public readonly long closeRuntimeUs;
+    public readonly long processCount;
+    public readonly long processRuntimeUs;
+    public readonly long intervalSizeUs;
+    public readonly int numIntervals;
+    private readonly IntPtr _processHistogram;
+
+    public string name => Marshal.PtrToStringAnsi(_name);
+
+    public ReadOnlySpan<long> processHistogram
+    {
+      get
+      {
+        unsafe
+        {
+          return new ReadOnlySpan<long>((long*)_processHistogram, numIntervals);
+        }
+      }
+    }
+  }
+
+  [StructLayout(LayoutKind.Sequential)]
+  internal readonly struct NativeCalculatorProfileStatsArray
+  {
+    private readonly IntPtr _data;
+    public readonly int size;
+
+    public void Dispose()
+    {
+      UnsafeNativeMethods.mp_api_CalculatorProfileStatsArray__delete(this);
+    }
+
+    public ReadOnlySpan<NativeCalculatorProfileStats> AsReadOnlySpan()
+    {
+      unsafe
+      {
+        return new ReadOnlySpan<NativeCalculatorProfileStats>((NativeCalculatorProfileStats*)_data, size);
+      }
+    }
+  }
+}
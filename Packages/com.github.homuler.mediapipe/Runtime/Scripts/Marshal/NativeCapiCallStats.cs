@@ -0,0 +1,41 @@
+// Copyright (c) 2026 homuler
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+using System;
+using System.Runtime.InteropServices;
+
+namespace Mediapipe
+{
+  [StructLayout(LayoutKind.Sequential)]
+  internal readonly struct NativeCapiCallStats
+  {
+    private readonly IntPtr _name;
+    public readonly long calls;
+    public readonly long totalNs;
+
+    public string name => Marshal.PtrToStringAnsi(_name);
+  }
+
+  [StructLayout(LayoutKind.Sequential)]
+  internal readonly struct NativeCapiCallStatsArray
+  {
+    private readonly IntPtr _data;
+    public readonly int size;
+
+    public void Dispose()
+    {
+      UnsafeNativeMethods.mp_api_CapiCallStatsArray__delete(this);
+    }
+
+    public ReadOnlySpan<NativeCapiCallStats> AsReadOnlySpan()
+    {
+      unsafe
+      {
+        return new ReadOnlySpan<NativeCapiCallStats>((NativeCapiCallStats*)_data, size);
+      }
+    }
+  }
+}
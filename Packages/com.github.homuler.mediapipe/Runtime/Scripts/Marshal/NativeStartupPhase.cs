@@ -0,0 +1,43 @@
+// Copyright (c) 2026 homuler
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+using System;
+using System.Runtime.InteropServices;
+
+namespace Mediapipe
+{
+  [StructLayout(LayoutKind.Sequential)]
+  internal readonly struct NativeStartupPhase
+  {
+    public readonly int type;
+    public readonly int nodeId;
+    private readonly IntPtr _name;
+    public readonly long startUs;
+    public readonly long durationUs;
+
+    public string name => Marshal.PtrToStringAnsi(_name);
+  }
+
+  [StructLayout(LayoutKind.Sequential)]
+  internal readonly struct NativeStartupPhaseArray
+  {
+    private readonly IntPtr _data;
+    public readonly int size;
+
+    public void Dispose()
+    {
+      UnsafeNativeMethods.mp_api_StartupPhaseArray__delete(this);
+    }
+
+    public ReadOnlySpan<NativeStartupPhase> AsReadOnlySpan()
+    {
+      unsafe
+      {
+        return new ReadOnlySpan<NativeStartupPhase>((NativeStartupPhase*)_data, size);
+      }
+    }
+  }
+}
@@ -0,0 +1,26 @@
+// Copyright (c) 2026 homuler
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+using System.Runtime.InteropServices;
+
+namespace Mediapipe
+{
+  internal static partial class SafeNativeMethods
+  {
+    [DllImport(MediaPipeLibrary, ExactSpelling = true)]
+    [return: MarshalAs(UnmanagedType.I1)]
+    public static extern bool mp_ExpandedConfigCache__enabled();
+
+    [DllImport(MediaPipeLibrary, ExactSpelling = true)]
+    public static extern void mp_ExpandedConfigCache__set_enabled__b([MarshalAs(UnmanagedType.I1)] bool enabled);
+
+    [DllImport(MediaPipeLibrary, ExactSpelling = true)]
+    public static extern void mp_ExpandedConfigCache__Clear();
+
+    [DllImport(MediaPipeLibrary, ExactSpelling = true)]
+    public static extern void mp_ExpandedConfigCache__GetStats(out ExpandedConfigCacheStats stats);
+  }
+}
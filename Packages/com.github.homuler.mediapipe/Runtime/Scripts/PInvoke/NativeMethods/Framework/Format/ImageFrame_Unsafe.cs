@@ -41,6 +41,14 @@ namespace Mediapipe
     [DllImport(MediaPipeLibrary, ExactSpelling = true)]
     public static extern MpReturnCode mp_ImageFrame__CopyToBuffer__Pf_i(IntPtr imageFrame, IntPtr buffer, int bufferSize);
 
+    [DllImport(MediaPipeLibrary, ExactSpelling = true)]
+    public static extern MpReturnCode mp_ImageFrame__ExportMask__i_i_f_Pui8_i(IntPtr imageFrame, int width, int height, float threshold,
+        IntPtr buffer, int bufferSize, out IntPtr status);
+
+    [DllImport(MediaPipeLibrary, ExactSpelling = true)]
+    public static extern MpReturnCode mp_ImageFrame__ExportCategoryMask__i_i_Pui_i_Pui8_i(IntPtr imageFrame, int width, int height,
+        IntPtr colors, int colorsSize, IntPtr buffer, int bufferSize, out IntPtr status);
+
     #region Packet
     [DllImport(MediaPipeLibrary, ExactSpelling = true)]
     public static extern MpReturnCode mp__MakeImageFramePacket__Pif(IntPtr imageFrame, out IntPtr packet);
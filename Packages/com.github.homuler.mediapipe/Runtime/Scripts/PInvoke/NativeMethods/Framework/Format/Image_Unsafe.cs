@@ -33,6 +33,14 @@ namespace Mediapipe
     [DllImport(MediaPipeLibrary, ExactSpelling = true)]
     public static extern MpReturnCode mp_Image__ConvertToGpu(IntPtr image, [MarshalAs(UnmanagedType.I1)] out bool result);
 
+    [DllImport(MediaPipeLibrary, ExactSpelling = true)]
+    public static extern MpReturnCode mp_Image__ExportMask__i_i_f_Pui8_i(IntPtr image, int width, int height, float threshold,
+        IntPtr buffer, int bufferSize, out IntPtr status);
+
+    [DllImport(MediaPipeLibrary, ExactSpelling = true)]
+    public static extern MpReturnCode mp_Image__ExportCategoryMask__i_i_Pui_i_Pui8_i(IntPtr image, int width, int height,
+        IntPtr colors, int colorsSize, IntPtr buffer, int bufferSize, out IntPtr status);
+
     #region PixelWriteLock
     [DllImport(MediaPipeLibrary, ExactSpelling = true)]
     public static extern MpReturnCode mp_PixelWriteLock__RI(IntPtr image, out IntPtr pixelWriteLock);
@@ -0,0 +1,41 @@
+// Copyright (c) 2026 homuler
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+using System;
+using System.Runtime.InteropServices;
+
+namespace Mediapipe
+{
+  internal static partial class UnsafeNativeMethods
+  {
+    [DllImport(MediaPipeLibrary, ExactSpelling = true)]
+    public static extern MpReturnCode mp_GraphPool_Create__PKc_i_i_Pe_i(byte[] serializedConfig, int size, int poolSize, IntPtr executor, int maxQueueSize,
+        out IntPtr status, out IntPtr graphPool);
+
+    [DllImport(MediaPipeLibrary, ExactSpelling = true)]
+    public static extern void mp_GraphPool__delete(IntPtr graphPool);
+
+    [DllImport(MediaPipeLibrary, ExactSpelling = true)]
+    public static extern MpReturnCode mp_GraphPool__ObserveOutputStream__PKc_i_PF(IntPtr graphPool, string streamName, int callbackId,
+        [MarshalAs(UnmanagedType.FunctionPtr)] GraphPool.NativePacketCallback packetCallback, out IntPtr status);
+
+    [DllImport(MediaPipeLibrary, ExactSpelling = true)]
+    public static extern MpReturnCode mp_GraphPool__StartRun__Rsp(IntPtr graphPool, IntPtr sidePackets, out IntPtr status);
+
+    [DllImport(MediaPipeLibrary, ExactSpelling = true)]
+    public static extern MpReturnCode mp_GraphPool__AddPacketToInputStream__i_PKc_Ppacket(IntPtr graphPool, int streamId, string streamName, IntPtr packet,
+        out IntPtr status);
+
+    [DllImport(MediaPipeLibrary, ExactSpelling = true)]
+    public static extern MpReturnCode mp_GraphPool__CloseStream__i(IntPtr graphPool, int streamId, out IntPtr status);
+
+    [DllImport(MediaPipeLibrary, ExactSpelling = true)]
+    public static extern MpReturnCode mp_GraphPool__Close(IntPtr graphPool, out IntPtr status);
+
+    [DllImport(MediaPipeLibrary, ExactSpelling = true)]
+    public static extern MpReturnCode mp_GraphPool__GetStreamStats__i(IntPtr graphPool, int streamId, out IntPtr status, out GraphPoolStats stats);
+  }
+}
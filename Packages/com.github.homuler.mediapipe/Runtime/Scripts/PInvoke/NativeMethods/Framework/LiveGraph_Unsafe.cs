@@ -0,0 +1,51 @@
+// Copyright (c) 2026 homuler
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+using System;
+using System.Runtime.InteropServices;
+
+namespace Mediapipe
+{
+  internal static partial class UnsafeNativeMethods
+  {
+    [DllImport(MediaPipeLibrary, ExactSpelling = true)]
+    public static extern MpReturnCode mp_LiveGraph_Create__PKc_i(byte[] serializedConfig, int size, out IntPtr status, out IntPtr liveGraph);
+
+    [DllImport(MediaPipeLibrary, ExactSpelling = true)]
+    public static extern void mp_LiveGraph__delete(IntPtr liveGraph);
+
+    [DllImport(MediaPipeLibrary, ExactSpelling = true)]
+    public static extern MpReturnCode mp_LiveGraph__Config(IntPtr liveGraph, out SerializedProto serializedProto);
+
+    [DllImport(MediaPipeLibrary, ExactSpelling = true)]
+    public static extern MpReturnCode mp_LiveGraph__ObserveOutputStream__PKc_i_PF(IntPtr liveGraph, string streamName, int streamId,
+        [MarshalAs(UnmanagedType.FunctionPtr)] CalculatorGraph.NativePacketCallback packetCallback, out IntPtr status);
+
+    [DllImport(MediaPipeLibrary, ExactSpelling = true)]
+    public static extern MpReturnCode mp_LiveGraph__StartRun__Rsp(IntPtr liveGraph, IntPtr sidePackets, out IntPtr status);
+
+    [DllImport(MediaPipeLibrary, ExactSpelling = true)]
+    public static extern MpReturnCode mp_LiveGraph__UpdateNodeOptions__PKc_PKc_i(IntPtr liveGraph, string nodeName, byte[] serializedNode, int size, out IntPtr status);
+
+    [DllImport(MediaPipeLibrary, ExactSpelling = true)]
+    public static extern MpReturnCode mp_LiveGraph__UpdateSidePacket__PKc_Ppacket(IntPtr liveGraph, string name, IntPtr packet);
+
+    [DllImport(MediaPipeLibrary, ExactSpelling = true)]
+    public static extern MpReturnCode mp_LiveGraph__ApplyUpdates(IntPtr liveGraph, out IntPtr status);
+
+    [DllImport(MediaPipeLibrary, ExactSpelling = true)]
+    public static extern MpReturnCode mp_LiveGraph__WaitForUpdate(IntPtr liveGraph, out IntPtr status);
+
+    [DllImport(MediaPipeLibrary, ExactSpelling = true)]
+    public static extern MpReturnCode mp_LiveGraph__AddPacketToInputStream__PKc_Ppacket(IntPtr liveGraph, string streamName, IntPtr packet, out IntPtr status);
+
+    [DllImport(MediaPipeLibrary, ExactSpelling = true)]
+    public static extern MpReturnCode mp_LiveGraph__CloseAllPacketSources(IntPtr liveGraph, out IntPtr status);
+
+    [DllImport(MediaPipeLibrary, ExactSpelling = true)]
+    public static extern MpReturnCode mp_LiveGraph__WaitUntilDone(IntPtr liveGraph, out IntPtr status);
+  }
+}
@@ -0,0 +1,24 @@
+// Copyright (c) 2026 homuler
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+using System;
+using System.Runtime.InteropServices;
+
+namespace Mediapipe
+{
+  internal static partial class UnsafeNativeMethods
+  {
+    [DllImport(MediaPipeLibrary, ExactSpelling = true)]
+    public static extern void mp_SharedExecutor__delete(IntPtr executor);
+
+    [DllImport(MediaPipeLibrary, ExactSpelling = true)]
+    public static extern void mp_SharedExecutor__reset(IntPtr executor);
+
+    [DllImport(MediaPipeLibrary, ExactSpelling = true)]
+    public static extern MpReturnCode mp_ThreadPoolExecutor_Create__i_PKc_i_Pi_i(int numThreads, string threadNamePrefix, int nicePriorityLevel,
+        int[] cpuSet, int cpuSetSize, out IntPtr status, out IntPtr executor);
+  }
+}
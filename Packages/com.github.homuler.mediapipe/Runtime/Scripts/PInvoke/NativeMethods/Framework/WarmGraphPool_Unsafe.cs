@@ -0,0 +1,46 @@
+// Copyright (c) 2026 homuler
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+using System;
+using System.Runtime.InteropServices;
+
+namespace Mediapipe
+{
+  internal static partial class UnsafeNativeMethods
+  {
+    [DllImport(MediaPipeLibrary, ExactSpelling = true)]
+    public static extern MpReturnCode mp_WarmGraphPool_Create__PKc_i_i_PPKc_i_Rsp_ll_Rsp(byte[] serializedConfig, int size, int poolSize, string[] outputStreams,
+        int outputStreamCount, IntPtr warmupInputs, long warmupTimestamp, IntPtr sidePackets, out IntPtr status, out IntPtr warmGraphPool);
+
+    [DllImport(MediaPipeLibrary, ExactSpelling = true)]
+    public static extern void mp_WarmGraphPool__delete(IntPtr warmGraphPool);
+
+    [DllImport(MediaPipeLibrary, ExactSpelling = true)]
+    public static extern MpReturnCode mp_WarmGraphPool__Acquire(IntPtr warmGraphPool, out IntPtr status, out IntPtr warmGraph);
+
+    [DllImport(MediaPipeLibrary, ExactSpelling = true)]
+    public static extern void mp_WarmGraph__delete(IntPtr warmGraph);
+
+    [DllImport(MediaPipeLibrary, ExactSpelling = true)]
+    public static extern MpReturnCode mp_WarmGraph__ObserveOutputStream__PKc_i_PF(IntPtr warmGraph, string streamName, int streamId,
+        [MarshalAs(UnmanagedType.FunctionPtr)] CalculatorGraph.NativePacketCallback packetCallback, out IntPtr status);
+
+    [DllImport(MediaPipeLibrary, ExactSpelling = true)]
+    public static extern MpReturnCode mp_WarmGraph__AddPacketToInputStream__PKc_Ppacket(IntPtr warmGraph, string streamName, IntPtr packet, out IntPtr status);
+
+    [DllImport(MediaPipeLibrary, ExactSpelling = true)]
+    public static extern MpReturnCode mp_WarmGraph__CloseInputStream__PKc(IntPtr warmGraph, string streamName, out IntPtr status);
+
+    [DllImport(MediaPipeLibrary, ExactSpelling = true)]
+    public static extern MpReturnCode mp_WarmGraph__CloseAllPacketSources(IntPtr warmGraph, out IntPtr status);
+
+    [DllImport(MediaPipeLibrary, ExactSpelling = true)]
+    public static extern MpReturnCode mp_WarmGraph__WaitUntilIdle(IntPtr warmGraph, out IntPtr status);
+
+    [DllImport(MediaPipeLibrary, ExactSpelling = true)]
+    public static extern MpReturnCode mp_WarmGraph__WaitUntilDone(IntPtr warmGraph, out IntPtr status);
+  }
+}
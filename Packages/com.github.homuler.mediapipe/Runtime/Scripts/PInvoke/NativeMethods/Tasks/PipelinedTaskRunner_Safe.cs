@@ -0,0 +1,20 @@
+// Copyright (c) 2026 homuler
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+using System;
+using System.Runtime.InteropServices;
+
+namespace Mediapipe
+{
+  internal static partial class SafeNativeMethods
+  {
+    [DllImport(MediaPipeLibrary, ExactSpelling = true)]
+    public static extern int mp_tasks_core_PipelinedTaskRunner__in_flight_count(IntPtr taskRunner);
+
+    [DllImport(MediaPipeLibrary, ExactSpelling = true)]
+    public static extern int mp_tasks_core_PipelinedTaskRunner__completed_count(IntPtr taskRunner);
+  }
+}
@@ -0,0 +1,43 @@
+// Copyright (c) 2026 homuler
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+using System;
+using System.Runtime.InteropServices;
+
+namespace Mediapipe
+{
+  internal static partial class UnsafeNativeMethods
+  {
+    [DllImport(MediaPipeLibrary, ExactSpelling = true)]
+    public static extern MpReturnCode mp_tasks_core_PipelinedTaskRunner_Create__PKc_i_i_Pgr_Pe(byte[] serializedConfig, int size, int maxInFlight,
+        IntPtr gpuResources, IntPtr executor, out IntPtr status, out IntPtr taskRunner);
+
+    [DllImport(MediaPipeLibrary, ExactSpelling = true)]
+    public static extern MpReturnCode mp_tasks_core_PipelinedTaskRunner_Create__PKc_i_i_Pe(byte[] serializedConfig, int size, int maxInFlight,
+        IntPtr executor, out IntPtr status, out IntPtr taskRunner);
+
+    [DllImport(MediaPipeLibrary, ExactSpelling = true)]
+    public static extern void mp_tasks_core_PipelinedTaskRunner__delete(IntPtr taskRunner);
+
+    [DllImport(MediaPipeLibrary, ExactSpelling = true)]
+    public static extern MpReturnCode mp_tasks_core_PipelinedTaskRunner__TrySend__Ppm(IntPtr taskRunner, IntPtr inputs, out IntPtr status, out long ticket);
+
+    [DllImport(MediaPipeLibrary, ExactSpelling = true)]
+    public static extern MpReturnCode mp_tasks_core_PipelinedTaskRunner__TryPop__ll_i(IntPtr taskRunner, long ticket, int timeoutMillisec,
+        [MarshalAs(UnmanagedType.I1)] out bool found, out IntPtr status, out IntPtr packetMap);
+
+    [DllImport(MediaPipeLibrary, ExactSpelling = true)]
+    public static extern MpReturnCode mp_tasks_core_PipelinedTaskRunner__TryPopNext__i(IntPtr taskRunner, int timeoutMillisec,
+        [MarshalAs(UnmanagedType.I1)] out bool found, out long ticket, out IntPtr status, out IntPtr packetMap);
+
+    [DllImport(MediaPipeLibrary, ExactSpelling = true)]
+    public static extern MpReturnCode mp_tasks_core_PipelinedTaskRunner__ProcessBatch__PPpm_i_i(IntPtr taskRunner, IntPtr[] inputs, int size, int timeoutMillisec,
+        out IntPtr status, [Out] IntPtr[] packetMaps);
+
+    [DllImport(MediaPipeLibrary, ExactSpelling = true)]
+    public static extern MpReturnCode mp_tasks_core_PipelinedTaskRunner__Close(IntPtr taskRunner, out IntPtr status);
+  }
+}
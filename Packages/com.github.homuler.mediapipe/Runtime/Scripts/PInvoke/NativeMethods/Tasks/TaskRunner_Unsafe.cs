@@ -22,6 +22,18 @@ namespace Mediapipe
         int callbackId, [MarshalAs(UnmanagedType.FunctionPtr)] Tasks.Core.TaskRunner.NativePacketsCallback packetsCallback,
         out IntPtr status, out IntPtr taskRunner);
 
+    [DllImport(MediaPipeLibrary, ExactSpelling = true)]
+    public static extern MpReturnCode mp_tasks_core_TaskRunner_Create__PKc_i_PF_Pgr_Pe(byte[] serializedConfig, int size,
+        int callbackId, [MarshalAs(UnmanagedType.FunctionPtr)] Tasks.Core.TaskRunner.NativePacketsCallback packetsCallback,
+        IntPtr gpuResources, IntPtr executor,
+        out IntPtr status, out IntPtr taskRunner);
+
+    [DllImport(MediaPipeLibrary, ExactSpelling = true)]
+    public static extern MpReturnCode mp_tasks_core_TaskRunner_Create__PKc_i_PF_Pe(byte[] serializedConfig, int size,
+        int callbackId, [MarshalAs(UnmanagedType.FunctionPtr)] Tasks.Core.TaskRunner.NativePacketsCallback packetsCallback,
+        IntPtr executor,
+        out IntPtr status, out IntPtr taskRunner);
+
     [DllImport(MediaPipeLibrary, ExactSpelling = true)]
     public static extern void mp_tasks_core_TaskRunner__delete(IntPtr taskRunner);
 
@@ -31,12 +43,21 @@ namespace Mediapipe
     [DllImport(MediaPipeLibrary, ExactSpelling = true)]
     public static extern MpReturnCode mp_tasks_core_TaskRunner__Send__Ppm(IntPtr taskRunner, IntPtr inputs, out IntPtr status);
 
+    [DllImport(MediaPipeLibrary, ExactSpelling = true)]
+    public static extern MpReturnCode mp_tasks_core_TaskRunner__Process__Ppm_Ppm_Ps(IntPtr taskRunner, IntPtr inputs, IntPtr outputs, IntPtr status);
+
+    [DllImport(MediaPipeLibrary, ExactSpelling = true)]
+    public static extern MpReturnCode mp_tasks_core_TaskRunner__Send__Ppm_Ps(IntPtr taskRunner, IntPtr inputs, IntPtr status);
+
     [DllImport(MediaPipeLibrary, ExactSpelling = true)]
     public static extern MpReturnCode mp_tasks_core_TaskRunner__Close(IntPtr taskRunner, out IntPtr status);
 
     [DllImport(MediaPipeLibrary, ExactSpelling = true)]
     public static extern MpReturnCode mp_tasks_core_TaskRunner__Restart(IntPtr taskRunner, out IntPtr status);
 
+    [DllImport(MediaPipeLibrary, ExactSpelling = true)]
+    public static extern MpReturnCode mp_tasks_core_TaskRunner__GetStartupPhases(IntPtr taskRunner, out NativeStartupPhaseArray phases);
+
     [DllImport(MediaPipeLibrary, ExactSpelling = true)]
     public static extern MpReturnCode mp_tasks_core_TaskRunner__GetGraphConfig(IntPtr taskRunner, out SerializedProto serializedProto);
   }
@@ -0,0 +1,28 @@
+// Copyright (c) 2026 homuler
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+using System;
+using System.Runtime.InteropServices;
+
+namespace Mediapipe
+{
+  internal static partial class UnsafeNativeMethods
+  {
+    [DllImport(MediaPipeLibrary, ExactSpelling = true)]
+    public static extern MpReturnCode mp_Packet__EncodeMask__i_i_Pui8_i(IntPtr packet, MaskEncoding encoding, int bits, IntPtr buffer, int bufferSize,
+        out IntPtr status, out int size);
+
+    [DllImport(MediaPipeLibrary, ExactSpelling = true)]
+    public static extern MpReturnCode mp_Packet__EncodeCategoryMask__i_i_Pui8_i(IntPtr packet, MaskEncoding encoding, int bits, IntPtr buffer, int bufferSize,
+        out IntPtr status, out int size);
+
+    [DllImport(MediaPipeLibrary, ExactSpelling = true)]
+    public static extern MpReturnCode mp__ReadMaskHeader__Pui8_i(IntPtr data, int size, out IntPtr status, out MaskHeader header);
+
+    [DllImport(MediaPipeLibrary, ExactSpelling = true)]
+    public static extern MpReturnCode mp__DecodeMask__Pui8_i_Pui8_i(IntPtr data, int size, IntPtr buffer, int bufferSize, out IntPtr status);
+  }
+}
@@ -0,0 +1,18 @@
+// Copyright (c) 2026 homuler
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+using System;
+using System.Runtime.InteropServices;
+
+namespace Mediapipe
+{
+  internal static partial class UnsafeNativeMethods
+  {
+    [DllImport(MediaPipeLibrary, ExactSpelling = true)]
+    public static extern MpReturnCode mp__CompositeMask__Pif_Pif_Ppacket_ui_i_b_Pui8_i(IntPtr foreground, IntPtr background, IntPtr maskPacket,
+        uint backgroundColor, int featherRadius, [MarshalAs(UnmanagedType.I1)] bool invert, IntPtr buffer, int bufferSize, out IntPtr status);
+  }
+}
@@ -17,5 +17,15 @@ namespace Mediapipe
     [DllImport(MediaPipeLibrary, ExactSpelling = true)]
     public static extern void mp__SetCustomGlobalPathResolver__P(
         [MarshalAs(UnmanagedType.FunctionPtr)] ResourceUtil.PathResolver resolver);
+
+    [DllImport(MediaPipeLibrary, ExactSpelling = true)]
+    public static extern void mp__SetCustomGlobalResourceLocator__P(
+        [MarshalAs(UnmanagedType.FunctionPtr)] ResourceUtil.NativeResourceLocator locator);
+
+    [DllImport(MediaPipeLibrary, ExactSpelling = true)]
+    public static extern void mp__ClearCustomGlobalAssetBundle();
+
+    [DllImport(MediaPipeLibrary, ExactSpelling = true)]
+    public static extern void mp__SetAssetBundleExtractionDirectory__PKc(string directory);
   }
 }
@@ -0,0 +1,228 @@
+// Copyright (c) 2026 homuler
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+using System;
+using System.Collections.Generic;
+using Google.Protobuf;
+
+namespace Mediapipe.Tasks.Core
+{
+  /// <summary>
+  ///   Runs a graph in the live stream mode, keeping at most <c>maxInFlight</c> inputs in flight.
+  ///   Instead of receiving the results on the graph thread, you can take them by the tickets returned by <see cref="TrySend" />.
+  /// </summary>
+  /// <remarks>
+  ///   Each input <see cref="PacketMap" /> must contain at least one packet with a timestamp, and the timestamps must be monotonically increasing.
+  ///   If the graph drops an input, its result is completed with <see cref="StatusCode.Unavailable" />.
+  /// </remarks>
+  public class PipelinedTaskRunner : MpResourceHandle
+  {
+    /// <param name="gpuResources">If it's <c>null</c>, the graph runs without GPU resources.</param>
+    /// <param name="executor">
+    ///   The default executor of the graph. If it's <c>null</c>, the graph creates its own thread pool.
+    /// </param>
+    public static PipelinedTaskRunner Create(CalculatorGraphConfig config, int maxInFlight, GpuResources gpuResources, Executor executor = null)
+    {
+      var bytes = config.ToByteArray();
+      var executorPtr = executor == null ? IntPtr.Zero : executor.sharedPtr;
+      IntPtr statusPtr;
+      IntPtr taskRunnerPtr;
+      if (gpuResources == null)
+      {
+        UnsafeNativeMethods.mp_tasks_core_PipelinedTaskRunner_Create__PKc_i_i_Pe(bytes, bytes.Length, maxInFlight, executorPtr, out statusPtr, out taskRunnerPtr).Assert();
+      }
+      else
+      {
+        UnsafeNativeMethods.mp_tasks_core_PipelinedTaskRunner_Create__PKc_i_i_Pgr_Pe(bytes, bytes.Length, maxInFlight, gpuResources.sharedPtr, executorPtr, out statusPtr, out taskRunnerPtr).Assert();
+      }
+      GC.KeepAlive(gpuResources);
+      GC.KeepAlive(executor);
+
+      AssertStatusOk(statusPtr);
+      return new PipelinedTaskRunner(taskRunnerPtr);
+    }
+
+    public static PipelinedTaskRunner Create(CalculatorGraphConfig config, int maxInFlight) => Create(config, maxInFlight, null);
+
+    private PipelinedTaskRunner(IntPtr ptr) : base(ptr) { }
+
+    protected override void DeleteMpPtr()
+    {
+      UnsafeNativeMethods.mp_tasks_core_PipelinedTaskRunner__delete(ptr);
+    }
+
+    /// <summary>
+    ///   The number of inputs whose results are not completed yet.
+    /// </summary>
+    public int inFlightCount => SafeNativeMethods.mp_tasks_core_PipelinedTaskRunner__in_flight_count(mpPtr);
+
+    /// <summary>
+    ///   The number of results that are completed but not taken yet.
+    /// </summary>
+    public int completedCount => SafeNativeMethods.mp_tasks_core_PipelinedTaskRunner__completed_count(mpPtr);
+
+    /// <summary>
+    ///   Sends <paramref name="inputs" /> to the graph unless the pipeline is full.
+    /// </summary>
+    /// <remarks>
+    ///   If <paramref name="inputs" /> is accepted, it's disposed (moved to the graph).
+    ///   Otherwise, it's left untouched so that you can send it again later.
+    /// </remarks>
+    /// <param name="ticket">
+    ///   The ticket to take the result, or <c>-1</c> if the pipeline is full.
+    /// </param>
+    /// <returns>
+    ///   <c>true</c> if <paramref name="inputs" /> is accepted; <c>false</c> if <c>maxInFlight</c> inputs are already in flight.
+    /// </returns>
+    public bool TrySend(PacketMap inputs, out long ticket)
+    {
+      UnsafeNativeMethods.mp_tasks_core_PipelinedTaskRunner__TrySend__Ppm(mpPtr, inputs.mpPtr, out var statusPtr, out ticket).Assert();
+      GC.KeepAlive(this);
+
+      AssertStatusOk(statusPtr);
+      if (ticket < 0)
+      {
+        GC.KeepAlive(inputs);
+        return false;
+      }
+      inputs.Dispose(); // respect move semantics
+      return true;
+    }
+
+    /// <summary>
+    ///   Takes the result of <paramref name="ticket" />, waiting at most <paramref name="timeoutMillisec" /> until it's completed.
+    /// </summary>
+    /// <exception cref="BadStatusException">Thrown if the graph failed to process the input, or the input was dropped.</exception>
+    /// <returns>
+    ///   <c>true</c> if the result is taken; <c>false</c> if it's not completed yet or <paramref name="ticket" /> is unknown.
+    /// </returns>
+    public bool TryGetResult(long ticket, out PacketMap outputs, int timeoutMillisec = 0)
+    {
+      UnsafeNativeMethods.mp_tasks_core_PipelinedTaskRunner__TryPop__ll_i(mpPtr, ticket, timeoutMillisec, out var found, out var statusPtr, out var packetMapPtr).Assert();
+      GC.KeepAlive(this);
+
+      return TakeResult(found, statusPtr, packetMapPtr, out outputs);
+    }
+
+    /// <summary>
+    ///   Takes the completed result with the smallest ticket, waiting at most <paramref name="timeoutMillisec" /> until any is completed.
+    /// </summary>
+    /// <exception cref="BadStatusException">Thrown if the graph failed to process the input, or the input was dropped.</exception>
+    public bool TryGetNextResult(out long ticket, out PacketMap outputs, int timeoutMillisec = 0)
+    {
+      UnsafeNativeMethods.mp_tasks_core_PipelinedTaskRunner__TryPopNext__i(mpPtr, timeoutMillisec, out var found, out ticket, out var statusPtr, out var packetMapPtr).Assert();
+      GC.KeepAlive(this);
+
+      return TakeResult(found, statusPtr, packetMapPtr, out outputs);
+    }
+
+    /// <summary>
+    ///   Takes all the completed results without waiting.
+    /// </summary>
+    /// <remarks>
+    ///   The failed results are skipped, and their tickets are added to <paramref name="failedTickets" /> if it's not <c>null</c>.
+    /// </remarks>
+    /// <returns>The number of the results added to <paramref name="results" /></returns>
+    public int DrainResults(IDictionary<long, PacketMap> results, ICollection<long> failedTickets = null)
+    {
+      var count = 0;
+      while (true)
+      {
+        UnsafeNativeMethods.mp_tasks_core_PipelinedTaskRunner__TryPopNext__i(mpPtr, 0, out var found, out var ticket, out var statusPtr, out var packetMapPtr).Assert();
+        GC.KeepAlive(this);
+
+        if (!found)
+        {
+          return count;
+        }
+        var ok = SafeNativeMethods.absl_Status__ok(statusPtr);
+        UnsafeNativeMethods.absl_Status__delete(statusPtr);
+        if (!ok)
+        {
+          failedTickets?.Add(ticket);
+          continue;
+        }
+        results.Add(ticket, new PacketMap(packetMapPtr, true));
+        count++;
+      }
+    }
+
+    /// <summary>
+    ///   Processes <paramref name="inputs" /> as a batch and returns the outputs in the same order.
+    /// </summary>
+    /// <remarks>
+    ///   <para>
+    ///     The inputs are sent without waiting for the previous results, up to <c>maxInFlight</c> at a time,
+    ///     so the calculators in the graph can process different frames concurrently.
+    ///     Each model is still invoked once per frame.
+    ///   </para>
+    ///   <para>
+    ///     <paramref name="inputs" /> are disposed (moved to the graph).
+    ///     Don't call this method while other threads are calling <see cref="TrySend" />.
+    ///   </para>
+    /// </remarks>
+    /// <returns>
+    ///   The outputs for each input. The element is <c>null</c> if the input was dropped by the graph.
+    /// </returns>
+    /// <exception cref="BadStatusException">Thrown if the graph failed to process any input, or the results were not emitted within <paramref name="timeoutMillisec" />.</exception>
+    public PacketMap[] ProcessBatch(IList<PacketMap> inputs, int timeoutMillisec)
+    {
+      var inputPtrs = new IntPtr[inputs.Count];
+      for (var i = 0; i < inputPtrs.Length; i++)
+      {
+        inputPtrs[i] = inputs[i].mpPtr;
+      }
+      var outputPtrs = new IntPtr[inputPtrs.Length];
+      UnsafeNativeMethods.mp_tasks_core_PipelinedTaskRunner__ProcessBatch__PPpm_i_i(mpPtr, inputPtrs, inputPtrs.Length, timeoutMillisec, out var statusPtr, outputPtrs).Assert();
+      GC.KeepAlive(this);
+
+      foreach (var input in inputs)
+      {
+        input.Dispose(); // respect move semantics
+      }
+
+      var outputs = new PacketMap[outputPtrs.Length];
+      for (var i = 0; i < outputs.Length; i++)
+      {
+        outputs[i] = outputPtrs[i] == IntPtr.Zero ? null : new PacketMap(outputPtrs[i], true);
+      }
+
+      using (var status = new Status(statusPtr, true))
+      {
+        // NOTE: dropped inputs are not errors, since the outputs are not emitted by design.
+        if (!status.Ok() && status.Code() != StatusCode.Unavailable)
+        {
+          foreach (var output in outputs)
+          {
+            output?.Dispose();
+          }
+          status.AssertOk();
+        }
+      }
+      return outputs;
+    }
+
+    public void Close()
+    {
+      UnsafeNativeMethods.mp_tasks_core_PipelinedTaskRunner__Close(mpPtr, out var statusPtr).Assert();
+      GC.KeepAlive(this);
+
+      AssertStatusOk(statusPtr);
+    }
+
+    private static bool TakeResult(bool found, IntPtr statusPtr, IntPtr packetMapPtr, out PacketMap outputs)
+    {
+      if (!found)
+      {
+        outputs = null;
+        return false;
+      }
+      AssertStatusOk(statusPtr);
+      outputs = new PacketMap(packetMapPtr, true);
+      return true;
+    }
+  }
+}
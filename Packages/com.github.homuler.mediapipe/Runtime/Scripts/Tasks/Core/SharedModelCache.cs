@@ -0,0 +1,65 @@
+// Copyright (c) 2026 homuler
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+using System.Runtime.InteropServices;
+
+namespace Mediapipe.Tasks.Core
+{
+  [StructLayout(LayoutKind.Sequential)]
+  public readonly struct SharedModelCacheStats
+  {
+    /// <summary>
+    ///   The number of the model assets found in the cache.
+    /// </summary>
+    public readonly long hits;
+    /// <summary>
+    ///   The number of the model assets loaded into the cache.
+    /// </summary>
+    public readonly long misses;
+    /// <summary>
+    ///   The number of the model assets currently in the cache.
+    /// </summary>
+    public readonly long entries;
+    /// <summary>
+    ///   The total size of the model assets currently in the cache.
+    /// </summary>
+    public readonly long cachedBytes;
+    /// <summary>
+    ///   The total size of the model assets served from the cache, i.e. the bytes that would have been loaded again without the cache.
+    /// </summary>
+    public readonly long sharedBytes;
+  }
+
+  /// <summary>
+  ///   A process-wide cache of the model assets, shared by <see cref="TaskRunner" />s and <see cref="CalculatorGraph" />s.
+  /// </summary>
+  /// <remarks>
+  ///   When a graph is created, the model assets in its config (<see cref="Proto.ExternalFile" />) are loaded into the cache,
+  ///   and replaced with the pointers to the cached buffers, so the graphs that use the same model don't have their own copies.
+  ///   The cached buffers are released when no graph uses them.
+  /// </remarks>
+  public static class SharedModelCache
+  {
+    /// <summary>
+    ///   If <c>true</c>, the graphs created after that share the model assets in the cache. It's <c>false</c> by default.
+    /// </summary>
+    /// <remarks>
+    ///   The config returned by the graph (e.g. <see cref="TaskRunner.GetGraphConfig" />) refers to the cached buffers by their addresses,
+    ///   so it's valid only while the graph is alive, and must not be used to create another graph after that.
+    /// </remarks>
+    public static bool enabled
+    {
+      get => SafeNativeMethods.mp_SharedModelCache__enabled();
+      set => SafeNativeMethods.mp_SharedModelCache__set_enabled__b(value);
+    }
+
+    public static SharedModelCacheStats GetStats()
+    {
+      SafeNativeMethods.mp_SharedModelCache__GetStats(out var stats);
+      return stats;
+    }
+  }
+}
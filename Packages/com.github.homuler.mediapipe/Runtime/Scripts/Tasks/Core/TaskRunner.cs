@@ -5,6 +5,7 @@
 // https://opensource.org/licenses/MIT.
 
 using System;
+using System.Collections.Generic;
 using Google.Protobuf;
 
 namespace Mediapipe.Tasks.Core
@@ -33,11 +34,48 @@ namespace Mediapipe.Tasks.Core
       return new TaskRunner(taskRunnerPtr);
     }
 
+    /// <param name="gpuResources">If it's <c>null</c>, the graph runs without GPU resources.</param>
+    /// <param name="executor">
+    ///   The default executor of the graph. If it's <c>null</c>, the graph creates its own thread pool.
+    ///   To run the calculators on the thread that calls <see cref="Process(PacketMap)" />, leave it <c>null</c>
+    ///   and add <c>executor { type: "ApplicationThreadExecutor" }</c> to <paramref name="config" /> instead.
+    /// </param>
+    public static TaskRunner Create(CalculatorGraphConfig config, GpuResources gpuResources, Executor executor, int callbackId = -1, NativePacketsCallback packetsCallback = null)
+    {
+      var bytes = config.ToByteArray();
+      var executorPtr = executor == null ? IntPtr.Zero : executor.sharedPtr;
+      IntPtr statusPtr;
+      IntPtr taskRunnerPtr;
+      if (gpuResources == null)
+      {
+        UnsafeNativeMethods.mp_tasks_core_TaskRunner_Create__PKc_i_PF_Pe(bytes, bytes.Length, callbackId, packetsCallback, executorPtr, out statusPtr, out taskRunnerPtr).Assert();
+      }
+      else
+      {
+        UnsafeNativeMethods.mp_tasks_core_TaskRunner_Create__PKc_i_PF_Pgr_Pe(bytes, bytes.Length, callbackId, packetsCallback, gpuResources.sharedPtr, executorPtr, out statusPtr, out taskRunnerPtr).Assert();
+      }
+      GC.KeepAlive(gpuResources);
+      GC.KeepAlive(executor);
+
+      AssertStatusOk(statusPtr);
+      return new TaskRunner(taskRunnerPtr);
+    }
+
+    /// <summary>
+    ///   The status that is overwritten by <see cref="Process(PacketMap, PacketMap)" /> and <see cref="Send(PacketMap, bool)" />.
+    /// </summary>
+    private IntPtr _reusableStatusPtr;
+
     private TaskRunner(IntPtr ptr) : base(ptr) { }
 
     protected override void DeleteMpPtr()
     {
       UnsafeNativeMethods.mp_tasks_core_TaskRunner__delete(ptr);
+      if (_reusableStatusPtr != IntPtr.Zero)
+      {
+        UnsafeNativeMethods.absl_Status__delete(_reusableStatusPtr);
+        _reusableStatusPtr = IntPtr.Zero;
+      }
     }
 
     public PacketMap Process(PacketMap inputs)
@@ -59,6 +97,46 @@ namespace Mediapipe.Tasks.Core
       AssertStatusOk(statusPtr);
     }
 
+    /// <summary>
+    ///   Same as <see cref="Process(PacketMap)" />, but the result is moved to <paramref name="outputs" /> instead of a new <see cref="PacketMap" />.
+    /// </summary>
+    /// <remarks>
+    ///   Neither <paramref name="inputs" /> nor <paramref name="outputs" /> is disposed, so you can keep using them across frames to avoid allocating them every time.
+    ///   The packets in <paramref name="inputs" /> are moved out, but the keys are kept with empty packets,
+    ///   so set the next packets by <see cref="PacketMap.InsertOrAssign{T}" /> instead of <see cref="PacketMap.Emplace{T}" />.
+    ///   The empty packets in <paramref name="inputs" /> are not sent to the graph.
+    /// </remarks>
+    public void Process(PacketMap inputs, PacketMap outputs)
+    {
+      var statusPtr = GetReusableStatusPtr();
+      UnsafeNativeMethods.mp_tasks_core_TaskRunner__Process__Ppm_Ppm_Ps(mpPtr, inputs.mpPtr, outputs.mpPtr, statusPtr).Assert();
+
+      GC.KeepAlive(inputs);
+      GC.KeepAlive(outputs);
+      GC.KeepAlive(this);
+      AssertReusableStatusOk(statusPtr);
+    }
+
+    /// <param name="reuseInputs">
+    ///   If <c>true</c>, <paramref name="inputs" /> is not disposed, and its packets are moved out as <see cref="Process(PacketMap, PacketMap)" /> does,
+    ///   so that it can be used for the next frame.
+    /// </param>
+    public void Send(PacketMap inputs, bool reuseInputs)
+    {
+      if (!reuseInputs)
+      {
+        Send(inputs);
+        return;
+      }
+
+      var statusPtr = GetReusableStatusPtr();
+      UnsafeNativeMethods.mp_tasks_core_TaskRunner__Send__Ppm_Ps(mpPtr, inputs.mpPtr, statusPtr).Assert();
+
+      GC.KeepAlive(inputs);
+      GC.KeepAlive(this);
+      AssertReusableStatusOk(statusPtr);
+    }
+
     public void Close()
     {
       UnsafeNativeMethods.mp_tasks_core_TaskRunner__Close(mpPtr, out var statusPtr).Assert();
@@ -75,6 +153,38 @@ namespace Mediapipe.Tasks.Core
       AssertStatusOk(statusPtr);
     }
 
+    private IntPtr GetReusableStatusPtr()
+    {
+      if (_reusableStatusPtr == IntPtr.Zero)
+      {
+        UnsafeNativeMethods.absl_Status__i_PKc((int)StatusCode.Ok, "", out _reusableStatusPtr).Assert();
+      }
+      return _reusableStatusPtr;
+    }
+
+    private static void AssertReusableStatusOk(IntPtr statusPtr)
+    {
+      if (!SafeNativeMethods.absl_Status__ok(statusPtr))
+      {
+        using (var status = new Status(statusPtr, false))
+        {
+          status.AssertOk();
+        }
+      }
+    }
+
+    /// <summary>
+    ///   Returns the startup phases recorded by <see cref="StartupProfiler" />.
+    /// </summary>
+    /// <returns>An empty list if <see cref="StartupProfiler" /> was disabled when the task runner was created.</returns>
+    public List<StartupPhase> GetStartupPhases()
+    {
+      UnsafeNativeMethods.mp_tasks_core_TaskRunner__GetStartupPhases(mpPtr, out var nativePhases).Assert();
+      GC.KeepAlive(this);
+
+      return StartupProfiler.Copy(nativePhases);
+    }
+
     public CalculatorGraphConfig GetGraphConfig(ExtensionRegistry extensionRegistry = null)
     {
       UnsafeNativeMethods.mp_tasks_core_TaskRunner__GetGraphConfig(mpPtr, out var serializedProto).Assert();
@@ -0,0 +1,88 @@
+// Copyright (c) 2026 homuler
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+using System.Runtime.InteropServices;
+
+namespace Mediapipe
+{
+  public sealed class BatchingInferenceStats
+  {
+    /// <summary>
+    ///   The upper bounds (exclusive) of the <see cref="latencyCounts" /> buckets except the last one, in microseconds.
+    /// </summary>
+    public static readonly long[] LatencyBucketUpperBoundsMicrosec = new long[] { 100, 200, 500, 1000, 2000, 5000, 10000, 20000, 50000, 100000, 200000 };
+
+    public readonly long requests;
+    public readonly long batches;
+    /// <summary>
+    ///   <c>batchSizeCounts[i]</c> is the number of the batches of size <c>i + 1</c>. The last bucket also counts the larger batches.
+    /// </summary>
+    public readonly long[] batchSizeCounts;
+    /// <summary>
+    ///   The histogram of the time from when a request is submitted until its result is ready.
+    /// </summary>
+    public readonly long[] latencyCounts;
+
+    internal unsafe BatchingInferenceStats(NativeBatchingInferenceStats stats)
+    {
+      requests = stats.requests;
+      batches = stats.batches;
+      batchSizeCounts = new long[NativeBatchingInferenceStats.BatchSizeHistogramSize];
+      for (var i = 0; i < batchSizeCounts.Length; i++)
+      {
+        batchSizeCounts[i] = stats.batchSizeCounts[i];
+      }
+      latencyCounts = new long[NativeBatchingInferenceStats.LatencyHistogramSize];
+      for (var i = 0; i < latencyCounts.Length; i++)
+      {
+        latencyCounts[i] = stats.latencyCounts[i];
+      }
+    }
+  }
+
+  [StructLayout(LayoutKind.Sequential)]
+  internal unsafe struct NativeBatchingInferenceStats
+  {
+    public const int BatchSizeHistogramSize = 16;
+    public const int LatencyHistogramSize = 12;
+
+    public long requests;
+    public long batches;
+    public fixed long batchSizeCounts[BatchSizeHistogramSize];
+    public fixed long latencyCounts[LatencyHistogramSize];
+  }
+
+  /// <summary>
+  ///   A process-wide service that runs the requests for the same model from multiple graphs together.
+  ///   The graphs use it through <c>BatchedInferenceCalculator</c> instead of <c>InferenceCalculator</c>.
+  /// </summary>
+  /// <remarks>
+  ///   The requests are collected until <c>maxBatchSize</c> requests arrive or the oldest one has waited for <c>maxWaitMicrosec</c>,
+  ///   and then they are run by one invocation. If the model cannot be resized to the batch size, they are run one by one.
+  /// </remarks>
+  public static class BatchingInferenceService
+  {
+    /// <summary>
+    ///   Sets the batching window, which is applied from the next batch. The default is 8 requests and 2 milliseconds.
+    /// </summary>
+    public static void Configure(int maxBatchSize, long maxWaitMicrosec)
+    {
+      UnsafeNativeMethods.mp_BatchingInferenceService__Configure__i_ll(maxBatchSize, maxWaitMicrosec, out var statusPtr).Assert();
+      Status.UnsafeAssertOk(statusPtr);
+    }
+
+    public static BatchingInferenceStats GetStats()
+    {
+      SafeNativeMethods.mp_BatchingInferenceService__GetStats(out var stats);
+      return new BatchingInferenceStats(stats);
+    }
+
+    public static void ResetStats()
+    {
+      SafeNativeMethods.mp_BatchingInferenceService__ResetStats();
+    }
+  }
+}
@@ -0,0 +1,98 @@
+// Copyright (c) 2026 homuler
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+using System.Collections.Generic;
+
+namespace Mediapipe
+{
+  public readonly struct CapiCallStats
+  {
+    /// <summary>
+    ///   The name of the C API function, e.g. <c>mp_CalculatorGraph__AddPacketToInputStream__PKc_Ppacket</c>.
+    ///   The functions implemented by a function template are also recorded by their own names, e.g. <c>mp_Packet__GetImageFrame</c>.
+    /// </summary>
+    public readonly string name;
+    public readonly long calls;
+    /// <summary>
+    ///   The total time spent in the function, in nanoseconds.
+    /// </summary>
+    public readonly long totalNs;
+
+    internal CapiCallStats(NativeCapiCallStats nativeStats)
+    {
+      name = nativeStats.name;
+      calls = nativeStats.calls;
+      totalNs = nativeStats.totalNs;
+    }
+
+    public override string ToString() => $"{{ name: \"{name}\", calls: {calls}, totalNs: {totalNs} }}";
+  }
+
+  /// <summary>
+  ///   Measures the calls to the C API of the native library.
+  ///   It works only if the library is built with the <c>--trace_capi</c> option.
+  /// </summary>
+  /// <remarks>
+  ///   The functions that can fail (i.e. the ones that return <see cref="MpReturnCode" />) are measured,
+  ///   and so are the accessors called per frame, e.g. <c>mp_Packet__IsEmpty</c> and <c>mp_ImageFrame__Width</c>.
+  ///   The other trivial accessors are not.
+  /// </remarks>
+  /// <example>
+  ///   <code>
+  ///     CapiTracer.ResetStats();
+  ///     CapiTracer.tracing = true;
+  ///     taskRunner.Process(inputs, outputs);
+  ///     CapiTracer.tracing = false;
+  ///     foreach (var stats in CapiTracer.GetStats().OrderByDescending((stats) => stats.totalNs))
+  ///     {
+  ///       Debug.Log(stats);
+  ///     }
+  ///     CapiTracer.WriteTrace(Path.Combine(Application.persistentDataPath, "capi_trace.json"));
+  ///   </code>
+  /// </example>
+  public static class CapiTracer
+  {
+    public static bool isEnabled => SafeNativeMethods.mp_CapiTracer__IsEnabled();
+
+    /// <summary>
+    ///   While it's <c>true</c>, the calls are also recorded to a ring buffer, which keeps the last 65536 calls.
+    ///   It's always <c>false</c> if the tracer is not enabled.
+    /// </summary>
+    public static bool tracing
+    {
+      get => SafeNativeMethods.mp_CapiTracer__tracing();
+      set => SafeNativeMethods.mp_CapiTracer__set_tracing__b(value);
+    }
+
+    /// <returns>
+    ///   The stats of the functions that have been called since the last <see cref="ResetStats" />, or an empty list if the tracer is not enabled.
+    /// </returns>
+    public static List<CapiCallStats> GetStats()
+    {
+      SafeNativeMethods.mp_CapiTracer__GetStats(out var nativeStatsArray);
+
+      var stats = new List<CapiCallStats>(nativeStatsArray.size);
+      foreach (var nativeStats in nativeStatsArray.AsReadOnlySpan())
+      {
+        stats.Add(new CapiCallStats(nativeStats));
+      }
+      nativeStatsArray.Dispose();
+      return stats;
+    }
+
+    public static void ResetStats() => SafeNativeMethods.mp_CapiTracer__ResetStats();
+
+    /// <summary>
+    ///   Writes the calls recorded while <see cref="tracing" /> to <paramref name="path" /> in the Chrome trace event format,
+    ///   which can be opened by Perfetto (https://ui.perfetto.dev).
+    /// </summary>
+    public static void WriteTrace(string path)
+    {
+      UnsafeNativeMethods.mp_CapiTracer__WriteTrace__PKc(path, out var statusPtr).Assert();
+      Status.UnsafeAssertOk(statusPtr);
+    }
+  }
+}
@@ -0,0 +1,198 @@
+// Copyright (c) 2026 homuler
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+using System;
+using System.Runtime.InteropServices;
+using Unity.Collections;
+using Unity.Collections.LowLevel.Unsafe;
+
+namespace Mediapipe
+{
+  public enum MaskEncoding
+  {
+    /// <summary>
+    ///   Each pixel is quantized and packed without padding.
+    /// </summary>
+    BitPacked = 0,
+    /// <summary>
+    ///   Each run of the quantized pixels is stored as a pair of the value and its length.
+    ///   It works best for masks with large uniform areas.
+    /// </summary>
+    RunLength = 1,
+  }
+
+  [StructLayout(LayoutKind.Sequential)]
+  public readonly struct MaskHeader
+  {
+    public readonly int width;
+    public readonly int height;
+    public readonly MaskEncoding encoding;
+    public readonly int bits;
+    /// <summary>
+    ///   If <c>true</c>, the decoded values are confidences scaled to [0, 255].
+    ///   Otherwise, they are categories.
+    /// </summary>
+    [MarshalAs(UnmanagedType.I1)]
+    public readonly bool isConfidence;
+    public readonly int payloadSize;
+  }
+
+  /// <summary>
+  ///   Compresses segmentation masks so that they can be passed to other consumers cheaply.
+  /// </summary>
+  public static class MaskCodec
+  {
+    /// <returns>
+    ///   The upper bound of the encoded size in bytes, or <c>-1</c> if the arguments are invalid.
+    /// </returns>
+    public static int GetMaxEncodedSize(int width, int height, MaskEncoding encoding, int bits)
+    {
+      return SafeNativeMethods.mp__GetMaxEncodedMaskSize__i_i_i_i(width, height, encoding, bits);
+    }
+
+    /// <summary>
+    ///   Encodes the confidence mask that <paramref name="packet"/> contains.
+    /// </summary>
+    /// <remarks>
+    ///   The packet must contain an <see cref="ImageFrame"/> or an <see cref="Image"/> on CPU, whose format is VEC32F1 or GRAY8.
+    ///   As in <see cref="ImageFrame.ExportMask(int, int, byte[], float)"/>, the confidences are in [0, 1] if it's VEC32F1, and in [0, 255] if it's GRAY8.
+    ///   To encode a category mask, use <see cref="EncodeCategory{T}(Packet{T}, MaskEncoding, int, byte[])"/>.
+    /// </remarks>
+    /// <param name="bits">
+    ///   The number of bits per pixel (1, 2, 4, or 8). The confidences are quantized to <c>2^bits</c> levels.
+    /// </param>
+    /// <param name="buffer">
+    ///   The buffer to write the encoded mask.
+    ///   It must have at least <see cref="GetMaxEncodedSize" /> bytes.
+    /// </param>
+    /// <returns>The number of bytes written.</returns>
+    public static int Encode<T>(Packet<T> packet, MaskEncoding encoding, int bits, byte[] buffer)
+    {
+      unsafe
+      {
+        fixed (byte* bufferPtr = buffer)
+        {
+          return Encode(packet, encoding, bits, false, (IntPtr)bufferPtr, buffer.Length);
+        }
+      }
+    }
+
+    /// <inheritdoc cref="Encode{T}(Packet{T}, MaskEncoding, int, byte[])"/>
+    public static int Encode<T>(Packet<T> packet, MaskEncoding encoding, int bits, NativeArray<byte> buffer)
+    {
+      unsafe
+      {
+        return Encode(packet, encoding, bits, false, (IntPtr)NativeArrayUnsafeUtility.GetUnsafePtr(buffer), buffer.Length);
+      }
+    }
+
+    /// <summary>
+    ///   Encodes the category mask that <paramref name="packet"/> contains.
+    /// </summary>
+    /// <remarks>
+    ///   The packet must contain an <see cref="ImageFrame"/> or an <see cref="Image"/> on CPU, whose format is GRAY8 or VEC32F1.
+    ///   As in <see cref="ImageFrame.ExportCategoryMask(int, int, UnityEngine.Color32[], byte[])"/>, each pixel is a category.
+    /// </remarks>
+    /// <param name="bits">
+    ///   The number of bits per pixel (1, 2, 4, or 8). The categories are clamped to <c>2^bits - 1</c>.
+    /// </param>
+    /// <param name="buffer">
+    ///   The buffer to write the encoded mask.
+    ///   It must have at least <see cref="GetMaxEncodedSize" /> bytes.
+    /// </param>
+    /// <returns>The number of bytes written.</returns>
+    public static int EncodeCategory<T>(Packet<T> packet, MaskEncoding encoding, int bits, byte[] buffer)
+    {
+      unsafe
+      {
+        fixed (byte* bufferPtr = buffer)
+        {
+          return Encode(packet, encoding, bits, true, (IntPtr)bufferPtr, buffer.Length);
+        }
+      }
+    }
+
+    /// <inheritdoc cref="EncodeCategory{T}(Packet{T}, MaskEncoding, int, byte[])"/>
+    public static int EncodeCategory<T>(Packet<T> packet, MaskEncoding encoding, int bits, NativeArray<byte> buffer)
+    {
+      unsafe
+      {
+        return Encode(packet, encoding, bits, true, (IntPtr)NativeArrayUnsafeUtility.GetUnsafePtr(buffer), buffer.Length);
+      }
+    }
+
+    public static MaskHeader ReadHeader(byte[] data, int size)
+    {
+      unsafe
+      {
+        fixed (byte* dataPtr = data)
+        {
+          UnsafeNativeMethods.mp__ReadMaskHeader__Pui8_i((IntPtr)dataPtr, Math.Min(size, data.Length), out var statusPtr, out var header).Assert();
+          Status.UnsafeAssertOk(statusPtr);
+          return header;
+        }
+      }
+    }
+
+    /// <summary>
+    ///   Decodes the mask encoded by <see cref="Encode{T}(Packet{T}, MaskEncoding, int, byte[])" /> or <see cref="EncodeCategory{T}(Packet{T}, MaskEncoding, int, byte[])" />.
+    /// </summary>
+    /// <param name="size">The size of the encoded mask.</param>
+    /// <param name="buffer">The buffer to write the decoded mask, which must have at least <c>width * height</c> bytes.</param>
+    public static void Decode(byte[] data, int size, byte[] buffer)
+    {
+      unsafe
+      {
+        fixed (byte* bufferPtr = buffer)
+        {
+          Decode(data, size, (IntPtr)bufferPtr, buffer.Length);
+        }
+      }
+    }
+
+    /// <inheritdoc cref="Decode(byte[], int, byte[])"/>
+    /// <remarks>
+    ///   <paramref name="buffer"/> can be the raw data of a <see cref="UnityEngine.Texture2D"/> whose format is R8 or Alpha8.
+    /// </remarks>
+    public static void Decode(byte[] data, int size, NativeArray<byte> buffer)
+    {
+      unsafe
+      {
+        Decode(data, size, (IntPtr)NativeArrayUnsafeUtility.GetUnsafePtr(buffer), buffer.Length);
+      }
+    }
+
+    private static int Encode<T>(Packet<T> packet, MaskEncoding encoding, int bits, bool isCategory, IntPtr buffer, int bufferSize)
+    {
+      IntPtr statusPtr;
+      int size;
+      if (isCategory)
+      {
+        UnsafeNativeMethods.mp_Packet__EncodeCategoryMask__i_i_Pui8_i(packet.mpPtr, encoding, bits, buffer, bufferSize, out statusPtr, out size).Assert();
+      }
+      else
+      {
+        UnsafeNativeMethods.mp_Packet__EncodeMask__i_i_Pui8_i(packet.mpPtr, encoding, bits, buffer, bufferSize, out statusPtr, out size).Assert();
+      }
+      GC.KeepAlive(packet);
+      Status.UnsafeAssertOk(statusPtr);
+
+      return size;
+    }
+
+    private static void Decode(byte[] data, int size, IntPtr buffer, int bufferSize)
+    {
+      unsafe
+      {
+        fixed (byte* dataPtr = data)
+        {
+          UnsafeNativeMethods.mp__DecodeMask__Pui8_i_Pui8_i((IntPtr)dataPtr, Math.Min(size, data.Length), buffer, bufferSize, out var statusPtr).Assert();
+          Status.UnsafeAssertOk(statusPtr);
+        }
+      }
+    }
+  }
+}
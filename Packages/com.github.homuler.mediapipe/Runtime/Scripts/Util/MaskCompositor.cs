@@ -0,0 +1,90 @@
+// Copyright (c) 2026 homuler
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+using System;
+using Unity.Collections;
+using Unity.Collections.LowLevel.Unsafe;
+using UnityEngine;
+
+namespace Mediapipe
+{
+  /// <summary>
+  ///   Blends images using segmentation masks in the native code (e.g. background replacement).
+  /// </summary>
+  /// <remarks>
+  ///   <list type="bullet">
+  ///     <item>
+  ///       <description>The foreground and the background must be SRGB or SRGBA with the same size.</description>
+  ///     </item>
+  ///     <item>
+  ///       <description>The mask packet must contain an <see cref="ImageFrame"/> or an <see cref="Image"/> on CPU (VEC32F1 or GRAY8), which is resized to the size of the foreground.</description>
+  ///     </item>
+  ///     <item>
+  ///       <description>The result has the same format as the foreground, and is written to the buffer without row padding.</description>
+  ///     </item>
+  ///   </list>
+  /// </remarks>
+  public static class MaskCompositor
+  {
+    /// <param name="featherRadius">The radius of the box filter applied to the mask. 0 disables feathering.</param>
+    /// <param name="invert">If <c>true</c>, the background is drawn where the mask is set.</param>
+    public static void Composite<T>(ImageFrame foreground, Packet<T> mask, ImageFrame background, byte[] buffer, int featherRadius = 0, bool invert = false)
+    {
+      unsafe
+      {
+        fixed (byte* bufferPtr = buffer)
+        {
+          Composite(foreground, mask, background.mpPtr, 0, featherRadius, invert, (IntPtr)bufferPtr, buffer.Length);
+        }
+      }
+      GC.KeepAlive(background);
+    }
+
+    /// <inheritdoc cref="Composite{T}(ImageFrame, Packet{T}, ImageFrame, byte[], int, bool)"/>
+    public static void Composite<T>(ImageFrame foreground, Packet<T> mask, ImageFrame background, NativeArray<byte> buffer, int featherRadius = 0, bool invert = false)
+    {
+      unsafe
+      {
+        Composite(foreground, mask, background.mpPtr, 0, featherRadius, invert, (IntPtr)NativeArrayUnsafeUtility.GetUnsafePtr(buffer), buffer.Length);
+      }
+      GC.KeepAlive(background);
+    }
+
+    /// <inheritdoc cref="Composite{T}(ImageFrame, Packet{T}, ImageFrame, byte[], int, bool)"/>
+    /// <param name="backgroundColor">The color to fill the background with.</param>
+    public static void Composite<T>(ImageFrame foreground, Packet<T> mask, Color32 backgroundColor, byte[] buffer, int featherRadius = 0, bool invert = false)
+    {
+      unsafe
+      {
+        fixed (byte* bufferPtr = buffer)
+        {
+          Composite(foreground, mask, IntPtr.Zero, ToRgba(backgroundColor), featherRadius, invert, (IntPtr)bufferPtr, buffer.Length);
+        }
+      }
+    }
+
+    /// <inheritdoc cref="Composite{T}(ImageFrame, Packet{T}, Color32, byte[], int, bool)"/>
+    public static void Composite<T>(ImageFrame foreground, Packet<T> mask, Color32 backgroundColor, NativeArray<byte> buffer, int featherRadius = 0, bool invert = false)
+    {
+      unsafe
+      {
+        Composite(foreground, mask, IntPtr.Zero, ToRgba(backgroundColor), featherRadius, invert, (IntPtr)NativeArrayUnsafeUtility.GetUnsafePtr(buffer), buffer.Length);
+      }
+    }
+
+    private static void Composite<T>(ImageFrame foreground, Packet<T> mask, IntPtr background, uint backgroundColor, int featherRadius, bool invert, IntPtr buffer, int bufferSize)
+    {
+      UnsafeNativeMethods.mp__CompositeMask__Pif_Pif_Ppacket_ui_i_b_Pui8_i(foreground.mpPtr, background, mask.mpPtr, backgroundColor, featherRadius, invert, buffer, bufferSize, out var statusPtr).Assert();
+      GC.KeepAlive(foreground);
+      GC.KeepAlive(mask);
+
+      Status.UnsafeAssertOk(statusPtr);
+    }
+
+    // The native code reads the color as RGBA bytes in memory order.
+    private static uint ToRgba(Color32 color) => (uint)(color.r | (color.g << 8) | (color.b << 16) | (color.a << 24));
+  }
+}
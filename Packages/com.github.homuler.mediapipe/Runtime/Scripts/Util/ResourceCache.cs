@@ -0,0 +1,107 @@
+// Copyright (c) 2026 homuler
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+using System.Runtime.InteropServices;
+
+namespace Mediapipe
+{
+  [StructLayout(LayoutKind.Sequential)]
+  public readonly struct ResourceCacheStats
+  {
+    /// <summary>
+    ///   The number of the resources found in the cache, including the ones waited for while they were prefetched.
+    /// </summary>
+    public readonly long hits;
+    /// <summary>
+    ///   The number of the resources read synchronously because they were not prefetched.
+    /// </summary>
+    public readonly long misses;
+    /// <summary>
+    ///   The number of the resources read by <see cref="ResourceCache.Prefetch" />.
+    /// </summary>
+    public readonly long prefetched;
+    /// <summary>
+    ///   The number of the resources evicted to keep the cache within the capacity.
+    /// </summary>
+    public readonly long evictions;
+    /// <summary>
+    ///   The number of the path resolutions answered without calling the managed path resolver.
+    /// </summary>
+    public readonly long resolvedPathHits;
+    /// <summary>
+    ///   The number of the resources currently in the cache.
+    /// </summary>
+    public readonly long entries;
+    /// <summary>
+    ///   The total size of the resources currently in the cache.
+    /// </summary>
+    public readonly long bytes;
+  }
+
+  /// <summary>
+  ///   A process-wide LRU cache in front of the resource provider set by <see cref="ResourceUtil.EnableCustomResolver" />.
+  /// </summary>
+  /// <remarks>
+  ///   <para>
+  ///     The resources read by <see cref="Prefetch" /> are kept in the native memory, and the paths resolved by the path resolver are memoized,
+  ///     so that the graphs initialized later don't call back into the managed code for them.
+  ///     The resources that are not prefetched are read synchronously and not cached, so that they are not copied while they are loaded.
+  ///   </para>
+  ///   <para>
+  ///     The assets served by <see cref="ResourceUtil.SetAssetBundle(string, long, long)" /> or <see cref="ResourceUtil.EnableMemoryMapping" />
+  ///     are not cached, because they are not read through the managed memory.
+  ///   </para>
+  /// </remarks>
+  public static class ResourceCache
+  {
+    /// <summary>
+    ///   The maximum total size of the cached resources in bytes.
+    ///   It's 0 by default, which means the cache is disabled. Setting it to 0 clears the cache.
+    /// </summary>
+    public static long capacity
+    {
+      get => SafeNativeMethods.mp_ResourceCache__capacity();
+      set => SafeNativeMethods.mp_ResourceCache__set_capacity__ll(value);
+    }
+
+    /// <summary>
+    ///   Starts reading the assets on background threads, and returns immediately.
+    /// </summary>
+    /// <remarks>
+    ///   The graph that requests an asset being prefetched waits for it instead of reading it again.
+    ///   If an asset fails to be read, it's read again when it's requested.
+    /// </remarks>
+    /// <param name="assetPaths">
+    ///   The paths requested by MediaPipe (e.g. <c>mediapipe/modules/face_detection/face_detection_short_range.tflite</c>) or the asset names,
+    ///   which are resolved by the path resolver before this method returns.
+    /// </param>
+    /// <exception cref="BadStatusException">
+    ///   Thrown if the cache is disabled, <see cref="ResourceUtil.EnableCustomResolver" /> is not called, or an asset path cannot be resolved
+    /// </exception>
+    public static void Prefetch(params string[] assetPaths)
+    {
+      UnsafeNativeMethods.mp_ResourceCache__Prefetch__PPKc_i(assetPaths, assetPaths.Length, out var statusPtr).Assert();
+      Status.UnsafeAssertOk(statusPtr);
+    }
+
+    /// <summary>
+    ///   Removes the cached resources and the memoized paths.
+    /// </summary>
+    public static void Clear() => SafeNativeMethods.mp_ResourceCache__Clear();
+
+    /// <summary>
+    ///   Removes only the memoized paths.
+    ///   It's called by <see cref="ResourceUtil" /> when the asset paths are changed.
+    /// </summary>
+    public static void ClearResolvedPaths() => SafeNativeMethods.mp_ResourceCache__ClearResolvedPaths();
+
+    public static ResourceCacheStats GetStats()
+    {
+      SafeNativeMethods.mp_ResourceCache__GetStats(out var stats);
+      return stats;
+    }
+  }
+}
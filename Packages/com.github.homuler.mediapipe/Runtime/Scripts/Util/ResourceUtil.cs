@@ -7,6 +7,7 @@
 using System;
 using System.Collections.Generic;
 using System.IO;
+using System.Runtime.InteropServices;
 
 namespace Mediapipe
 {
@@ -14,11 +15,42 @@ namespace Mediapipe
   {
     internal delegate string PathResolver(string path);
     internal delegate bool NativeResourceProvider(string path, IntPtr dest);
+    internal delegate bool NativeResourceLocator(string path, out ResourceLocation location);
+
+    [StructLayout(LayoutKind.Sequential)]
+    internal struct ResourceLocation
+    {
+      /// <remarks>
+      ///   A UTF-8 string allocated by <see cref="Marshal.AllocHGlobal(int)" />, and freed by the native code. If it's zero, <see cref="fd" /> is used.
+      /// </remarks>
+      public IntPtr path;
+      public int fd;
+      public long offset;
+      public long length;
+    }
+
+    private readonly struct AssetLocation
+    {
+      public readonly string filePath;
+      public readonly int fd;
+      public readonly long offset;
+      public readonly long length;
+
+      public AssetLocation(string filePath, int fd, long offset, long length)
+      {
+        this.filePath = filePath;
+        this.fd = fd;
+        this.offset = offset;
+        this.length = length;
+      }
+    }
 
     private static readonly string _TAG = nameof(ResourceUtil);
 
     private static bool _IsInitialized;
+    private static bool _IsMemoryMappingEnabled;
     private static readonly Dictionary<string, string> _AssetPathMap = new Dictionary<string, string>();
+    private static readonly Dictionary<string, AssetLocation> _AssetLocationMap = new Dictionary<string, AssetLocation>();
 
     public static void EnableCustomResolver()
     {
@@ -31,6 +63,104 @@ namespace Mediapipe
       _IsInitialized = true;
     }
 
+    /// <summary>
+    ///   Makes MediaPipe memory-map the registered assets instead of reading them through the managed memory.
+    /// </summary>
+    /// <remarks>
+    ///   <para>
+    ///     The mappings are shared by the graphs, and the model assets in <c>ExternalFile</c> are passed to TFLite without being copied,
+    ///     so both the resident memory and the startup I/O decrease.
+    ///   </para>
+    ///   <para>
+    ///     The assets registered by <see cref="SetAssetLocation(string, string, long, long)" /> or <see cref="SetAssetPath" /> are mapped.
+    ///     The others are still read by the resource provider set by <see cref="EnableCustomResolver" />.
+    ///   </para>
+    /// </remarks>
+    public static void EnableMemoryMapping()
+    {
+      if (_IsMemoryMappingEnabled)
+      {
+        return;
+      }
+      SafeNativeMethods.mp__SetCustomGlobalResourceLocator__P(LocateResource);
+      _IsMemoryMappingEnabled = true;
+    }
+
+    /// <summary>
+    ///   Serves the assets in the bundle built by <c>//mediapipe_api:mediapipe_asset_bundle</c> (or <c>build.py build --resources_bundle</c>).
+    /// </summary>
+    /// <remarks>
+    ///   <para>
+    ///     The bundle is memory-mapped once, and the assets are looked up by their names (e.g. <c>face_detection_short_range.tflite</c>)
+    ///     without any file system calls or managed callbacks.
+    ///     The assets that are not in the bundle are still resolved by the other callbacks.
+    ///   </para>
+    ///   <para>
+    ///     The bundle should start at an offset aligned to 64 bytes. Otherwise, the uncompressed assets are copied onto the heap when they are read.
+    ///     The assets whose file paths are required are extracted to the directory set by <see cref="SetAssetBundleExtractionDirectory" />.
+    ///   </para>
+    ///   <para>
+    ///     It replaces the bundle set before.
+    ///   </para>
+    /// </remarks>
+    /// <param name="filePath">The path of the file that contains the bundle</param>
+    /// <param name="offset">The offset of the bundle in the file</param>
+    /// <param name="length">The length of the bundle. If it's negative, the bundle spans to the end of the file.</param>
+    /// <exception cref="BadStatusException">Thrown if the bundle cannot be opened or is corrupted</exception>
+    public static void SetAssetBundle(string filePath, long offset = 0, long length = -1)
+    {
+      UnsafeNativeMethods.mp__SetCustomGlobalAssetBundle__PKc_ll_ll(filePath, offset, length, out var statusPtr).Assert();
+      Status.UnsafeAssertOk(statusPtr);
+    }
+
+    /// <summary>
+    ///   Serves the assets in the bundle in an open file (e.g. an uncompressed asset in the APK, see <see cref="SetAssetLocation(string, int, long, long)" />).
+    /// </summary>
+    /// <remarks>
+    ///   <paramref name="fd" /> can be closed after this method returns.
+    /// </remarks>
+    /// <exception cref="BadStatusException">Thrown if the bundle cannot be opened or is corrupted</exception>
+    public static void SetAssetBundle(int fd, long offset, long length)
+    {
+      UnsafeNativeMethods.mp__SetCustomGlobalAssetBundle__i_ll_ll(fd, offset, length, out var statusPtr).Assert();
+      Status.UnsafeAssertOk(statusPtr);
+    }
+
+    /// <summary>
+    ///   Stops serving the assets in the bundle. The assets already loaded are still valid.
+    /// </summary>
+    public static void ClearAssetBundle() => SafeNativeMethods.mp__ClearCustomGlobalAssetBundle();
+
+    /// <summary>
+    ///   Sets the directory to which the assets in the bundle are extracted when their file paths are required.
+    /// </summary>
+    /// <remarks>
+    ///   The extracted files are named after the fingerprints of their contents, so they are reused until the assets are changed.
+    ///   By default, they are extracted to the temporary directory, which may not exist (e.g. on Android, use <c>Application.temporaryCachePath</c>).
+    /// </remarks>
+    public static void SetAssetBundleExtractionDirectory(string directory) => SafeNativeMethods.mp__SetAssetBundleExtractionDirectory__PKc(directory);
+
+    /// <summary>
+    ///   Registers a range of a file as the asset, which is memory-mapped if <see cref="EnableMemoryMapping" /> is called.
+    /// </summary>
+    /// <param name="assetKey">See <see cref="SetAssetPath" /></param>
+    /// <param name="filePath">The path of the file that contains the asset (e.g. an uncompressed archive)</param>
+    /// <param name="offset">The offset of the asset in the file</param>
+    /// <param name="length">The length of the asset. If it's negative, the asset spans to the end of the file.</param>
+    public static void SetAssetLocation(string assetKey, string filePath, long offset = 0, long length = -1)
+      => _AssetLocationMap[assetKey] = new AssetLocation(filePath, -1, offset, length);
+
+    /// <summary>
+    ///   Registers a range of an open file as the asset, which is memory-mapped if <see cref="EnableMemoryMapping" /> is called.
+    /// </summary>
+    /// <remarks>
+    ///   On Android, an uncompressed asset in the APK can be registered without being extracted,
+    ///   using the values of <c>AssetFileDescriptor</c> (<c>getParcelFileDescriptor().getFd()</c>, <c>getStartOffset()</c> and <c>getLength()</c>).
+    ///   <paramref name="fd" /> must be kept open while the asset can be requested.
+    /// </remarks>
+    public static void SetAssetLocation(string assetKey, int fd, long offset, long length)
+      => _AssetLocationMap[assetKey] = new AssetLocation(null, fd, offset, length);
+
     /// <summary>
     ///   Registers the asset path to the resource manager.
     /// </summary>
@@ -42,7 +172,11 @@ namespace Mediapipe
     /// <param name="assetPath">
     ///   The file path of the asset.
     /// </param>
-    public static void SetAssetPath(string assetKey, string assetPath) => _AssetPathMap[assetKey] = assetPath;
+    public static void SetAssetPath(string assetKey, string assetPath)
+    {
+      _AssetPathMap[assetKey] = assetPath;
+      ResourceCache.ClearResolvedPaths();
+    }
 
     /// <summary>
     ///   Registers the asset path to the resource manager.
@@ -58,13 +192,22 @@ namespace Mediapipe
     /// <param name="assetPath">
     ///   The file path of the asset.
     /// </param>
-    public static void AddAssetPath(string assetKey, string assetPath) => _AssetPathMap.Add(assetKey, assetPath);
+    public static void AddAssetPath(string assetKey, string assetPath)
+    {
+      _AssetPathMap.Add(assetKey, assetPath);
+      ResourceCache.ClearResolvedPaths();
+    }
 
     /// <summary>
     ///   Removes the asset key from the resource manager.
     /// </summary>
     /// <param name="assetKey"></param>
-    public static bool RemoveAssetPath(string assetKey) => _AssetPathMap.Remove(assetKey);
+    public static bool RemoveAssetPath(string assetKey)
+    {
+      var removed = _AssetPathMap.Remove(assetKey) | _AssetLocationMap.Remove(assetKey);
+      ResourceCache.ClearResolvedPaths();
+      return removed;
+    }
 
     public static bool TryGetFilePath(string assetPath, out string filePath)
     {
@@ -129,6 +272,52 @@ namespace Mediapipe
       }
     }
 
+    [AOT.MonoPInvokeCallback(typeof(NativeResourceLocator))]
+    private static bool LocateResource(string path, out ResourceLocation location)
+    {
+      location = new ResourceLocation { path = IntPtr.Zero, fd = -1, offset = 0, length = -1 };
+      try
+      {
+        Logger.LogDebug(_TAG, $"{path} is requested to be mapped");
+
+        if (_AssetLocationMap.TryGetValue(path, out var assetLocation) || _AssetLocationMap.TryGetValue(GetAssetNameFromPath(path), out assetLocation))
+        {
+          location.fd = assetLocation.fd;
+          location.offset = assetLocation.offset;
+          location.length = assetLocation.length;
+          if (assetLocation.filePath != null)
+          {
+            location.path = StringToHGlobalUTF8(assetLocation.filePath);
+          }
+          return true;
+        }
+        if (TryGetFilePath(path, out var filePath))
+        {
+          location.path = StringToHGlobalUTF8(filePath);
+          return true;
+        }
+        // fall back to the resource provider
+        return false;
+      }
+      catch (Exception e)
+      {
+        Logger.LogException(e);
+        return false;
+      }
+    }
+
+    /// <remarks>
+    ///   Unlike <see cref="Marshal.StringToHGlobalAnsi" />, it doesn't break the non-ASCII characters, which the native code expects in UTF-8.
+    /// </remarks>
+    private static IntPtr StringToHGlobalUTF8(string str)
+    {
+      var bytes = System.Text.Encoding.UTF8.GetBytes(str);
+      var ptr = Marshal.AllocHGlobal(bytes.Length + 1);
+      Marshal.Copy(bytes, 0, ptr, bytes.Length);
+      Marshal.WriteByte(ptr, bytes.Length, 0);
+      return ptr;
+    }
+
     private static string GetAssetNameFromPath(string assetPath)
     {
       var assetName = Path.GetFileNameWithoutExtension(assetPath);
@@ -0,0 +1,78 @@
+// Copyright (c) 2026 homuler
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+using System.Runtime.InteropServices;
+
+namespace Mediapipe
+{
+  [StructLayout(LayoutKind.Sequential)]
+  public readonly struct SsdAnchorsCacheStats
+  {
+    /// <summary>
+    ///   The number of the anchors found in memory.
+    /// </summary>
+    public readonly long hits;
+    /// <summary>
+    ///   The number of the anchors loaded from the persistent directory.
+    /// </summary>
+    public readonly long diskHits;
+    /// <summary>
+    ///   The number of the anchors generated by <c>SsdAnchorsCalculator</c>.
+    /// </summary>
+    public readonly long misses;
+    /// <summary>
+    ///   The number of the anchors currently in memory.
+    /// </summary>
+    public readonly long entries;
+  }
+
+  /// <summary>
+  ///   A process-wide cache of the SSD anchors used by the detection graphs, keyed by the <see cref="SsdAnchorsCalculatorOptions" />.
+  /// </summary>
+  /// <remarks>
+  ///   <para>
+  ///     It's used by <c>CachedSsdAnchorsCalculator</c>, which is a drop-in replacement of <c>SsdAnchorsCalculator</c>.
+  ///   </para>
+  ///   <para>
+  ///     When <see cref="ExpandedConfigCache" /> is enabled, <c>SsdAnchorsCalculator</c> in the expanded subgraphs (e.g. face, hand and pose detection)
+  ///     is replaced with <c>CachedSsdAnchorsCalculator</c>.
+  ///   </para>
+  /// </remarks>
+  public static class SsdAnchorsCache
+  {
+    /// <summary>
+    ///   It's <c>false</c> by default. <c>CachedSsdAnchorsCalculator</c> uses the cache regardless of this value.
+    /// </summary>
+    public static bool enabled
+    {
+      get => SafeNativeMethods.mp_SsdAnchorsCache__enabled();
+      set => SafeNativeMethods.mp_SsdAnchorsCache__set_enabled__b(value);
+    }
+
+    /// <summary>
+    ///   Persists the anchors to <paramref name="directory" />, so that they are not generated again after the application restarts.
+    /// </summary>
+    /// <remarks>
+    ///   The anchors persisted by another build of the native library are ignored, and generated again.
+    /// </remarks>
+    /// <param name="directory">
+    ///   An existing directory (e.g. under <c>Application.temporaryCachePath</c>).
+    ///   If it's <c>null</c> or empty, the anchors are not persisted.
+    /// </param>
+    public static void SetDirectory(string directory) => UnsafeNativeMethods.mp_SsdAnchorsCache__SetDirectory__PKc(directory ?? "");
+
+    /// <summary>
+    ///   Removes the anchors in memory. The persisted ones are not removed.
+    /// </summary>
+    public static void Clear() => SafeNativeMethods.mp_SsdAnchorsCache__Clear();
+
+    public static SsdAnchorsCacheStats GetStats()
+    {
+      SafeNativeMethods.mp_SsdAnchorsCache__GetStats(out var stats);
+      return stats;
+    }
+  }
+}
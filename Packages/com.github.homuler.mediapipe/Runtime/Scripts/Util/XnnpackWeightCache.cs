@@ -0,0 +1,65 @@
+// Copyright (c) 2026 homuler
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+using System.Runtime.InteropServices;
+
+namespace Mediapipe
+{
+  [StructLayout(LayoutKind.Sequential)]
+  public readonly struct XnnpackWeightCacheStats
+  {
+    /// <summary>
+    ///   The number of the interpreters whose packed weights were loaded from a complete cache file.
+    /// </summary>
+    public readonly long hits;
+    /// <summary>
+    ///   The number of the interpreters whose weights were packed and written to the cache file.
+    /// </summary>
+    public readonly long misses;
+    /// <summary>
+    ///   The total size of the packed weights loaded from the cache files instead of being packed again.
+    /// </summary>
+    public readonly long bytesSaved;
+  }
+
+  /// <summary>
+  ///   Persists the weights packed by XNNPACK, so that the models are not packed again after the application restarts.
+  /// </summary>
+  /// <remarks>
+  ///   <para>
+  ///     It's applied only to the interpreters created by <see cref="BatchingInferenceService" /> (i.e. <c>BatchedInferenceCalculator</c>).
+  ///     It has no effect on the stock <c>InferenceCalculator</c>, which creates the XNNPACK delegate from its own options.
+  ///   </para>
+  ///   <para>
+  ///     The cache files are keyed by the fingerprint of the model and the CPU features, and are memory-mapped when they are loaded.
+  ///   </para>
+  /// </remarks>
+  public static class XnnpackWeightCache
+  {
+    /// <summary>
+    ///   Sets the directory of the cache files, which is disabled by default.
+    /// </summary>
+    /// <param name="directory">
+    ///   An existing directory that is specific to the plugin version (e.g. under <c>Application.temporaryCachePath</c>),
+    ///   because the layout of the packed weights depends on the XNNPACK version.
+    ///   If it's <c>null</c> or empty, the cache is disabled.
+    /// </param>
+    /// <exception cref="BadStatusException">Thrown if <paramref name="directory" /> does not exist</exception>
+    public static void SetDirectory(string directory)
+    {
+      UnsafeNativeMethods.mp_XnnpackWeightCache__SetDirectory__PKc(directory ?? "", out var statusPtr).Assert();
+      Status.UnsafeAssertOk(statusPtr);
+    }
+
+    public static XnnpackWeightCacheStats GetStats()
+    {
+      SafeNativeMethods.mp_XnnpackWeightCache__GetStats(out var stats);
+      return stats;
+    }
+
+    public static void ResetStats() => SafeNativeMethods.mp_XnnpackWeightCache__ResetStats();
+  }
+}
@@ -4,6 +4,8 @@
 // license that can be found in the LICENSE file or at
 // https://opensource.org/licenses/MIT.
 
+using System;
+using System.Threading;
 using NUnit.Framework;
 
 namespace Mediapipe.Tests
@@ -24,6 +26,8 @@ input_stream: ""in""
 output_stream: ""out""
 ";
 
+    private static int _OutputCount;
+
     #region Constructor
     [Test]
     public void Ctor_ShouldInstantiateCalculatorGraph_When_CalledWithNoArguments()
@@ -128,6 +132,66 @@ output_stream: ""out""
     }
     #endregion
 
+    #region #SetExecutor
+    [Test]
+    public void SetExecutor_ShouldThrowException_When_GraphIsInitialized()
+    {
+      using (var executor = ThreadPoolExecutor.Create(1))
+      using (var graph = new CalculatorGraph(_ValidConfigText))
+      {
+#pragma warning disable IDE0058
+        Assert.Throws<BadStatusException>(() => graph.SetExecutor("", executor));
+#pragma warning restore IDE0058
+      }
+    }
+
+    [Test]
+    public void SetExecutor_ShouldShareExecutor_When_CalledBeforeInitialize()
+    {
+      using (var executor = ThreadPoolExecutor.Create(2))
+      using (var graph1 = new CalculatorGraph())
+      using (var graph2 = new CalculatorGraph())
+      {
+        foreach (var graph in new[] { graph1, graph2 })
+        {
+          graph.SetExecutor("", executor);
+          graph.Initialize(CalculatorGraphConfig.Parser.ParseFromTextFormat(_ValidConfigText));
+          graph.StartRun();
+        }
+        foreach (var graph in new[] { graph1, graph2 })
+        {
+          graph.CloseAllPacketSources();
+          graph.WaitUntilDone();
+          Assert.False(graph.HasError());
+        }
+      }
+    }
+
+    [Test]
+    public void WaitUntilIdle_ShouldRunCalculatorsOnCallingThread_When_ApplicationThreadExecutorIsSet()
+    {
+      var config = CalculatorGraphConfig.Parser.ParseFromTextFormat(_ValidConfigText);
+      config.Executor.Add(new ExecutorConfig() { Type = "ApplicationThreadExecutor" });
+
+      using (var graph = new CalculatorGraph(config))
+      {
+        using var poller = graph.AddOutputStreamPoller<string>("out");
+        graph.StartRun();
+
+        graph.AddPacketToInputStream("in", Packet.CreateStringAt("1", 0));
+        // NOTE: the calculators don't run until the application thread waits for the graph.
+        Assert.AreEqual(0, poller.QueueSize());
+
+        graph.WaitUntilIdle();
+        Assert.AreEqual(1, poller.QueueSize());
+
+        graph.CloseAllPacketSources();
+        graph.WaitUntilDone();
+        Assert.False(graph.HasError());
+      }
+    }
+    #endregion
+
     #region lifecycle
     [Test]
     public void LifecycleMethods_ShouldControlGraphLifeCycle()
@@ -145,6 +209,26 @@ output_stream: ""out""
       }
     }
 
+    [Test]
+    public void Reset_ShouldStartNewRun_When_TimestampsAreReset()
+    {
+      _OutputCount = 0;
+
+      using (var graph = new CalculatorGraph(_ValidConfigText))
+      {
+        graph.ObserveOutputStream("out", 0, CountOutputs);
+        graph.StartRun();
+        graph.AddPacketToInputStream("in", Packet.CreateIntAt(1, 1));
+        graph.Reset();
+
+        graph.AddPacketToInputStream("in", Packet.CreateIntAt(1, 1));
+        graph.CloseAllPacketSources();
+        graph.WaitUntilDone();
+
+        Assert.AreEqual(2, _OutputCount);
+      }
+    }
+
     [Test]
     public void Cancel_ShouldCancelGraph()
     {
@@ -157,5 +241,12 @@ output_stream: ""out""
       }
     }
     #endregion
+
+    [AOT.MonoPInvokeCallback(typeof(CalculatorGraph.NativePacketCallback))]
+    private static StatusArgs CountOutputs(IntPtr graphPtr, int streamId, IntPtr packetPtr)
+    {
+      _ = Interlocked.Increment(ref _OutputCount);
+      return StatusArgs.Ok();
+    }
   }
 }
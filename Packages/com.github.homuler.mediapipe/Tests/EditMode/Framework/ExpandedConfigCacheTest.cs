@@ -0,0 +1,100 @@
+// Copyright (c) 2026 homuler
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+using System.IO;
+using NUnit.Framework;
+
+namespace Mediapipe.Tests
+{
+  public class ExpandedConfigCacheTest
+  {
+    private const string _FaceDetectionShortRangeConfigText = @"
+input_stream: ""image""
+input_stream: ""roi""
+
+node {
+  calculator: ""FaceDetectionShortRange""
+  input_stream: ""IMAGE:image""
+  input_stream: ""ROI:roi""
+  output_stream: ""DETECTIONS:detections""
+}
+";
+
+    [SetUp]
+    public void SetUp()
+    {
+      ExpandedConfigCache.enabled = true;
+      ExpandedConfigCache.Clear();
+    }
+
+    [TearDown]
+    public void TearDown()
+    {
+      ExpandedConfigCache.enabled = false;
+      ExpandedConfigCache.SetDirectory(null);
+      ExpandedConfigCache.Clear();
+    }
+
+    [Test]
+    public void Initialize_ShouldReuseExpandedConfig_When_TheSameConfigIsUsedAgain()
+    {
+      var config = CalculatorGraphConfig.Parser.ParseFromTextFormat(_FaceDetectionShortRangeConfigText);
+      var before = ExpandedConfigCache.GetStats();
+
+      using (var graph1 = new CalculatorGraph(config))
+      using (var graph2 = new CalculatorGraph(config))
+      {
+        var after = ExpandedConfigCache.GetStats();
+        Assert.AreEqual(before.misses + 1, after.misses);
+        Assert.AreEqual(before.hits + 1, after.hits);
+        Assert.AreEqual(graph1.Config(), graph2.Config());
+      }
+    }
+
+    [Test]
+    public void Initialize_ShouldReturnTheSameConfig_As_WhenDisabled()
+    {
+      var config = CalculatorGraphConfig.Parser.ParseFromTextFormat(_FaceDetectionShortRangeConfigText);
+
+      using (var cachedConfig = new ValidatedGraphConfig())
+      using (var uncachedConfig = new ValidatedGraphConfig())
+      {
+        cachedConfig.Initialize(config);
+        cachedConfig.Initialize(config);
+        ExpandedConfigCache.enabled = false;
+        uncachedConfig.Initialize(config);
+
+        Assert.AreEqual(uncachedConfig.Config(), cachedConfig.Config());
+      }
+    }
+
+    [Test]
+    public void Initialize_ShouldLoadExpandedConfigFromDirectory_When_ItIsPersisted()
+    {
+      var directory = Path.Combine(Path.GetTempPath(), Path.GetRandomFileName());
+      _ = Directory.CreateDirectory(directory);
+      try
+      {
+        ExpandedConfigCache.SetDirectory(directory);
+        var config = CalculatorGraphConfig.Parser.ParseFromTextFormat(_FaceDetectionShortRangeConfigText);
+
+        using (var graph = new CalculatorGraph(config)) { }
+        Assert.AreEqual(1, Directory.GetFiles(directory).Length);
+
+        ExpandedConfigCache.Clear();
+        var before = ExpandedConfigCache.GetStats();
+        using (var graph = new CalculatorGraph(config))
+        {
+          Assert.AreEqual(before.diskHits + 1, ExpandedConfigCache.GetStats().diskHits);
+        }
+      }
+      finally
+      {
+        Directory.Delete(directory, true);
+      }
+    }
+  }
+}
@@ -252,5 +252,89 @@ namespace Mediapipe.Tests
       }
     }
     #endregion
+
+    #region ExportMask
+    [Test]
+    public void ExportMask_ShouldScaleConfidenceToByte()
+    {
+      using (var imageFrame = BuildMask(4, 1, new float[] { 0.0f, 0.25f, 0.5f, 1.0f }))
+      {
+        var buffer = new byte[4];
+        imageFrame.ExportMask(4, 1, buffer);
+
+        Assert.AreEqual(new byte[] { 0, 64, 128, 255 }, buffer);
+      }
+    }
+
+    [Test]
+    public void ExportMask_ShouldBinarizeConfidence_When_ThresholdIsSpecified()
+    {
+      using (var imageFrame = BuildMask(4, 1, new float[] { 0.1f, 0.4f, 0.5f, 0.9f }))
+      {
+        var buffer = new byte[4];
+        imageFrame.ExportMask(4, 1, buffer, 0.5f);
+
+        Assert.AreEqual(new byte[] { 0, 0, 255, 255 }, buffer);
+      }
+    }
+
+    [Test]
+    public void ExportMask_ShouldResizeMask()
+    {
+      using (var imageFrame = BuildMask(3, 3, Enumerable.Repeat(0.5f, 9).ToArray()))
+      {
+        var buffer = new NativeArray<byte>(35, Allocator.Temp);
+        imageFrame.ExportMask(7, 5, buffer);
+
+        Assert.True(buffer.All((x) => x == 128));
+        buffer.Dispose();
+      }
+    }
+
+    [Test]
+    public void ExportMask_ShouldThrowBadStatusException_When_BufferSizeIsTooSmall()
+    {
+      using (var imageFrame = BuildMask(3, 3, new float[9]))
+      {
+#pragma warning disable IDE0058
+        Assert.Throws<BadStatusException>(() => { imageFrame.ExportMask(7, 5, new byte[34]); });
+#pragma warning restore IDE0058
+      }
+    }
+
+    [Test]
+    public void ExportMask_ShouldThrowBadStatusException_When_FormatIsNotSupported()
+    {
+      using (var imageFrame = new ImageFrame(ImageFormat.Types.Format.Srgba, 10, 10))
+      {
+#pragma warning disable IDE0058
+        Assert.Throws<BadStatusException>(() => { imageFrame.ExportMask(10, 10, new byte[100]); });
+#pragma warning restore IDE0058
+      }
+    }
+    #endregion
+
+    #region ExportCategoryMask
+    [Test]
+    public void ExportCategoryMask_ShouldMapCategoryToColor()
+    {
+      var pixelData = new NativeArray<byte>(new byte[] { 0, 1, 2, 3 }, Allocator.Temp);
+      var colors = new UnityEngine.Color32[] { new UnityEngine.Color32(1, 2, 3, 4), new UnityEngine.Color32(5, 6, 7, 8), new UnityEngine.Color32(9, 10, 11, 12) };
+
+      using (var imageFrame = new ImageFrame(ImageFormat.Types.Format.Gray8, 4, 1, 4, pixelData))
+      {
+        var buffer = new byte[16];
+        imageFrame.ExportCategoryMask(4, 1, colors, buffer);
+
+        Assert.AreEqual(new byte[] { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 0, 0, 0, 0 }, buffer);
+      }
+    }
+    #endregion
+
+    private ImageFrame BuildMask(int width, int height, float[] confidences)
+    {
+      var pixelData = new NativeArray<float>(confidences, Allocator.Temp);
+      return new ImageFrame(ImageFormat.Types.Format.Vec32F1, width, height, 4 * width, pixelData.Reinterpret<byte>(sizeof(float)));
+    }
   }
 }
@@ -0,0 +1,139 @@
+// Copyright (c) 2026 homuler
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+using System;
+using System.Threading;
+using NUnit.Framework;
+
+namespace Mediapipe.Tests
+{
+  public class GraphPoolTest
+  {
+    private static readonly CalculatorGraphConfig _PassThroughConfig = CalculatorGraphConfig.Parser.ParseFromTextFormat(@"
+input_stream: ""in""
+output_stream: ""out""
+node {
+  calculator: ""PassThroughCalculator""
+  input_stream: ""in""
+  output_stream: ""out""
+}
+");
+
+    private static readonly int[] _OutputSums = new int[2];
+
+    #region Create
+    [Test]
+    public void Create_ShouldThrowException_When_PoolSizeIsNotPositive()
+    {
+      var exception = Assert.Throws<BadStatusException>(() => GraphPool.Create(_PassThroughConfig, 0));
+      Assert.AreEqual(StatusCode.InvalidArgument, exception.statusCode);
+    }
+
+    [Test]
+    public void Create_ShouldInstantiateGraphPool_When_CalledWithSharedExecutor()
+    {
+      using (var executor = ThreadPoolExecutor.Create(2))
+      using (var graphPool = GraphPool.Create(_PassThroughConfig, 4, executor, 2))
+      {
+        Assert.AreEqual(4, graphPool.poolSize);
+      }
+    }
+    #endregion
+
+    #region #StartRun
+    [Test]
+    public void StartRun_ShouldThrowException_When_SidePacketIsMissing()
+    {
+      var config = CalculatorGraphConfig.Parser.ParseFromTextFormat(@"
+input_stream: ""in""
+output_stream: ""out""
+node {
+  calculator: ""PassThroughCalculator""
+  input_stream: ""in""
+  input_side_packet: ""side""
+  output_stream: ""out""
+  output_side_packet: ""side_out""
+}
+");
+      var graphPool = GraphPool.Create(config, 2);
+      var exception = Assert.Throws<BadStatusException>(() => graphPool.StartRun());
+      Assert.AreNotEqual(StatusCode.Ok, exception.statusCode);
+
+      // NOTE: the graphs that have started must be cancelled and waited for.
+      Assert.DoesNotThrow(() => graphPool.Dispose());
+    }
+    #endregion
+
+    #region #TryAddPacketToInputStream
+    [Test]
+    public void TryAddPacketToInputStream_ShouldRoutePacketsByStreamId()
+    {
+      Array.Clear(_OutputSums, 0, _OutputSums.Length);
+
+      using (var graphPool = GraphPool.Create(_PassThroughConfig, 2))
+      {
+        graphPool.ObserveOutputStream("out", 0, SumOutputs);
+        graphPool.StartRun();
+
+        Assert.True(graphPool.TryAddPacketToInputStream(0, "in", Packet.CreateIntAt(1, 0)));
+        Assert.True(graphPool.TryAddPacketToInputStream(1, "in", Packet.CreateIntAt(10, 0)));
+        Assert.True(graphPool.TryAddPacketToInputStream(1, "in", Packet.CreateIntAt(20, 1)));
+        graphPool.Close();
+
+        Assert.AreEqual(1, _OutputSums[0]);
+        Assert.AreEqual(30, _OutputSums[1]);
+
+        var stats = graphPool.GetStreamStats(1);
+        Assert.AreEqual(2, stats.packetsIn);
+        Assert.AreEqual(2, stats.packetsOut);
+        Assert.AreEqual(0, stats.packetsRejected);
+
+        var totalStats = graphPool.GetStats();
+        Assert.AreEqual(3, totalStats.packetsIn);
+        Assert.AreEqual(3, totalStats.packetsOut);
+        Assert.Greater(totalStats.throughput, 0);
+      }
+    }
+
+    [Test]
+    public void TryAddPacketToInputStream_ShouldThrowException_When_StreamIdIsOutOfRange()
+    {
+      using (var graphPool = GraphPool.Create(_PassThroughConfig, 1))
+      {
+        graphPool.StartRun();
+
+        var exception = Assert.Throws<BadStatusException>(() => graphPool.TryAddPacketToInputStream(1, "in", Packet.CreateIntAt(1, 0)));
+        Assert.AreEqual(StatusCode.OutOfRange, exception.statusCode);
+      }
+    }
+    #endregion
+
+    #region #CloseStream
+    [Test]
+    public void CloseStream_ShouldNotCloseOtherStreams()
+    {
+      using (var graphPool = GraphPool.Create(_PassThroughConfig, 2))
+      {
+        graphPool.StartRun();
+        graphPool.CloseStream(0);
+
+        Assert.True(graphPool.TryAddPacketToInputStream(1, "in", Packet.CreateIntAt(1, 0)));
+        graphPool.Close();
+      }
+    }
+    #endregion
+
+    [AOT.MonoPInvokeCallback(typeof(GraphPool.NativePacketCallback))]
+    private static StatusArgs SumOutputs(int streamId, int callbackId, IntPtr packetPtr)
+    {
+      using (var packet = Packet<int>.CreateForReference(packetPtr))
+      {
+        Interlocked.Add(ref _OutputSums[streamId], packet.Get());
+      }
+      return StatusArgs.Ok();
+    }
+  }
+}
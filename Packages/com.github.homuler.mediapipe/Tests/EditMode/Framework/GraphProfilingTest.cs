@@ -0,0 +1,93 @@
+// Copyright (c) 2026 homuler
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+using System.IO;
+using System.Linq;
+using NUnit.Framework;
+
+namespace Mediapipe.Tests
+{
+  public class GraphProfilingTest
+  {
+    private const string _PassThroughConfigText = @"
+input_stream: ""in""
+output_stream: ""out""
+node {
+  calculator: ""PassThroughCalculator""
+  input_stream: ""in""
+  output_stream: ""out""
+}
+";
+
+    [TearDown]
+    public void TearDown()
+    {
+      GraphProfiling.enabled = false;
+    }
+
+    [Test]
+    public void SetProfilingEnabled_ShouldThrowBadStatusException_When_Disabled()
+    {
+      GraphProfiling.enabled = false;
+
+      using (var graph = new CalculatorGraph(_PassThroughConfigText))
+      {
+        _ = Assert.Throws<BadStatusException>(() => { graph.SetProfilingEnabled(true); });
+      }
+    }
+
+    [Test]
+    public void GetCalculatorProfiles_ShouldReturnProcessCount_When_ProfilingIsTurnedOn()
+    {
+      GraphProfiling.enabled = true;
+
+      using (var graph = new CalculatorGraph(_PassThroughConfigText))
+      {
+        graph.StartRun();
+        graph.SetProfilingEnabled(true);
+        for (var i = 0; i < 3; i++)
+        {
+          graph.AddPacketToInputStream("in", Packet.CreateIntAt(i, i));
+        }
+        graph.CloseAllPacketSources();
+        graph.WaitUntilDone();
+
+        var profile = graph.GetCalculatorProfiles().Single((stats) => stats.name == "PassThroughCalculator");
+        Assert.AreEqual(3, profile.processCount);
+        Assert.AreEqual(3, profile.processHistogram.Sum());
+      }
+    }
+
+    [Test]
+    public void WriteTrace_ShouldWriteChromeTrace()
+    {
+      GraphProfiling.enabled = true;
+      var path = Path.Combine(Path.GetTempPath(), Path.GetRandomFileName());
+
+      try
+      {
+        using (var graph = new CalculatorGraph(_PassThroughConfigText))
+        {
+          graph.StartRun();
+          graph.SetProfilingEnabled(true);
+          graph.AddPacketToInputStream("in", Packet.CreateIntAt(0, 0));
+          graph.CloseAllPacketSources();
+          graph.WaitUntilDone();
+
+          graph.WriteTrace(path, 10);
+        }
+
+        var trace = File.ReadAllText(path);
+        StringAssert.StartsWith("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[", trace);
+        StringAssert.Contains("\"name\":\"PassThroughCalculator\"", trace);
+      }
+      finally
+      {
+        File.Delete(path);
+      }
+    }
+  }
+}
@@ -0,0 +1,107 @@
+// Copyright (c) 2026 homuler
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+using System;
+using System.Threading;
+using Google.Protobuf.WellKnownTypes;
+using NUnit.Framework;
+
+namespace Mediapipe.Tests
+{
+  public class LiveGraphTest
+  {
+    private const string _PassThroughConfigText = @"
+input_stream: ""in""
+output_stream: ""out""
+node {
+  name: ""pass""
+  calculator: ""PassThroughCalculator""
+  input_stream: ""in""
+  output_stream: ""out""
+}
+";
+
+    private static int _OutputSum;
+
+    #region #UpdateNodeOptions
+    [Test]
+    public void UpdateNodeOptions_ShouldMergeNodeOptions()
+    {
+      var config = CalculatorGraphConfig.Parser.ParseFromTextFormat(_PassThroughConfigText);
+      config.Node[0].NodeOptions.Add(Any.Pack(new FlowLimiterCalculatorOptions() { MaxInFlight = 2 }));
+
+      using (var liveGraph = new LiveGraph(config))
+      {
+        var patch = new CalculatorGraphConfig.Types.Node();
+        patch.NodeOptions.Add(Any.Pack(new FlowLimiterCalculatorOptions() { MaxInQueue = 3 }));
+        liveGraph.UpdateNodeOptions("pass", patch);
+
+        var node = liveGraph.Config().Node[0];
+        Assert.AreEqual(1, node.NodeOptions.Count);
+        var options = node.NodeOptions[0].Unpack<FlowLimiterCalculatorOptions>();
+        Assert.AreEqual(2, options.MaxInFlight);
+        Assert.AreEqual(3, options.MaxInQueue);
+      }
+    }
+
+    [Test]
+    public void UpdateNodeOptions_ShouldThrowException_When_TheNodeIsNotFound()
+    {
+      using (var liveGraph = new LiveGraph(_PassThroughConfigText))
+      {
+        var exception = Assert.Throws<BadStatusException>(() => liveGraph.UpdateNodeOptions("unknown", new CalculatorGraphConfig.Types.Node()));
+        Assert.AreEqual(StatusCode.NotFound, exception.statusCode);
+      }
+    }
+    #endregion
+
+    #region #ApplyUpdates
+    [Test]
+    public void ApplyUpdates_ShouldThrowException_When_TheGraphHasNotStarted()
+    {
+      using (var liveGraph = new LiveGraph(_PassThroughConfigText))
+      {
+        var exception = Assert.Throws<BadStatusException>(() => liveGraph.ApplyUpdates());
+        Assert.AreEqual(StatusCode.FailedPrecondition, exception.statusCode);
+      }
+    }
+
+    [Test]
+    public void ApplyUpdates_ShouldSwitchGraph_Without_DroppingPackets()
+    {
+      _OutputSum = 0;
+
+      using (var liveGraph = new LiveGraph(_PassThroughConfigText))
+      {
+        liveGraph.ObserveOutputStream("out", 0, SumOutputs);
+        liveGraph.StartRun();
+        liveGraph.AddPacketToInputStream("in", Packet.CreateIntAt(1, 1));
+
+        liveGraph.ApplyUpdates();
+        liveGraph.WaitForUpdate();
+        Assert.AreEqual(0, liveGraph.generation);
+
+        liveGraph.AddPacketToInputStream("in", Packet.CreateIntAt(2, 2));
+        Assert.AreEqual(1, liveGraph.generation);
+
+        liveGraph.CloseAllPacketSources();
+        liveGraph.WaitUntilDone();
+        Assert.AreEqual(3, _OutputSum);
+      }
+    }
+    #endregion
+
+    [AOT.MonoPInvokeCallback(typeof(CalculatorGraph.NativePacketCallback))]
+    private static StatusArgs SumOutputs(IntPtr graphPtr, int streamId, IntPtr packetPtr)
+    {
+      using (var packet = Packet<int>.CreateForReference(packetPtr))
+      {
+        Interlocked.Add(ref _OutputSum, packet.Get());
+      }
+      return StatusArgs.Ok();
+    }
+  }
+}
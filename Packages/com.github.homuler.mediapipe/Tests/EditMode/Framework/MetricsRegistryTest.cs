@@ -0,0 +1,88 @@
+// Copyright (c) 2026 homuler
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+using System;
+using NUnit.Framework;
+
+namespace Mediapipe.Tests
+{
+  public class MetricsRegistryTest
+  {
+    private const string _PassThroughConfigText = @"
+input_stream: ""in""
+output_stream: ""out""
+node {
+  calculator: ""PassThroughCalculator""
+  input_stream: ""in""
+  output_stream: ""out""
+}
+";
+
+    [TearDown]
+    public void TearDown()
+    {
+      MetricsRegistry.enabled = false;
+    }
+
+    [Test]
+    public void Snapshot_ShouldReturnNoMetrics_When_Disabled()
+    {
+      MetricsRegistry.enabled = false;
+
+      using (var graph = new CalculatorGraph(_PassThroughConfigText))
+      {
+        graph.ObserveOutputStream("out", 0, Ignore);
+        graph.StartRun();
+        graph.AddPacketToInputStream("in", Packet.CreateIntAt(0, 0));
+        graph.CloseAllPacketSources();
+        graph.WaitUntilDone();
+
+        MetricsRegistry.Snapshot(null, out var graphsSize, null, out var streamsSize);
+        Assert.AreEqual(0, graphsSize);
+        Assert.AreEqual(0, streamsSize);
+      }
+    }
+
+    [Test]
+    public void Snapshot_ShouldCopyMetrics_When_Enabled()
+    {
+      MetricsRegistry.enabled = true;
+      var graphs = new GraphMetricsSnapshot[4];
+      var streams = new StreamMetricsSnapshot[4];
+
+      using (var graph = new CalculatorGraph(_PassThroughConfigText))
+      {
+        graph.ObserveOutputStream("out", 0, Ignore);
+        graph.StartRun();
+        for (var i = 0; i < 3; i++)
+        {
+          graph.AddPacketToInputStream("in", Packet.CreateIntAt(i, i));
+        }
+        graph.CloseAllPacketSources();
+        graph.WaitUntilDone();
+
+        MetricsRegistry.Snapshot(graphs, out var graphsSize, streams, out var streamsSize);
+        Assert.AreEqual(1, graphsSize);
+        Assert.AreEqual(1, streamsSize);
+        Assert.AreEqual(3, graphs[0].inputPackets);
+        Assert.AreEqual(0, graphs[0].queueDepth);
+        Assert.AreEqual(0, graphs[0].droppedFrames);
+        Assert.AreEqual(graphs[0].graphId, streams[0].graphId);
+        Assert.AreEqual("out", streams[0].name);
+        Assert.AreEqual(3, streams[0].packets);
+      }
+
+      MetricsRegistry.Snapshot(graphs, out var sizeAfterDisposed, streams, out _);
+      Assert.AreEqual(0, sizeAfterDisposed);
+    }
+
+    [AOT.MonoPInvokeCallback(typeof(CalculatorGraph.NativePacketCallback))]
+    private static StatusArgs Ignore(IntPtr graphPtr, int streamId, IntPtr packetPtr)
+    {
+      return StatusArgs.Ok();
+    }
+  }
+}
@@ -71,6 +71,35 @@ namespace Mediapipe.Tests
     }
     #endregion
 
+    #region #InsertOrAssign
+    [Test]
+    public void InsertOrAssign_ShouldInsertAndDisposePacket()
+    {
+      using (var packetMap = new PacketMap())
+      {
+        var packet = Packet.CreateFloat(1.0f);
+        packetMap.InsertOrAssign("value", packet);
+
+        Assert.AreEqual(1, packetMap.size);
+        Assert.AreEqual(1.0f, packetMap.At<float>("value").Get());
+        Assert.True(packet.isDisposed);
+      }
+    }
+
+    [Test]
+    public void InsertOrAssign_ShouldOverwriteValue_When_KeyExists()
+    {
+      using (var packetMap = new PacketMap())
+      {
+        packetMap.InsertOrAssign("value", Packet.CreateFloat(1.0f));
+        packetMap.InsertOrAssign("value", Packet.CreateFloat(2.0f));
+
+        Assert.AreEqual(1, packetMap.size);
+        Assert.AreEqual(2.0f, packetMap.At<float>("value").Get());
+      }
+    }
+    #endregion
+
     #region #Erase
     [Test]
     public void Erase_ShouldDoNothing_When_KeyDoesNotExist()
@@ -0,0 +1,84 @@
+// Copyright (c) 2026 homuler
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+using System.Linq;
+using NUnit.Framework;
+
+namespace Mediapipe.Tests
+{
+  public class StartupProfilerTest
+  {
+    private const string _PassThroughConfigText = @"
+input_stream: ""in""
+output_stream: ""out""
+node {
+  calculator: ""PassThroughCalculator""
+  input_stream: ""in""
+  output_stream: ""out""
+}
+";
+
+    [TearDown]
+    public void TearDown()
+    {
+      StartupProfiler.enabled = false;
+    }
+
+    [Test]
+    public void GetStartupPhases_ShouldReturnEmptyList_When_Disabled()
+    {
+      StartupProfiler.enabled = false;
+
+      using (var graph = new CalculatorGraph(_PassThroughConfigText))
+      {
+        graph.StartRun();
+        Assert.IsEmpty(graph.GetStartupPhases());
+
+        graph.CloseAllPacketSources();
+        graph.WaitUntilDone();
+      }
+    }
+
+    [Test]
+    public void GetStartupPhases_ShouldReturnPhases_When_Enabled()
+    {
+      StartupProfiler.enabled = true;
+
+      using (var graph = new CalculatorGraph(_PassThroughConfigText))
+      {
+        graph.StartRun();
+        var phases = graph.GetStartupPhases();
+
+        Assert.True(phases.Any((phase) => phase.type == StartupPhaseType.ConfigParse && phase.nodeId == -1));
+        Assert.True(phases.Any((phase) => phase.type == StartupPhaseType.Validation && phase.nodeId == -1));
+        Assert.True(phases.Any((phase) => phase.type == StartupPhaseType.StartRun && phase.nodeId == -1));
+        Assert.True(phases.All((phase) => phase.startUs >= 0 && phase.durationUs >= 0));
+
+        graph.CloseAllPacketSources();
+        graph.WaitUntilDone();
+      }
+    }
+
+    [Test]
+    public void GetStartupPhases_ShouldRecordOnlyTheFirstRun()
+    {
+      StartupProfiler.enabled = true;
+
+      using (var graph = new CalculatorGraph(_PassThroughConfigText))
+      {
+        graph.StartRun();
+        graph.CloseAllPacketSources();
+        graph.WaitUntilDone();
+        graph.StartRun();
+
+        Assert.AreEqual(1, graph.GetStartupPhases().Count((phase) => phase.type == StartupPhaseType.StartRun));
+
+        graph.CloseAllPacketSources();
+        graph.WaitUntilDone();
+      }
+    }
+  }
+}
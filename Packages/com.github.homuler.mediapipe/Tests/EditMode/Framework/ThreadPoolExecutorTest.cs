@@ -0,0 +1,49 @@
+// Copyright (c) 2026 homuler
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+using NUnit.Framework;
+
+namespace Mediapipe.Tests
+{
+  public class ThreadPoolExecutorTest
+  {
+    #region Create
+    [Test]
+    public void Create_ShouldThrowException_When_NumThreadsIsNotPositive()
+    {
+      var exception = Assert.Throws<BadStatusException>(() => ThreadPoolExecutor.Create(0));
+      Assert.AreEqual(StatusCode.InvalidArgument, exception.statusCode);
+    }
+
+    [Test]
+    public void Create_ShouldThrowException_When_CpuSetIsInvalid()
+    {
+      var exception = Assert.Throws<BadStatusException>(() => ThreadPoolExecutor.Create(1, cpuSet: new int[] { -1 }));
+      Assert.AreEqual(StatusCode.InvalidArgument, exception.statusCode);
+    }
+
+    [Test]
+    public void Create_ShouldInstantiateThreadPoolExecutor()
+    {
+      using (var executor = ThreadPoolExecutor.Create(2, "test_executor", 0, new int[] { 0 }))
+      {
+        Assert.AreEqual(2, executor.numThreads);
+      }
+    }
+    #endregion
+
+    #region #isDisposed
+    [Test]
+    public void IsDisposed_ShouldReturnTrue_When_AlreadyDisposed()
+    {
+      var executor = ThreadPoolExecutor.Create(1);
+      executor.Dispose();
+
+      Assert.True(executor.isDisposed);
+    }
+    #endregion
+  }
+}
@@ -0,0 +1,129 @@
+// Copyright (c) 2026 homuler
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+using System;
+using System.Threading;
+using NUnit.Framework;
+
+namespace Mediapipe.Tests
+{
+  public class WarmGraphPoolTest
+  {
+    private static readonly CalculatorGraphConfig _PassThroughConfig = CalculatorGraphConfig.Parser.ParseFromTextFormat(@"
+input_stream: ""in""
+output_stream: ""out""
+node {
+  calculator: ""PassThroughCalculator""
+  input_stream: ""in""
+  output_stream: ""out""
+}
+");
+
+    private static int _OutputSum;
+
+    #region Create
+    [Test]
+    public void Create_ShouldThrowException_When_PoolSizeIsNotPositive()
+    {
+      var exception = Assert.Throws<BadStatusException>(() => WarmGraphPool.Create(_PassThroughConfig, 0, BuildWarmupInputs()));
+      Assert.AreEqual(StatusCode.InvalidArgument, exception.statusCode);
+    }
+    #endregion
+
+    #region #Acquire
+    [Test]
+    public void Acquire_ShouldReturnWarmGraph_Which_DiscardsWarmupOutputs()
+    {
+      _OutputSum = 0;
+
+      using (var warmGraphPool = WarmGraphPool.Create(_PassThroughConfig, 1, BuildWarmupInputs()))
+      using (var warmGraph = warmGraphPool.Acquire())
+      {
+        warmGraph.ObserveOutputStream("out", 0, SumOutputs);
+        warmGraph.AddPacketToInputStream("in", Packet.CreateIntAt(1, 1));
+        warmGraph.AddPacketToInputStream("in", Packet.CreateIntAt(2, 2));
+        warmGraph.CloseAllPacketSources();
+        warmGraph.WaitUntilDone();
+
+        Assert.AreEqual(3, _OutputSum);
+      }
+    }
+
+    [Test]
+    public void Acquire_ShouldPrepareAnotherGraph()
+    {
+      using (var warmGraphPool = WarmGraphPool.Create(_PassThroughConfig, 2, BuildWarmupInputs()))
+      using (var warmGraph1 = warmGraphPool.Acquire())
+      using (var warmGraph2 = warmGraphPool.Acquire())
+      using (var warmGraph3 = warmGraphPool.Acquire())
+      {
+        Assert.False(warmGraph3.HasError());
+      }
+    }
+
+    [Test]
+    public void Acquire_ShouldThrowException_When_TheGraphCannotBeStarted()
+    {
+      var warmupInputs = new PacketMap();
+      warmupInputs.Emplace("unknown", Packet.CreateInt(0));
+
+      using (var warmGraphPool = WarmGraphPool.Create(_PassThroughConfig, 1, warmupInputs))
+      {
+#pragma warning disable IDE0058
+        Assert.Throws<BadStatusException>(() => warmGraphPool.Acquire());
+#pragma warning restore IDE0058
+      }
+    }
+
+    [Test]
+    public void Acquire_ShouldThrowException_After_RetryingToPrepareTheGraph()
+    {
+      var warmupInputs = new PacketMap();
+      warmupInputs.Emplace("unknown", Packet.CreateInt(0));
+
+      using (var warmGraphPool = WarmGraphPool.Create(_PassThroughConfig, 1, warmupInputs))
+      {
+#pragma warning disable IDE0058
+        Assert.Throws<BadStatusException>(() => warmGraphPool.Acquire());
+        Thread.Sleep(300);
+        Assert.Throws<BadStatusException>(() => warmGraphPool.Acquire());
+#pragma warning restore IDE0058
+        Assert.AreEqual(0, warmGraphPool.readyCount);
+      }
+    }
+    #endregion
+
+    #region WarmGraph#ObserveOutputStream
+    [Test]
+    public void ObserveOutputStream_ShouldThrowException_When_TheStreamIsNotObservedByThePool()
+    {
+      using (var warmGraphPool = WarmGraphPool.Create(_PassThroughConfig, 1, BuildWarmupInputs()))
+      using (var warmGraph = warmGraphPool.Acquire())
+      {
+        var exception = Assert.Throws<BadStatusException>(() => warmGraph.ObserveOutputStream("in", 0, SumOutputs));
+        Assert.AreEqual(StatusCode.InvalidArgument, exception.statusCode);
+      }
+    }
+    #endregion
+
+    private PacketMap BuildWarmupInputs()
+    {
+      var warmupInputs = new PacketMap();
+      warmupInputs.Emplace("in", Packet.CreateInt(100));
+      return warmupInputs;
+    }
+
+    [AOT.MonoPInvokeCallback(typeof(CalculatorGraph.NativePacketCallback))]
+    private static StatusArgs SumOutputs(IntPtr graphPtr, int streamId, IntPtr packetPtr)
+    {
+      using (var packet = Packet<int>.CreateForReference(packetPtr))
+      {
+        Interlocked.Add(ref _OutputSum, packet.Get());
+      }
+      return StatusArgs.Ok();
+    }
+  }
+}
@@ -0,0 +1,182 @@
+// Copyright (c) 2026 homuler
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+using System.Collections.Generic;
+using Mediapipe.Tasks.Core;
+using NUnit.Framework;
+
+namespace Mediapipe.Tests.Tasks.Core
+{
+  public class PipelinedTaskRunnerTest
+  {
+    private const string _PassThroughConfigText = @"node {
+  calculator: ""PassThroughCalculator""
+  input_stream: ""in""
+  output_stream: ""out""
+}
+input_stream: ""in""
+output_stream: ""out""
+";
+
+    private const int _TimeoutMillisec = 1000;
+
+    private CalculatorGraphConfig passThroughConfig => CalculatorGraphConfig.Parser.ParseFromTextFormat(_PassThroughConfigText);
+
+    #region Create
+    [Test]
+    public void Create_ShouldThrowException_When_MaxInFlightIsNotPositive()
+    {
+      var exception = Assert.Throws<BadStatusException>(() => PipelinedTaskRunner.Create(passThroughConfig, 0));
+      Assert.AreEqual(StatusCode.InvalidArgument, exception.statusCode);
+    }
+
+    [Test]
+    public void Create_ShouldThrowException_When_CalledWithInvalidConfig()
+    {
+      var exception = Assert.Throws<BadStatusException>(() => PipelinedTaskRunner.Create(new CalculatorGraphConfig(), 1));
+      Assert.AreEqual(StatusCode.InvalidArgument, exception.statusCode);
+    }
+    #endregion
+
+    #region #TrySend
+    [Test]
+    public void TrySend_ShouldThrowException_When_InputHasNoTimestamp()
+    {
+      using (var taskRunner = PipelinedTaskRunner.Create(passThroughConfig, 1))
+      {
+        using var packetMap = new PacketMap();
+        var exception = Assert.Throws<BadStatusException>(() => taskRunner.TrySend(packetMap, out var _));
+        Assert.AreEqual(StatusCode.InvalidArgument, exception.statusCode);
+      }
+    }
+
+    [Test]
+    public void TrySend_ShouldReturnFalse_When_PipelineIsFull()
+    {
+      using (var taskRunner = PipelinedTaskRunner.Create(passThroughConfig, 1))
+      {
+        var packetMap = new PacketMap();
+        packetMap.Emplace("in", Packet.CreateIntAt(1, 1));
+        Assert.True(taskRunner.TrySend(packetMap, out var ticket));
+        Assert.AreEqual(0, ticket);
+        Assert.True(packetMap.isDisposed);
+
+        using var nextPacketMap = new PacketMap();
+        nextPacketMap.Emplace("in", Packet.CreateIntAt(2, 2));
+        // the first input may be processed already
+        if (!taskRunner.TrySend(nextPacketMap, out ticket))
+        {
+          Assert.AreEqual(-1, ticket);
+          Assert.False(nextPacketMap.isDisposed);
+          Assert.AreEqual(1, nextPacketMap.size);
+        }
+      }
+    }
+    #endregion
+
+    #region #TryGetResult
+    [Test]
+    public void TryGetResult_ShouldReturnOutput_When_InputIsProcessed()
+    {
+      using (var taskRunner = PipelinedTaskRunner.Create(passThroughConfig, 2))
+      {
+        var tickets = new long[2];
+        for (var i = 0; i < 2; i++)
+        {
+          var packetMap = new PacketMap();
+          packetMap.Emplace("in", Packet.CreateIntAt(i, i));
+          Assert.True(taskRunner.TrySend(packetMap, out tickets[i]));
+        }
+
+        for (var i = 1; i >= 0; i--)
+        {
+          Assert.True(taskRunner.TryGetResult(tickets[i], out var outputs, _TimeoutMillisec));
+          using (outputs)
+          {
+            Assert.AreEqual(i, outputs.At<int>("out").Get());
+          }
+        }
+        Assert.AreEqual(0, taskRunner.inFlightCount);
+        Assert.AreEqual(0, taskRunner.completedCount);
+      }
+    }
+
+    [Test]
+    public void TryGetResult_ShouldReturnFalse_When_TicketIsUnknown()
+    {
+      using (var taskRunner = PipelinedTaskRunner.Create(passThroughConfig, 1))
+      {
+        Assert.False(taskRunner.TryGetResult(100, out var outputs, _TimeoutMillisec));
+        Assert.Null(outputs);
+      }
+    }
+    #endregion
+
+    #region #ProcessBatch
+    [Test]
+    public void ProcessBatch_ShouldReturnOutputsInOrder([Values(1, 4)] int maxInFlight)
+    {
+      using (var taskRunner = PipelinedTaskRunner.Create(passThroughConfig, maxInFlight))
+      {
+        var inputs = new List<PacketMap>();
+        for (var i = 0; i < 8; i++)
+        {
+          var packetMap = new PacketMap();
+          packetMap.Emplace("in", Packet.CreateIntAt(i, i));
+          inputs.Add(packetMap);
+        }
+
+        var outputs = taskRunner.ProcessBatch(inputs, _TimeoutMillisec);
+        Assert.AreEqual(8, outputs.Length);
+        for (var i = 0; i < 8; i++)
+        {
+          Assert.True(inputs[i].isDisposed);
+          using var output = outputs[i];
+          Assert.AreEqual(i, output.At<int>("out").Get());
+        }
+        Assert.AreEqual(0, taskRunner.inFlightCount);
+      }
+    }
+
+    [Test]
+    public void ProcessBatch_ShouldThrowException_When_InputHasNoTimestamp()
+    {
+      using (var taskRunner = PipelinedTaskRunner.Create(passThroughConfig, 1))
+      {
+        var inputs = new List<PacketMap>() { new PacketMap() };
+        var exception = Assert.Throws<BadStatusException>(() => taskRunner.ProcessBatch(inputs, _TimeoutMillisec));
+        Assert.AreEqual(StatusCode.InvalidArgument, exception.statusCode);
+      }
+    }
+    #endregion
+
+    #region #DrainResults
+    [Test]
+    public void DrainResults_ShouldTakeAllTheCompletedResults()
+    {
+      using (var taskRunner = PipelinedTaskRunner.Create(passThroughConfig, 3))
+      {
+        for (var i = 0; i < 3; i++)
+        {
+          var packetMap = new PacketMap();
+          packetMap.Emplace("in", Packet.CreateIntAt(i, i));
+          Assert.True(taskRunner.TrySend(packetMap, out var _));
+        }
+        taskRunner.Close();
+
+        var results = new Dictionary<long, PacketMap>();
+        Assert.AreEqual(3, taskRunner.DrainResults(results));
+        for (var i = 0; i < 3; i++)
+        {
+          using var outputs = results[i];
+          Assert.AreEqual(i, outputs.At<int>("out").Get());
+        }
+        Assert.AreEqual(0, taskRunner.completedCount);
+      }
+    }
+    #endregion
+  }
+}
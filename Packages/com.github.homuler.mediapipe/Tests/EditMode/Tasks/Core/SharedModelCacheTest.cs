@@ -0,0 +1,115 @@
+// Copyright (c) 2026 homuler
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+using System;
+using System.IO;
+using System.Runtime.InteropServices;
+using Google.Protobuf;
+using Google.Protobuf.WellKnownTypes;
+using Mediapipe.Tasks.Core;
+using Mediapipe.Tasks.Core.Proto;
+using NUnit.Framework;
+
+namespace Mediapipe.Tests.Tasks.Core
+{
+  public class SharedModelCacheTest
+  {
+    private const string _PassThroughConfigText = @"node {
+  calculator: ""PassThroughCalculator""
+  input_stream: ""in""
+  output_stream: ""out""
+}
+input_stream: ""in""
+output_stream: ""out""
+";
+
+    [SetUp]
+    public void SetUp()
+    {
+      SharedModelCache.enabled = true;
+    }
+
+    [TearDown]
+    public void TearDown()
+    {
+      SharedModelCache.enabled = false;
+    }
+
+    [Test]
+    public void Create_ShouldShareModelAsset_When_ContentsAreSame()
+    {
+      var before = SharedModelCache.GetStats();
+      var content = ByteString.CopyFrom(new byte[1024]);
+
+      using (var taskRunner1 = TaskRunner.Create(BuildConfigWithModelAsset(content)))
+      using (var taskRunner2 = TaskRunner.Create(BuildConfigWithModelAsset(content)))
+      {
+        var after = SharedModelCache.GetStats();
+        Assert.AreEqual(before.hits + 1, after.hits);
+        Assert.AreEqual(before.sharedBytes + 1024, after.sharedBytes);
+
+        var externalFile = taskRunner1.GetGraphConfig().Node[0].NodeOptions[0].Unpack<ExternalFile>();
+        Assert.False(externalFile.HasFileContent);
+        Assert.AreEqual(1024, externalFile.FilePointerMeta.Length);
+      }
+    }
+
+    [Test]
+    public void Create_ShouldNotShareModelAsset_When_Disabled()
+    {
+      SharedModelCache.enabled = false;
+
+      using (var taskRunner = TaskRunner.Create(BuildConfigWithModelAsset(ByteString.CopyFrom(new byte[16]))))
+      {
+        var externalFile = taskRunner.GetGraphConfig().Node[0].NodeOptions[0].Unpack<ExternalFile>();
+        Assert.AreEqual(16, externalFile.FileContent.Length);
+      }
+    }
+
+    [Test]
+    public void Create_ShouldMapModelAsset_When_MemoryMappingIsEnabled()
+    {
+      var filePath = Path.GetTempFileName();
+      var bytes = new byte[4096];
+      for (var i = 0; i < bytes.Length; i++)
+      {
+        bytes[i] = (byte)i;
+      }
+      File.WriteAllBytes(filePath, bytes);
+
+      ResourceUtil.EnableMemoryMapping();
+      ResourceUtil.SetAssetLocation("mapped_model.tflite", filePath, 100, 1000);
+      try
+      {
+        var config = CalculatorGraphConfig.Parser.ParseFromTextFormat(_PassThroughConfigText);
+        config.Node[0].NodeOptions.Add(Any.Pack(new ExternalFile() { FileName = "mapped_model.tflite" }));
+
+        using (var taskRunner = TaskRunner.Create(config))
+        {
+          var externalFile = taskRunner.GetGraphConfig().Node[0].NodeOptions[0].Unpack<ExternalFile>();
+          Assert.AreEqual(1000, externalFile.FilePointerMeta.Length);
+          var pointer = new IntPtr((long)externalFile.FilePointerMeta.Pointer);
+          Assert.AreEqual(bytes[100], Marshal.ReadByte(pointer));
+          Assert.AreEqual(bytes[1099], Marshal.ReadByte(pointer, 999));
+        }
+      }
+      finally
+      {
+#pragma warning disable IDE0058
+        ResourceUtil.RemoveAssetPath("mapped_model.tflite");
+#pragma warning restore IDE0058
+        File.Delete(filePath);
+      }
+    }
+
+    private CalculatorGraphConfig BuildConfigWithModelAsset(ByteString content)
+    {
+      var config = CalculatorGraphConfig.Parser.ParseFromTextFormat(_PassThroughConfigText);
+      config.Node[0].NodeOptions.Add(Any.Pack(new ExternalFile() { FileContent = content }));
+      return config;
+    }
+  }
+}
@@ -45,6 +45,47 @@ output_stream: ""out""
         taskRunner.Dispose();
       });
     }
+
+    [Test]
+    public void Create_ShouldInstantiateTaskRunner_When_CalledWithSharedExecutor()
+    {
+      using (var executor = ThreadPoolExecutor.Create(1))
+      using (var taskRunner1 = TaskRunner.Create(passThroughConfig, null, executor))
+      using (var taskRunner2 = TaskRunner.Create(passThroughConfig, null, executor))
+      {
+        foreach (var taskRunner in new[] { taskRunner1, taskRunner2 })
+        {
+          var packetMap = new PacketMap();
+          packetMap.Emplace("in", Packet.CreateInt(1));
+
+          using (var outputMap = taskRunner.Process(packetMap))
+          {
+            Assert.AreEqual(1, outputMap.At<int>("out").Get());
+          }
+        }
+      }
+    }
+
+    [Test]
+    public void Create_ShouldInstantiateTaskRunner_When_ApplicationThreadExecutorIsSet()
+    {
+      var config = passThroughConfig;
+      config.Executor.Add(new ExecutorConfig() { Type = "ApplicationThreadExecutor" });
+
+      using (var taskRunner = TaskRunner.Create(config))
+      {
+        for (var i = 0; i < 3; i++)
+        {
+          var packetMap = new PacketMap();
+          packetMap.Emplace("in", Packet.CreateIntAt(i, i));
+
+          using (var outputMap = taskRunner.Process(packetMap))
+          {
+            Assert.AreEqual(i, outputMap.At<int>("out").Get());
+          }
+        }
+      }
+    }
     #endregion
 
     #region #isDisposed
@@ -93,6 +134,39 @@ output_stream: ""out""
         Assert.True(packetMap.isDisposed);
       }
     }
+
+    [Test]
+    public void Process_ShouldThrowException_When_InputIsInvalid_And_OutputIsGiven()
+    {
+      using (var taskRunner = TaskRunner.Create(passThroughConfig))
+      using (var inputs = new PacketMap())
+      using (var outputs = new PacketMap())
+      {
+        var exception = Assert.Throws<BadStatusException>(() => taskRunner.Process(inputs, outputs));
+        Assert.AreEqual(StatusCode.InvalidArgument, exception.statusCode);
+        Assert.False(inputs.isDisposed);
+        Assert.False(outputs.isDisposed);
+      }
+    }
+
+    [Test]
+    public void Process_ShouldMoveOutput_When_OutputIsGiven()
+    {
+      using (var taskRunner = TaskRunner.Create(passThroughConfig))
+      using (var inputs = new PacketMap())
+      using (var outputs = new PacketMap())
+      {
+        for (var i = 1; i <= 2; i++)
+        {
+          inputs.InsertOrAssign("in", Packet.CreateInt(i));
+          taskRunner.Process(inputs, outputs);
+
+          Assert.AreEqual(i, outputs.At<int>("out").Get());
+          Assert.AreEqual(1, inputs.size);
+          Assert.True(inputs.At<int>("in").IsEmpty());
+        }
+      }
+    }
     #endregion
 
     #region #Send
@@ -133,6 +207,22 @@ output_stream: ""out""
         Assert.True(packetMap.isDisposed);
       }
     }
+
+    [Test]
+    public void Send_ShouldNotDisposeInput_When_ReuseInputsIsTrue()
+    {
+      using (var taskRunner = TaskRunner.Create(passThroughConfig, 0, HandlePassThroughResult))
+      using (var packetMap = new PacketMap())
+      {
+        for (var i = 1; i <= 2; i++)
+        {
+          packetMap.InsertOrAssign("in", Packet.CreateIntAt(i, i));
+          Assert.DoesNotThrow(() => taskRunner.Send(packetMap, true));
+          Assert.False(packetMap.isDisposed);
+          Assert.AreEqual(1, packetMap.size);
+        }
+      }
+    }
     #endregion
 
     #region #Close
@@ -0,0 +1,49 @@
+// Copyright (c) 2026 homuler
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+using NUnit.Framework;
+
+namespace Mediapipe.Tests
+{
+  public class BatchingInferenceServiceTest
+  {
+    #region Configure
+    [Test]
+    public void Configure_ShouldThrowBadStatusException_When_MaxBatchSizeIsNotPositive()
+    {
+      var exception = Assert.Throws<BadStatusException>(() => BatchingInferenceService.Configure(0, 1000));
+      Assert.AreEqual(StatusCode.InvalidArgument, exception.statusCode);
+    }
+
+    [Test]
+    public void Configure_ShouldThrowBadStatusException_When_MaxWaitIsNegative()
+    {
+      var exception = Assert.Throws<BadStatusException>(() => BatchingInferenceService.Configure(8, -1));
+      Assert.AreEqual(StatusCode.InvalidArgument, exception.statusCode);
+    }
+
+    [Test]
+    public void Configure_ShouldNotThrow_When_WindowIsValid()
+    {
+      Assert.DoesNotThrow(() => BatchingInferenceService.Configure(8, 2000));
+    }
+    #endregion
+
+    #region GetStats
+    [Test]
+    public void GetStats_ShouldReturnEmptyHistograms_When_Reset()
+    {
+      BatchingInferenceService.ResetStats();
+      var stats = BatchingInferenceService.GetStats();
+
+      Assert.AreEqual(0, stats.requests);
+      Assert.AreEqual(0, stats.batches);
+      Assert.AreEqual(16, stats.batchSizeCounts.Length);
+      Assert.AreEqual(BatchingInferenceStats.LatencyBucketUpperBoundsMicrosec.Length + 1, stats.latencyCounts.Length);
+    }
+    #endregion
+  }
+}
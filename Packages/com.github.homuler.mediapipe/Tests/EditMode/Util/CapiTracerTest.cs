@@ -0,0 +1,116 @@
+// Copyright (c) 2026 homuler
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+using System.IO;
+using System.Linq;
+using NUnit.Framework;
+
+namespace Mediapipe.Tests
+{
+  public class CapiTracerTest
+  {
+    [TearDown]
+    public void TearDown()
+    {
+      CapiTracer.tracing = false;
+      CapiTracer.ResetStats();
+    }
+
+    [Test]
+    public void GetStats_ShouldCountCalls()
+    {
+      CapiTracer.ResetStats();
+
+      for (var i = 0; i < 3; i++)
+      {
+        using (var graph = new CalculatorGraph())
+        {
+        }
+      }
+
+      var stats = CapiTracer.GetStats();
+      if (!CapiTracer.isEnabled)
+      {
+        Assert.IsEmpty(stats);
+        Assert.Ignore("The native library is built without --trace_capi");
+      }
+      var constructorStats = stats.Single((x) => x.name == "mp_CalculatorGraph__");
+      Assert.AreEqual(3, constructorStats.calls);
+      Assert.GreaterOrEqual(constructorStats.totalNs, 0);
+    }
+
+    [Test]
+    public void GetStats_ShouldNameTheExportedFunction_When_FunctionTemplateIsCalled()
+    {
+      CapiTracer.ResetStats();
+
+      using (var packet = Packet.CreateFloatVector(new float[] { 0f, 1f }))
+      {
+        _ = packet.Get();
+      }
+
+      var stats = CapiTracer.GetStats();
+      if (!CapiTracer.isEnabled)
+      {
+        Assert.IsEmpty(stats);
+        Assert.Ignore("The native library is built without --trace_capi");
+      }
+      Assert.AreEqual(1, stats.Single((x) => x.name == "mp__MakeFloatVectorPacket__Pf_i").calls);
+      Assert.AreEqual(1, stats.Single((x) => x.name == "mp_Packet__GetFloatVector").calls);
+      Assert.False(stats.Any((x) => x.name.Contains("[with")));
+    }
+
+    [Test]
+    public void ResetStats_ShouldClearStats()
+    {
+      using (var graph = new CalculatorGraph())
+      {
+      }
+      CapiTracer.ResetStats();
+
+      Assert.IsEmpty(CapiTracer.GetStats());
+    }
+
+    [Test]
+    public void Tracing_ShouldBeFalse_When_Disabled()
+    {
+      if (CapiTracer.isEnabled)
+      {
+        Assert.Ignore("The native library is built with --trace_capi");
+      }
+      CapiTracer.tracing = true;
+
+      Assert.False(CapiTracer.tracing);
+    }
+
+    [Test]
+    public void WriteTrace_ShouldWriteChromeTrace()
+    {
+      var path = Path.Combine(Path.GetTempPath(), $"{nameof(CapiTracerTest)}_{nameof(WriteTrace_ShouldWriteChromeTrace)}.json");
+      CapiTracer.tracing = true;
+      using (var graph = new CalculatorGraph())
+      {
+      }
+      CapiTracer.tracing = false;
+
+      try
+      {
+        CapiTracer.WriteTrace(path);
+
+        var trace = File.ReadAllText(path);
+        StringAssert.StartsWith("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[", trace);
+        if (CapiTracer.isEnabled)
+        {
+          StringAssert.Contains("\"name\":\"mp_CalculatorGraph__\"", trace);
+        }
+      }
+      finally
+      {
+        File.Delete(path);
+      }
+    }
+  }
+}
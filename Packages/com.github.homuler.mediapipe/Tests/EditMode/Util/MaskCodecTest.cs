@@ -0,0 +1,144 @@
+// Copyright (c) 2026 homuler
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+using NUnit.Framework;
+using Unity.Collections;
+
+namespace Mediapipe.Tests
+{
+  public class MaskCodecTest
+  {
+    private static readonly float[] _Confidences = new float[] {
+      0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+      0.0f, 1.0f, 1.0f, 1.0f, 0.0f,
+      0.0f, 1.0f, 1.0f, 1.0f, 0.0f,
+    };
+
+    #region GetMaxEncodedSize
+    [Test]
+    public void GetMaxEncodedSize_ShouldReturnMinusOne_When_BitsIsInvalid()
+    {
+      Assert.AreEqual(-1, MaskCodec.GetMaxEncodedSize(5, 3, MaskEncoding.BitPacked, 3));
+    }
+
+    [Test]
+    public void GetMaxEncodedSize_ShouldReturnPackedSize_When_EncodingIsBitPacked()
+    {
+      Assert.AreEqual(20 + 2, MaskCodec.GetMaxEncodedSize(5, 3, MaskEncoding.BitPacked, 1));
+    }
+    #endregion
+
+    #region Encode
+    [Test]
+    public void Encode_ShouldThrowBadStatusException_When_BufferSizeIsTooSmall()
+    {
+      using var packet = BuildConfidenceMaskPacket(5, 3, _Confidences);
+      var buffer = new byte[MaskCodec.GetMaxEncodedSize(5, 3, MaskEncoding.RunLength, 8) - 1];
+
+#pragma warning disable IDE0058
+      Assert.Throws<BadStatusException>(() => { MaskCodec.Encode(packet, MaskEncoding.RunLength, 8, buffer); });
+#pragma warning restore IDE0058
+    }
+
+    [Test]
+    public void Encode_ShouldThrowBadStatusException_When_PacketIsNotMask()
+    {
+      using var packet = Packet.CreateInt(1);
+      var buffer = new byte[100];
+
+#pragma warning disable IDE0058
+      Assert.Throws<BadStatusException>(() => { MaskCodec.Encode(packet, MaskEncoding.RunLength, 8, buffer); });
+#pragma warning restore IDE0058
+    }
+
+    [Test]
+    public void Encode_ShouldWriteHeader()
+    {
+      using var packet = BuildConfidenceMaskPacket(5, 3, _Confidences);
+      var buffer = new byte[MaskCodec.GetMaxEncodedSize(5, 3, MaskEncoding.RunLength, 1)];
+      var size = MaskCodec.Encode(packet, MaskEncoding.RunLength, 1, buffer);
+
+      var header = MaskCodec.ReadHeader(buffer, size);
+      Assert.AreEqual(5, header.width);
+      Assert.AreEqual(3, header.height);
+      Assert.AreEqual(MaskEncoding.RunLength, header.encoding);
+      Assert.AreEqual(1, header.bits);
+      Assert.True(header.isConfidence);
+      Assert.AreEqual(size - 20, header.payloadSize);
+    }
+    #endregion
+
+    #region Decode
+    [Test]
+    public void Decode_ShouldRestoreConfidenceMask([Values(MaskEncoding.BitPacked, MaskEncoding.RunLength)] MaskEncoding encoding, [Values(1, 2, 4, 8)] int bits)
+    {
+      using var packet = BuildConfidenceMaskPacket(5, 3, _Confidences);
+      var buffer = new byte[MaskCodec.GetMaxEncodedSize(5, 3, encoding, bits)];
+      var size = MaskCodec.Encode(packet, encoding, bits, buffer);
+
+      var mask = new byte[15];
+      MaskCodec.Decode(buffer, size, mask);
+
+      for (var i = 0; i < mask.Length; i++)
+      {
+        Assert.AreEqual(_Confidences[i] == 0 ? 0 : 255, mask[i]);
+      }
+    }
+
+    [Test]
+    public void Decode_ShouldRestoreCategoryMask([Values(MaskEncoding.BitPacked, MaskEncoding.RunLength)] MaskEncoding encoding)
+    {
+      var categories = new byte[] { 0, 0, 1, 1, 2, 2, 3, 3, 3 };
+      var pixelData = new NativeArray<byte>(categories, Allocator.Temp);
+      using var packet = Packet.CreateImageFrame(new ImageFrame(ImageFormat.Types.Format.Gray8, 3, 3, 3, pixelData));
+      var buffer = new byte[MaskCodec.GetMaxEncodedSize(3, 3, encoding, 2)];
+      var size = MaskCodec.EncodeCategory(packet, encoding, 2, buffer);
+
+      var mask = new NativeArray<byte>(9, Allocator.Temp);
+      MaskCodec.Decode(buffer, size, mask);
+
+      Assert.AreEqual(categories, mask.ToArray());
+      Assert.False(MaskCodec.ReadHeader(buffer, size).isConfidence);
+      mask.Dispose();
+    }
+
+    [Test]
+    public void Decode_ShouldRestoreByteConfidenceMask([Values(MaskEncoding.BitPacked, MaskEncoding.RunLength)] MaskEncoding encoding)
+    {
+      var confidences = new byte[] { 0, 60, 100, 160, 255, 255 };
+      var pixelData = new NativeArray<byte>(confidences, Allocator.Temp);
+      using var packet = Packet.CreateImageFrame(new ImageFrame(ImageFormat.Types.Format.Gray8, 3, 2, 3, pixelData));
+      var buffer = new byte[MaskCodec.GetMaxEncodedSize(3, 2, encoding, 1)];
+      var size = MaskCodec.Encode(packet, encoding, 1, buffer);
+
+      var mask = new byte[6];
+      MaskCodec.Decode(buffer, size, mask);
+
+      Assert.AreEqual(new byte[] { 0, 0, 0, 255, 255, 255 }, mask);
+      Assert.True(MaskCodec.ReadHeader(buffer, size).isConfidence);
+    }
+
+    [Test]
+    public void Decode_ShouldThrowBadStatusException_When_DataIsTruncated()
+    {
+      using var packet = BuildConfidenceMaskPacket(5, 3, _Confidences);
+      var buffer = new byte[MaskCodec.GetMaxEncodedSize(5, 3, MaskEncoding.RunLength, 8)];
+      var size = MaskCodec.Encode(packet, MaskEncoding.RunLength, 8, buffer);
+
+#pragma warning disable IDE0058
+      Assert.Throws<BadStatusException>(() => { MaskCodec.Decode(buffer, size - 1, new byte[15]); });
+#pragma warning restore IDE0058
+    }
+    #endregion
+
+    private Packet<ImageFrame> BuildConfidenceMaskPacket(int width, int height, float[] confidences)
+    {
+      var pixelData = new NativeArray<float>(confidences, Allocator.Temp);
+      var imageFrame = new ImageFrame(ImageFormat.Types.Format.Vec32F1, width, height, 4 * width, pixelData.Reinterpret<byte>(sizeof(float)));
+      return Packet.CreateImageFrame(imageFrame);
+    }
+  }
+}
@@ -0,0 +1,108 @@
+// Copyright (c) 2026 homuler
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+using System.Linq;
+using NUnit.Framework;
+using Unity.Collections;
+using UnityEngine;
+
+namespace Mediapipe.Tests
+{
+  public class MaskCompositorTest
+  {
+    #region Composite
+    [Test]
+    public void Composite_ShouldFillBackgroundColor_When_MaskIsNotSet()
+    {
+      using var foreground = BuildImageFrame(4, 2, 10);
+      using var mask = BuildMaskPacket(4, 2, 0.0f);
+      var buffer = new byte[32];
+
+      MaskCompositor.Composite(foreground, mask, new Color32(1, 2, 3, 4), buffer);
+
+      for (var i = 0; i < 8; i++)
+      {
+        Assert.AreEqual(new byte[] { 1, 2, 3, 4 }, buffer.Skip(4 * i).Take(4).ToArray());
+      }
+    }
+
+    [Test]
+    public void Composite_ShouldKeepForeground_When_MaskIsSet()
+    {
+      using var foreground = BuildImageFrame(4, 2, 10);
+      using var background = BuildImageFrame(4, 2, 200);
+      using var mask = BuildMaskPacket(2, 1, 1.0f);
+      var buffer = new byte[32];
+
+      MaskCompositor.Composite(foreground, mask, background, buffer, featherRadius: 1);
+
+      Assert.True(buffer.All((x) => x == 10));
+    }
+
+    [Test]
+    public void Composite_ShouldDrawBackground_When_Inverted()
+    {
+      using var foreground = BuildImageFrame(4, 2, 10);
+      using var background = BuildImageFrame(4, 2, 200);
+      using var mask = BuildMaskPacket(4, 2, 1.0f);
+      var buffer = new NativeArray<byte>(32, Allocator.Temp);
+
+      MaskCompositor.Composite(foreground, mask, background, buffer, invert: true);
+
+      Assert.True(buffer.All((x) => x == 200));
+      buffer.Dispose();
+    }
+
+    [Test]
+    public void Composite_ShouldBlendWithAlpha()
+    {
+      using var foreground = BuildImageFrame(4, 2, 200);
+      using var background = BuildImageFrame(4, 2, 100);
+      using var mask = BuildMaskPacket(4, 2, 0.5f);
+      var buffer = new byte[32];
+
+      MaskCompositor.Composite(foreground, mask, background, buffer);
+
+      Assert.True(buffer.All((x) => x == 150));
+    }
+
+    [Test]
+    public void Composite_ShouldThrowBadStatusException_When_BufferSizeIsTooSmall()
+    {
+      using var foreground = BuildImageFrame(4, 2, 10);
+      using var mask = BuildMaskPacket(4, 2, 0.0f);
+
+#pragma warning disable IDE0058
+      Assert.Throws<BadStatusException>(() => { MaskCompositor.Composite(foreground, mask, new Color32(), new byte[31]); });
+#pragma warning restore IDE0058
+    }
+
+    [Test]
+    public void Composite_ShouldThrowBadStatusException_When_SizeIsDifferent()
+    {
+      using var foreground = BuildImageFrame(4, 2, 10);
+      using var background = BuildImageFrame(2, 2, 10);
+      using var mask = BuildMaskPacket(4, 2, 0.0f);
+
+#pragma warning disable IDE0058
+      Assert.Throws<BadStatusException>(() => { MaskCompositor.Composite(foreground, mask, background, new byte[32]); });
+#pragma warning restore IDE0058
+    }
+    #endregion
+
+    private ImageFrame BuildImageFrame(int width, int height, byte value)
+    {
+      var pixelData = new NativeArray<byte>(Enumerable.Repeat(value, 4 * width * height).ToArray(), Allocator.Temp);
+      return new ImageFrame(ImageFormat.Types.Format.Srgba, width, height, 4 * width, pixelData);
+    }
+
+    private Packet<ImageFrame> BuildMaskPacket(int width, int height, float confidence)
+    {
+      var pixelData = new NativeArray<float>(Enumerable.Repeat(confidence, width * height).ToArray(), Allocator.Temp);
+      return Packet.CreateImageFrame(new ImageFrame(ImageFormat.Types.Format.Vec32F1, width, height, 4 * width, pixelData.Reinterpret<byte>(sizeof(float))));
+    }
+  }
+}
@@ -0,0 +1,42 @@
+// Copyright (c) 2026 homuler
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+using NUnit.Framework;
+
+namespace Mediapipe.Tests
+{
+  public class ResourceCacheTest
+  {
+    [TearDown]
+    public void TearDown()
+    {
+      ResourceCache.capacity = 0;
+    }
+
+    #region capacity
+    [Test]
+    public void Capacity_ShouldClearTheCache_When_ItIsSetToZero()
+    {
+      ResourceCache.capacity = 1024;
+      Assert.AreEqual(1024, ResourceCache.capacity);
+
+      ResourceCache.capacity = 0;
+      Assert.AreEqual(0, ResourceCache.capacity);
+      Assert.AreEqual(0, ResourceCache.GetStats().entries);
+      Assert.AreEqual(0, ResourceCache.GetStats().bytes);
+    }
+    #endregion
+
+    #region Prefetch
+    [Test]
+    public void Prefetch_ShouldThrowException_When_TheCacheIsDisabled()
+    {
+      var exception = Assert.Throws<BadStatusException>(() => ResourceCache.Prefetch("face_detection_short_range.tflite"));
+      Assert.AreEqual(StatusCode.FailedPrecondition, exception.statusCode);
+    }
+    #endregion
+  }
+}
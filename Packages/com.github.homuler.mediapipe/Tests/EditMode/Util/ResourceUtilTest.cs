@@ -0,0 +1,39 @@
+// Copyright (c) 2026 homuler
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+using System.IO;
+using NUnit.Framework;
+
+namespace Mediapipe.Tests
+{
+  public class ResourceUtilTest
+  {
+    #region SetAssetBundle
+    [Test]
+    public void SetAssetBundle_ShouldThrowException_When_TheFileDoesNotExist()
+    {
+      var exception = Assert.Throws<BadStatusException>(() => ResourceUtil.SetAssetBundle(Path.Combine(Path.GetTempPath(), "not_found.bin")));
+      Assert.AreEqual(StatusCode.NotFound, exception.statusCode);
+    }
+
+    [Test]
+    public void SetAssetBundle_ShouldThrowException_When_TheFileIsNotAnAssetBundle()
+    {
+      var filePath = Path.GetTempFileName();
+      File.WriteAllBytes(filePath, new byte[128]);
+      try
+      {
+        var exception = Assert.Throws<BadStatusException>(() => ResourceUtil.SetAssetBundle(filePath));
+        Assert.AreEqual(StatusCode.InvalidArgument, exception.statusCode);
+      }
+      finally
+      {
+        File.Delete(filePath);
+      }
+    }
+    #endregion
+  }
+}
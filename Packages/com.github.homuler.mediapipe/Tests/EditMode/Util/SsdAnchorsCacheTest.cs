@@ -0,0 +1,84 @@
+// Copyright (c) 2026 homuler
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+using System.Linq;
+using NUnit.Framework;
+
+namespace Mediapipe.Tests
+{
+  public class SsdAnchorsCacheTest
+  {
+    private const string _FaceDetectionShortRangeConfigText = @"
+input_stream: ""image""
+input_stream: ""roi""
+
+node {
+  calculator: ""FaceDetectionShortRange""
+  input_stream: ""IMAGE:image""
+  input_stream: ""ROI:roi""
+  output_stream: ""DETECTIONS:detections""
+}
+";
+
+    [SetUp]
+    public void SetUp()
+    {
+      ExpandedConfigCache.enabled = true;
+      ExpandedConfigCache.Clear();
+    }
+
+    [TearDown]
+    public void TearDown()
+    {
+      SsdAnchorsCache.enabled = false;
+      SsdAnchorsCache.Clear();
+      ExpandedConfigCache.enabled = false;
+      ExpandedConfigCache.Clear();
+    }
+
+    #region enabled
+    [Test]
+    public void Enabled_ShouldReplaceSsdAnchorsCalculator_When_TheConfigIsExpanded()
+    {
+      SsdAnchorsCache.enabled = true;
+      var config = CalculatorGraphConfig.Parser.ParseFromTextFormat(_FaceDetectionShortRangeConfigText);
+
+      using (var validatedConfig = new ValidatedGraphConfig())
+      {
+        validatedConfig.Initialize(config);
+        var calculators = validatedConfig.Config().Node.Select(node => node.Calculator).ToList();
+
+        Assert.Contains("CachedSsdAnchorsCalculator", calculators);
+        Assert.False(calculators.Contains("SsdAnchorsCalculator"));
+      }
+    }
+
+    [Test]
+    public void Enabled_ShouldNotReplaceSsdAnchorsCalculator_When_ItIsFalse()
+    {
+      var config = CalculatorGraphConfig.Parser.ParseFromTextFormat(_FaceDetectionShortRangeConfigText);
+
+      using (var validatedConfig = new ValidatedGraphConfig())
+      {
+        validatedConfig.Initialize(config);
+        var calculators = validatedConfig.Config().Node.Select(node => node.Calculator).ToList();
+
+        Assert.Contains("SsdAnchorsCalculator", calculators);
+        Assert.False(calculators.Contains("CachedSsdAnchorsCalculator"));
+      }
+    }
+    #endregion
+
+    #region GetStats
+    [Test]
+    public void GetStats_ShouldReturnNoEntries_When_Cleared()
+    {
+      SsdAnchorsCache.Clear();
+      Assert.AreEqual(0, SsdAnchorsCache.GetStats().entries);
+    }
+    #endregion
+  }
+}
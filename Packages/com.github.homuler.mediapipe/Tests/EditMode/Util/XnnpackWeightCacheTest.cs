@@ -0,0 +1,48 @@
+// Copyright (c) 2026 homuler
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+using System.IO;
+using NUnit.Framework;
+
+namespace Mediapipe.Tests
+{
+  public class XnnpackWeightCacheTest
+  {
+    [TearDown]
+    public void TearDown()
+    {
+      XnnpackWeightCache.SetDirectory(null);
+    }
+
+    #region SetDirectory
+    [Test]
+    public void SetDirectory_ShouldThrowBadStatusException_When_TheDirectoryDoesNotExist()
+    {
+      var exception = Assert.Throws<BadStatusException>(() => XnnpackWeightCache.SetDirectory(Path.Combine(Path.GetTempPath(), "not_found_xnnpack_cache")));
+      Assert.AreEqual(StatusCode.NotFound, exception.statusCode);
+    }
+
+    [Test]
+    public void SetDirectory_ShouldNotThrow_When_TheDirectoryExists()
+    {
+      Assert.DoesNotThrow(() => XnnpackWeightCache.SetDirectory(Path.GetTempPath()));
+    }
+    #endregion
+
+    #region GetStats
+    [Test]
+    public void GetStats_ShouldReturnZeros_When_Reset()
+    {
+      XnnpackWeightCache.ResetStats();
+      var stats = XnnpackWeightCache.GetStats();
+
+      Assert.AreEqual(0, stats.hits);
+      Assert.AreEqual(0, stats.misses);
+      Assert.AreEqual(0, stats.bytesSaved);
+    }
+    #endregion
+  }
+}
@@ -136,6 +136,11 @@ class BuildCommand(Command):
         os.path.join(_BAZEL_BIN_PATH, 'mediapipe_api', 'mediapipe_assets.zip'),
         _STREAMING_ASSETS_PATH)
 
+      if self.command_args.resources_bundle:
+        self._copy(
+          os.path.join(_BAZEL_BIN_PATH, 'mediapipe_api', 'mediapipe_asset_bundle.bin'),
+          os.path.join(_STREAMING_ASSETS_PATH, 'mediapipe_asset_bundle.bin'))
+
       self.console.info('Built resource files')
 
     if self.command_args.desktop:
@@ -221,6 +226,7 @@ class BuildCommand(Command):
 
     commands += self.command_args.bazel_build_opts or []
     commands += self._build_solution_options()
+    commands += self._build_diagnostic_options()
 
     return commands
 
@@ -252,6 +258,18 @@ class BuildCommand(Command):
 
     return [f'--//mediapipe_api:solutions={",".join(self.command_args.solutions)}']
 
+  def _build_diagnostic_options(self):
+    commands = []
+
+    if self.command_args.trace_capi:
+      commands += ['--//mediapipe_api:trace_capi']
+
+    if self.command_args.profiling:
+      # NOTE: the MediaPipe profiler is compiled out on mobile platforms by default.
+      commands += ['--copt', '-DMEDIAPIPE_PROFILING=1']
+
+    return commands
+
   def _build_desktop_options(self):
     commands = []
 
@@ -309,6 +327,8 @@ class BuildCommand(Command):
 
     commands = self._build_common_commands()
     commands.append('//mediapipe_api:mediapipe_assets')
+    if self.command_args.resources_bundle:
+      commands.append('//mediapipe_api:mediapipe_asset_bundle')
     return commands
 
   def _build_proto_srcs_commands(self):
@@ -431,6 +451,8 @@ class Argument:
     build_command_parser.add_argument('--android_ndk_api_level', type=int, choices=range(16, 31))
     build_command_parser.add_argument('--ios', choices=['arm64'])
     build_command_parser.add_argument('--resources', action=argparse.BooleanOptionalAction, default=True)
+    build_command_parser.add_argument('--resources_bundle', action=argparse.BooleanOptionalAction, default=False,
+                                      help='Pack the resource files into a single file that can be memory-mapped (see ResourceUtil.SetAssetBundle)')
     build_command_parser.add_argument('--analyzers', action=argparse.BooleanOptionalAction, default=False, help='Install Roslyn Analyzers')
     build_command_parser.add_argument('--compilation_mode', '-c', choices=['fastbuild', 'opt', 'dbg'], default='opt')
     build_command_parser.add_argument('--opencv', choices=['local', 'cmake'], default='local', help='Decide to which OpenCV to link for Desktop native libraries')
@@ -439,6 +461,10 @@ class Argument:
                  'image_segmentation', 'object_detection', 'gesture_recognition', 'audio_classification'])
     build_command_parser.add_argument('--linkopt', '-l', action='append', help='Linker options')
     build_command_parser.add_argument('--macos_universal', action=argparse.BooleanOptionalAction, default=False, help='Build a universal library')
+    build_command_parser.add_argument('--trace_capi', action=argparse.BooleanOptionalAction, default=False,
+                                      help='Measure the C API calls in the native library (see CapiTracer)')
+    build_command_parser.add_argument('--profiling', action=argparse.BooleanOptionalAction, default=False,
+                                      help='Compile the MediaPipe graph profiler into the native library on Android and iOS (see GraphProfiling)')
     build_command_parser.add_argument('--bazel_startup_opts', action='append', help='Bazel startup options')
     build_command_parser.add_argument('--bazel_build_opts', action='append', help='Bazel startup options')
     build_command_parser.add_argument('--verbose', '-v', action='count', default=0)
@@ -0,0 +1,58 @@
+// Copyright (c) 2026 homuler
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+#include <memory>
+
+#include "absl/status/status.h"
+#include "mediapipe/framework/calculator_framework.h"
+#include "mediapipe/framework/tool/status_util.h"
+#include "mediapipe_api/framework/startup_profiler.h"
+
+namespace mediapipe {
+
+// Passes the profiler of the graph to the startup profile, so that Open and the first Process of the calculators can be captured
+// when the graph is not exposed, e.g. in TaskRunner. It's added by mp_api::ScopedStartupProfile::EnableTaskTracing.
+//
+// Input side packets:
+//   std::shared_ptr<mp_api::StartupProfile>
+//
+// Example:
+// node {
+//   name: "__startup_trace"
+//   calculator: "StartupTraceCalculator"
+//   input_side_packet: "__startup_profile"
+// }
+class StartupTraceCalculator : public CalculatorBase {
+ public:
+  static absl::Status GetContract(CalculatorContract* cc) {
+    cc->InputSidePackets().Index(0).Set<std::shared_ptr<mp_api::StartupProfile>>();
+    return absl::OkStatus();
+  }
+
+  ~StartupTraceCalculator() override {
+    // NOTE: the calculator is destroyed before the profiler, which is owned by the graph.
+    if (profile_ != nullptr) {
+      profile_->SetProfiler(nullptr);
+    }
+  }
+
+  absl::Status Open(CalculatorContext* cc) override {
+    profile_ = cc->InputSidePackets().Index(0).Get<std::shared_ptr<mp_api::StartupProfile>>();
+    if (profile_ != nullptr) {
+      profile_->SetProfiler(cc->GetProfilingContext());
+    }
+    return absl::OkStatus();
+  }
+
+  // NOTE: it's a source node without any outputs, so it stops immediately.
+  absl::Status Process(CalculatorContext* cc) override { return tool::StatusStop(); }
+
+ private:
+  std::shared_ptr<mp_api::StartupProfile> profile_;
+};
+REGISTER_CALCULATOR(StartupTraceCalculator);
+
+}  // namespace mediapipe
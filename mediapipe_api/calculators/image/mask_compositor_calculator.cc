@@ -0,0 +1,120 @@
+// Copyright (c) 2026 homuler
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+#include <memory>
+
+#include "absl/status/status.h"
+#include "mediapipe/framework/calculator_framework.h"
+#include "mediapipe/framework/formats/image_frame.h"
+#include "mediapipe/framework/port/ret_check.h"
+#include "mediapipe/framework/port/status_macros.h"
+#include "mediapipe/util/color.pb.h"
+#include "mediapipe_api/util/mask_codec.h"
+#include "mediapipe_api/util/mask_compositor.h"
+
+namespace mediapipe {
+
+namespace {
+
+constexpr char kImageTag[] = "IMAGE";
+constexpr char kMaskTag[] = "MASK";
+constexpr char kBackgroundTag[] = "BACKGROUND";
+constexpr char kBackgroundColorTag[] = "BACKGROUND_COLOR";
+constexpr char kFeatherRadiusTag[] = "FEATHER_RADIUS";
+constexpr char kInvertTag[] = "INVERT";
+
+}  // namespace
+
+// Blends the input image over the background using the segmentation mask as alpha.
+//
+// Inputs:
+//   IMAGE: ImageFrame (SRGB or SRGBA).
+//   MASK: ImageFrame or Image (VEC32F1 or GRAY8) on CPU. It will be resized to the size of IMAGE.
+//   BACKGROUND (optional): ImageFrame with the same format and size as IMAGE.
+//
+// Input side packets:
+//   BACKGROUND_COLOR (optional): Color, which is used when BACKGROUND is not connected or empty. The default is black.
+//   FEATHER_RADIUS (optional): int, the radius of the box filter applied to the mask. The default is 0.
+//   INVERT (optional): bool, if true, the background is drawn where the mask is set.
+//
+// Outputs:
+//   IMAGE: ImageFrame with the same format as the input IMAGE.
+//
+// Example:
+// node {
+//   calculator: "MaskCompositorCalculator"
+//   input_stream: "IMAGE:input_video"
+//   input_stream: "MASK:segmentation_mask"
+//   input_side_packet: "BACKGROUND_COLOR:background_color"
+//   output_stream: "IMAGE:output_video"
+// }
+class MaskCompositorCalculator : public CalculatorBase {
+ public:
+  static absl::Status GetContract(CalculatorContract* cc) {
+    cc->Inputs().Tag(kImageTag).Set<ImageFrame>();
+    cc->Inputs().Tag(kMaskTag).SetAny();
+    if (cc->Inputs().HasTag(kBackgroundTag)) {
+      cc->Inputs().Tag(kBackgroundTag).Set<ImageFrame>();
+    }
+    if (cc->InputSidePackets().HasTag(kBackgroundColorTag)) {
+      cc->InputSidePackets().Tag(kBackgroundColorTag).Set<Color>();
+    }
+    if (cc->InputSidePackets().HasTag(kFeatherRadiusTag)) {
+      cc->InputSidePackets().Tag(kFeatherRadiusTag).Set<int>();
+    }
+    if (cc->InputSidePackets().HasTag(kInvertTag)) {
+      cc->InputSidePackets().Tag(kInvertTag).Set<bool>();
+    }
+    cc->Outputs().Tag(kImageTag).Set<ImageFrame>();
+    return absl::OkStatus();
+  }
+
+  absl::Status Open(CalculatorContext* cc) override {
+    cc->SetOffset(TimestampDiff(0));
+
+    options_.background_color[0] = 0;
+    options_.background_color[1] = 0;
+    options_.background_color[2] = 0;
+    options_.background_color[3] = 255;
+    if (cc->InputSidePackets().HasTag(kBackgroundColorTag)) {
+      const auto& color = cc->InputSidePackets().Tag(kBackgroundColorTag).Get<Color>();
+      options_.background_color[0] = static_cast<uint8_t>(color.r());
+      options_.background_color[1] = static_cast<uint8_t>(color.g());
+      options_.background_color[2] = static_cast<uint8_t>(color.b());
+    }
+    options_.feather_radius = cc->InputSidePackets().HasTag(kFeatherRadiusTag) ? cc->InputSidePackets().Tag(kFeatherRadiusTag).Get<int>() : 0;
+    options_.invert = cc->InputSidePackets().HasTag(kInvertTag) && cc->InputSidePackets().Tag(kInvertTag).Get<bool>();
+    RET_CHECK_GE(options_.feather_radius, 0);
+
+    return absl::OkStatus();
+  }
+
+  absl::Status Process(CalculatorContext* cc) override {
+    if (cc->Inputs().Tag(kImageTag).IsEmpty() || cc->Inputs().Tag(kMaskTag).IsEmpty()) {
+      return absl::OkStatus();
+    }
+
+    const auto& image = cc->Inputs().Tag(kImageTag).Get<ImageFrame>();
+    MP_ASSIGN_OR_RETURN(auto mask, mp_api::GetMaskImageFrame(cc->Inputs().Tag(kMaskTag).Value()));
+
+    const ImageFrame* background = nullptr;
+    if (cc->Inputs().HasTag(kBackgroundTag) && !cc->Inputs().Tag(kBackgroundTag).IsEmpty()) {
+      background = &cc->Inputs().Tag(kBackgroundTag).Get<ImageFrame>();
+    }
+
+    auto output = std::make_unique<ImageFrame>(image.Format(), image.Width(), image.Height());
+    MP_RETURN_IF_ERROR(mp_api::CompositeMask(image, background, *mask, options_, output->MutablePixelData(), output->WidthStep()));
+
+    cc->Outputs().Tag(kImageTag).Add(output.release(), cc->InputTimestamp());
+    return absl::OkStatus();
+  }
+
+ private:
+  mp_api::MaskCompositeOptions options_;
+};
+REGISTER_CALCULATOR(MaskCompositorCalculator);
+
+}  // namespace mediapipe
@@ -0,0 +1,91 @@
+// Copyright (c) 2026 homuler
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+#include <memory>
+#include <vector>
+
+#include "absl/status/status.h"
+#include "mediapipe/calculators/tensor/inference_calculator.pb.h"
+#include "mediapipe/framework/calculator_framework.h"
+#include "mediapipe/framework/formats/tensor.h"
+#include "mediapipe/framework/port/ret_check.h"
+#include "mediapipe/framework/port/status_macros.h"
+#include "mediapipe_api/util/batching_inference_service.h"
+
+namespace mediapipe {
+
+namespace {
+
+constexpr char kTensorsTag[] = "TENSORS";
+
+}  // namespace
+
+// Runs a TFLite model on CPU through the process-wide BatchingInferenceService,
+// so that the requests for the same model from multiple graphs are run together.
+//
+// Process blocks until the batch containing the input is run, which takes up to the batching window
+// (see mp_BatchingInferenceService__Configure__i_ll) longer than InferenceCalculator.
+//
+// Inputs:
+//   TENSORS: std::vector<Tensor>. Each tensor must have the shape of the model input for a single request.
+//
+// Outputs:
+//   TENSORS: std::vector<Tensor>.
+//
+// Options:
+//   InferenceCalculatorOptions. Only `model_path` is used.
+//
+// Example:
+// node {
+//   calculator: "BatchedInferenceCalculator"
+//   input_stream: "TENSORS:input_tensors"
+//   output_stream: "TENSORS:output_tensors"
+//   options: {
+//     [mediapipe.InferenceCalculatorOptions.ext] {
+//       model_path: "face_detection_short_range.tflite"
+//     }
+//   }
+// }
+class BatchedInferenceCalculator : public CalculatorBase {
+ public:
+  static absl::Status GetContract(CalculatorContract* cc) {
+    RET_CHECK(!cc->Options<InferenceCalculatorOptions>().model_path().empty()) << "model_path must be specified";
+    cc->Inputs().Tag(kTensorsTag).Set<std::vector<Tensor>>();
+    cc->Outputs().Tag(kTensorsTag).Set<std::vector<Tensor>>();
+    return absl::OkStatus();
+  }
+
+  absl::Status Open(CalculatorContext* cc) override {
+    cc->SetOffset(TimestampDiff(0));
+
+    const auto& model_path = cc->Options<InferenceCalculatorOptions>().model_path();
+    MP_ASSIGN_OR_RETURN(model_, mp_api::BatchingInferenceService::GetInstance().Acquire(model_path));
+    return absl::OkStatus();
+  }
+
+  absl::Status Process(CalculatorContext* cc) override {
+    if (cc->Inputs().Tag(kTensorsTag).IsEmpty()) {
+      return absl::OkStatus();
+    }
+
+    const auto& inputs = cc->Inputs().Tag(kTensorsTag).Get<std::vector<Tensor>>();
+    MP_ASSIGN_OR_RETURN(auto outputs, model_->Run(inputs));
+
+    cc->Outputs().Tag(kTensorsTag).Add(new std::vector<Tensor>(std::move(outputs)), cc->InputTimestamp());
+    return absl::OkStatus();
+  }
+
+  absl::Status Close(CalculatorContext* cc) override {
+    model_.reset();
+    return absl::OkStatus();
+  }
+
+ private:
+  std::shared_ptr<mp_api::BatchingInferenceService::Model> model_;
+};
+REGISTER_CALCULATOR(BatchedInferenceCalculator);
+
+}  // namespace mediapipe
@@ -0,0 +1,56 @@
+// Copyright (c) 2026 homuler
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+#include <memory>
+#include <vector>
+
+#include "absl/status/status.h"
+#include "mediapipe/calculators/tflite/ssd_anchors_calculator.pb.h"
+#include "mediapipe/framework/calculator_framework.h"
+#include "mediapipe/framework/formats/object_detection/anchor.pb.h"
+#include "mediapipe/framework/port/status_macros.h"
+#include "mediapipe_api/calculators/tflite/ssd_anchors_cache.h"
+
+namespace mediapipe {
+
+// A drop-in replacement of SsdAnchorsCalculator, which shares the anchors generated for the same options among the graphs
+// (see mp_api::SsdAnchorsCache), instead of generating them every time the graph starts.
+//
+// Output side packets:
+//   std::vector<Anchor>, which must not be modified.
+//
+// Example:
+// node {
+//   calculator: "CachedSsdAnchorsCalculator"
+//   output_side_packet: "anchors"
+//   options {
+//     [mediapipe.SsdAnchorsCalculatorOptions.ext] {
+//       ...
+//     }
+//   }
+// }
+class CachedSsdAnchorsCalculator : public CalculatorBase {
+ public:
+  static absl::Status GetContract(CalculatorContract* cc) {
+    cc->OutputSidePackets().Index(0).Set<std::vector<Anchor>>();
+    return absl::OkStatus();
+  }
+
+  absl::Status Open(CalculatorContext* cc) override {
+    cc->SetOffset(TimestampDiff(0));
+
+    MP_ASSIGN_OR_RETURN(auto anchors, mp_api::SsdAnchorsCache::GetInstance().GetAnchors(cc->Options<SsdAnchorsCalculatorOptions>()));
+    // NOTE: the packet keeps the cached anchors alive without copying them, even if the cache is cleared.
+    const auto* anchors_ptr = anchors.get();
+    cc->OutputSidePackets().Index(0).Set(PointToForeign(anchors_ptr, [anchors = std::move(anchors)]() {}));
+    return absl::OkStatus();
+  }
+
+  absl::Status Process(CalculatorContext* cc) override { return absl::OkStatus(); }
+};
+REGISTER_CALCULATOR(CachedSsdAnchorsCalculator);
+
+}  // namespace mediapipe
@@ -0,0 +1,227 @@
+// Copyright (c) 2026 homuler
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+#include "mediapipe_api/calculators/tflite/ssd_anchors_cache.h"
+
+#include <cstring>
+#include <fstream>
+#include <optional>
+#include <utility>
+
+#include "absl/strings/str_format.h"
+#include "mediapipe/framework/calculator_base.h"
+#include "mediapipe/framework/calculator_graph.h"
+#include "mediapipe/framework/port/status_macros.h"
+#include "mediapipe_api/util/cache_file_util.h"
+
+namespace mp_api {
+
+namespace {
+
+constexpr char kFileMagic[4] = {'M', 'P', 'S', 'A'};
+// Increment this when the file format changes.
+constexpr uint32_t kFileFormatVersion = 2;
+
+std::string GetFilePath(const std::string& directory, const std::string& key) {
+  return absl::StrFormat("%s/%016x.anchors", directory, Fingerprint(key));
+}
+
+// The anchors are stored as (x_center, y_center, w, h) in float, which is much smaller than the serialized protos.
+std::optional<SsdAnchorsCache::Anchors> ReadAnchors(const std::string& path, const std::string& key) {
+  std::ifstream file(path, std::ios::binary);
+  if (!file) {
+    return std::nullopt;
+  }
+  char magic[sizeof(kFileMagic)];
+  uint32_t byte_order_mark;
+  uint32_t version;
+  uint64_t build_fingerprint;
+  uint64_t key_size;
+  // NOTE: the files written by another build are rejected, since its SsdAnchorsCalculator may generate different anchors.
+  if (!file.read(magic, sizeof(magic)) || std::memcmp(magic, kFileMagic, sizeof(magic)) != 0 ||
+      !file.read(reinterpret_cast<char*>(&byte_order_mark), sizeof(byte_order_mark)) || byte_order_mark != kByteOrderMark ||
+      !file.read(reinterpret_cast<char*>(&version), sizeof(version)) || version != kFileFormatVersion ||
+      !file.read(reinterpret_cast<char*>(&build_fingerprint), sizeof(build_fingerprint)) || build_fingerprint != GetBuildFingerprint() ||
+      !file.read(reinterpret_cast<char*>(&key_size), sizeof(key_size)) || key_size != key.size()) {
+    return std::nullopt;
+  }
+  std::string stored_key(key_size, '\0');
+  uint64_t count;
+  if (!file.read(stored_key.data(), key_size) || stored_key != key || !file.read(reinterpret_cast<char*>(&count), sizeof(count))) {
+    return std::nullopt;
+  }
+  std::vector<float> values(count * 4);
+  if (!file.read(reinterpret_cast<char*>(values.data()), values.size() * sizeof(float))) {
+    return std::nullopt;
+  }
+
+  SsdAnchorsCache::Anchors anchors(count);
+  for (uint64_t i = 0; i < count; ++i) {
+    anchors[i].set_x_center(values[4 * i]);
+    anchors[i].set_y_center(values[4 * i + 1]);
+    anchors[i].set_w(values[4 * i + 2]);
+    anchors[i].set_h(values[4 * i + 3]);
+  }
+  return anchors;
+}
+
+void WriteAnchors(const std::string& path, const std::string& key, const SsdAnchorsCache::Anchors& anchors) {
+  std::vector<float> values;
+  values.reserve(anchors.size() * 4);
+  for (const auto& anchor : anchors) {
+    values.insert(values.end(), {anchor.x_center(), anchor.y_center(), anchor.w(), anchor.h()});
+  }
+
+  WriteFileAtomically(path, [&](std::ostream& file) {
+    const uint64_t build_fingerprint = GetBuildFingerprint();
+    const uint64_t key_size = key.size();
+    const uint64_t count = anchors.size();
+    file.write(kFileMagic, sizeof(kFileMagic));
+    file.write(reinterpret_cast<const char*>(&kByteOrderMark), sizeof(kByteOrderMark));
+    file.write(reinterpret_cast<const char*>(&kFileFormatVersion), sizeof(kFileFormatVersion));
+    file.write(reinterpret_cast<const char*>(&build_fingerprint), sizeof(build_fingerprint));
+    file.write(reinterpret_cast<const char*>(&key_size), sizeof(key_size));
+    file.write(key.data(), key.size());
+    file.write(reinterpret_cast<const char*>(&count), sizeof(count));
+    file.write(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(float));
+    return static_cast<bool>(file);
+  });
+}
+
+}  // namespace
+
+SsdAnchorsCache& SsdAnchorsCache::GetInstance() {
+  static auto* instance = new SsdAnchorsCache();
+  return *instance;
+}
+
+absl::StatusOr<std::shared_ptr<const SsdAnchorsCache::Anchors>> SsdAnchorsCache::GetAnchors(const mediapipe::SsdAnchorsCalculatorOptions& options) {
+  auto key = options.SerializeAsString();
+  std::string directory;
+  {
+    absl::MutexLock lock(&mutex_);
+    if (auto it = entries_.find(key); it != entries_.end()) {
+      ++hits_;
+      it->second.last_used = ++use_counter_;
+      return it->second.anchors;
+    }
+    directory = directory_;
+  }
+
+  // NOTE: the anchors are generated without holding the lock. If another thread generates the same anchors, the later one wins.
+  std::shared_ptr<const Anchors> anchors;
+  bool from_disk = false;
+  if (!directory.empty()) {
+    if (auto stored_anchors = ReadAnchors(GetFilePath(directory, key), key); stored_anchors) {
+      anchors = std::make_shared<const Anchors>(*std::move(stored_anchors));
+      from_disk = true;
+    }
+  }
+  if (anchors == nullptr) {
+    auto generated_anchors = std::make_shared<Anchors>();
+    if (auto status = GenerateAnchors(options, generated_anchors.get()); !status.ok()) {
+      return status;
+    }
+    if (!directory.empty()) {
+      WriteAnchors(GetFilePath(directory, key), key, *generated_anchors);
+    }
+    anchors = std::move(generated_anchors);
+  }
+
+  absl::MutexLock lock(&mutex_);
+  ++(from_disk ? disk_hits_ : misses_);
+  if (!entries_.contains(key) && entries_.size() >= kMaxEntries) {
+    EvictLeastRecentlyUsed();
+  }
+  entries_[std::move(key)] = Entry{anchors, ++use_counter_};
+  return anchors;
+}
+
+bool SsdAnchorsCache::enabled() {
+  absl::MutexLock lock(&mutex_);
+  return enabled_;
+}
+
+void SsdAnchorsCache::set_enabled(bool enabled) {
+  absl::MutexLock lock(&mutex_);
+  enabled_ = enabled;
+}
+
+void SsdAnchorsCache::SetDirectory(std::string directory) {
+  while (directory.size() > 1 && (directory.back() == '/' || directory.back() == '\\')) {
+    directory.pop_back();
+  }
+  absl::MutexLock lock(&mutex_);
+  directory_ = std::move(directory);
+}
+
+void SsdAnchorsCache::Clear() {
+  absl::MutexLock lock(&mutex_);
+  entries_.clear();
+}
+
+SsdAnchorsCacheStats SsdAnchorsCache::GetStats() {
+  absl::MutexLock lock(&mutex_);
+  return SsdAnchorsCacheStats{hits_, disk_hits_, misses_, static_cast<int64_t>(entries_.size())};
+}
+
+// NOTE: the anchors are generated by the upstream SsdAnchorsCalculator, so that they are always the same as the ones it outputs.
+absl::Status SsdAnchorsCache::GenerateAnchors(const mediapipe::SsdAnchorsCalculatorOptions& options, Anchors* anchors) {
+  mediapipe::CalculatorGraphConfig config;
+  auto* node = config.add_node();
+  node->set_calculator("SsdAnchorsCalculator");
+  node->add_output_side_packet("anchors");
+  *node->mutable_options()->MutableExtension(mediapipe::SsdAnchorsCalculatorOptions::ext) = options;
+
+  mediapipe::CalculatorGraph graph;
+  MP_RETURN_IF_ERROR(graph.Initialize(config));
+  MP_RETURN_IF_ERROR(graph.Run());
+  MP_ASSIGN_OR_RETURN(auto packet, graph.GetOutputSidePacket("anchors"));
+  *anchors = packet.Get<Anchors>();
+  return absl::OkStatus();
+}
+
+void SsdAnchorsCache::EvictLeastRecentlyUsed() {
+  // NOTE: the entries are scanned linearly, since this happens only when new anchors are inserted into the full cache.
+  auto victim = entries_.end();
+  for (auto it = entries_.begin(); it != entries_.end(); ++it) {
+    if (victim == entries_.end() || it->second.last_used < victim->second.last_used) {
+      victim = it;
+    }
+  }
+  if (victim != entries_.end()) {
+    entries_.erase(victim);
+  }
+}
+
+bool SsdAnchorsCache::ReplaceCalculators(mediapipe::CalculatorGraphConfig* config) {
+  // NOTE: the calculator is not linked if the library is built without the calculators.
+  if (!enabled() || !mediapipe::CalculatorBaseRegistry::IsRegistered("CachedSsdAnchorsCalculator")) {
+    return false;
+  }
+  bool replaced = false;
+  for (auto& node : *config->mutable_node()) {
+    if (node.calculator() == "SsdAnchorsCalculator") {
+      node.set_calculator("CachedSsdAnchorsCalculator");
+      replaced = true;
+    }
+  }
+  return replaced;
+}
+
+}  // namespace mp_api
+
+bool mp_SsdAnchorsCache__enabled() { return mp_api::SsdAnchorsCache::GetInstance().enabled(); }
+
+void mp_SsdAnchorsCache__set_enabled__b(bool enabled) { mp_api::SsdAnchorsCache::GetInstance().set_enabled(enabled); }
+
+void mp_SsdAnchorsCache__SetDirectory__PKc(const char* directory) {
+  mp_api::SsdAnchorsCache::GetInstance().SetDirectory(directory == nullptr ? "" : directory);
+}
+
+void mp_SsdAnchorsCache__Clear() { mp_api::SsdAnchorsCache::GetInstance().Clear(); }
+
+void mp_SsdAnchorsCache__GetStats(mp_api::SsdAnchorsCacheStats* stats_out) { *stats_out = mp_api::SsdAnchorsCache::GetInstance().GetStats(); }
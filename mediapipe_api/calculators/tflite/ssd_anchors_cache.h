@@ -0,0 +1,101 @@
+// Copyright (c) 2026 homuler
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+#ifndef MEDIAPIPE_API_CALCULATORS_TFLITE_SSD_ANCHORS_CACHE_H_
+#define MEDIAPIPE_API_CALCULATORS_TFLITE_SSD_ANCHORS_CACHE_H_
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "absl/synchronization/mutex.h"
+#include "mediapipe/calculators/tflite/ssd_anchors_calculator.pb.h"
+#include "mediapipe/framework/calculator.pb.h"
+#include "mediapipe/framework/formats/object_detection/anchor.pb.h"
+#include "mediapipe_api/common.h"
+
+namespace mp_api {
+
+struct SsdAnchorsCacheStats {
+  // The number of the anchors found in memory.
+  int64_t hits;
+  // The number of the anchors loaded from the persistent directory.
+  int64_t disk_hits;
+  // The number of the anchors generated by SsdAnchorsCalculator.
+  int64_t misses;
+  // The number of the anchors currently in memory.
+  int64_t entries;
+};
+
+// A process-wide cache of the SSD anchors, keyed by the serialized SsdAnchorsCalculatorOptions, which are the only input of the generation.
+class SsdAnchorsCache {
+ public:
+  using Anchors = std::vector<mediapipe::Anchor>;
+
+  // The maximum number of the anchors in memory. When it is exceeded, the least recently used ones are evicted.
+  static constexpr int kMaxEntries = 64;
+
+  static SsdAnchorsCache& GetInstance();
+
+  // Returns the anchors for `options`, which are generated by SsdAnchorsCalculator if they are not cached.
+  absl::StatusOr<std::shared_ptr<const Anchors>> GetAnchors(const mediapipe::SsdAnchorsCalculatorOptions& options);
+
+  // If it's enabled, ReplaceCalculators replaces SsdAnchorsCalculator. It's disabled by default.
+  bool enabled();
+  void set_enabled(bool enabled);
+
+  // Sets the directory to which the anchors are written, and from which they are read when they are not in memory.
+  // The directory must exist. If it's empty, the anchors are not persisted.
+  void SetDirectory(std::string directory);
+  // Removes the anchors in memory. The persisted ones are not removed.
+  void Clear();
+  SsdAnchorsCacheStats GetStats();
+
+  // Runs SsdAnchorsCalculator in a graph of its own, which is slow but always generates the same anchors as the original graph.
+  static absl::Status GenerateAnchors(const mediapipe::SsdAnchorsCalculatorOptions& options, Anchors* anchors);
+
+  // Replaces the SsdAnchorsCalculator nodes in `config` with CachedSsdAnchorsCalculator if the cache is enabled.
+  // Returns true if any node is replaced.
+  bool ReplaceCalculators(mediapipe::CalculatorGraphConfig* config);
+
+ private:
+  struct Entry {
+    std::shared_ptr<const Anchors> anchors;
+    uint64_t last_used = 0;
+  };
+
+  SsdAnchorsCache() = default;
+
+  void EvictLeastRecentlyUsed() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mutex_);
+
+  absl::Mutex mutex_;
+  bool enabled_ ABSL_GUARDED_BY(mutex_) = false;
+  std::string directory_ ABSL_GUARDED_BY(mutex_);
+  absl::flat_hash_map<std::string, Entry> entries_ ABSL_GUARDED_BY(mutex_);
+  uint64_t use_counter_ ABSL_GUARDED_BY(mutex_) = 0;
+  int64_t hits_ ABSL_GUARDED_BY(mutex_) = 0;
+  int64_t disk_hits_ ABSL_GUARDED_BY(mutex_) = 0;
+  int64_t misses_ ABSL_GUARDED_BY(mutex_) = 0;
+};
+
+}  // namespace mp_api
+
+extern "C" {
+
+MP_CAPI(bool) mp_SsdAnchorsCache__enabled();
+MP_CAPI(void) mp_SsdAnchorsCache__set_enabled__b(bool enabled);
+MP_CAPI(void) mp_SsdAnchorsCache__SetDirectory__PKc(const char* directory);
+MP_CAPI(void) mp_SsdAnchorsCache__Clear();
+MP_CAPI(void) mp_SsdAnchorsCache__GetStats(mp_api::SsdAnchorsCacheStats* stats_out);
+
+}  // extern "C"
+
+#endif  // MEDIAPIPE_API_CALCULATORS_TFLITE_SSD_ANCHORS_CACHE_H_
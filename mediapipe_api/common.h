@@ -18,6 +18,7 @@
 #include <string>
 
 #include "mediapipe/framework/port/logging.h"
+#include "mediapipe_api/util/capi_span.h"
 
 extern inline const char* strcpy_to_heap(const std::string& str) {
   if (str.empty()) {
@@ -67,17 +68,23 @@ extern void sigabrt_handler(int sig);
 
 }  // namespace mp_api
 
+// NOTE: TRY (and TRY_ALL) measures the function if the library is built with `--//mediapipe_api:trace_capi` (see capi_span.h).
+// The function templates use TRY_NO_SPAN (and TRY_ALL_NO_SPAN) instead, and are measured by MP_CAPI_NAMED_SPAN in the exported functions.
 // TODO: make code more readable
 #ifdef MEDIAPIPE_IGNORE_EXCEPTION
-#define TRY            \
+#define TRY_NO_SPAN                                    \
   auto volatile _mp_return_code = MpReturnCode::Unset; \
   {
 #else
-#define TRY             \
+#define TRY_NO_SPAN                                    \
   auto volatile _mp_return_code = MpReturnCode::Unset; \
   try {
 #endif  // MEDIAPIPE_IGNORE_EXCEPTION
 
+#define TRY      \
+  MP_CAPI_SPAN() \
+  TRY_NO_SPAN
+
 #ifdef MEDIAPIPE_IGNORE_EXCEPTION
 #define CATCH_EXCEPTION \
   }                     \
@@ -99,11 +106,11 @@ extern void sigabrt_handler(int sig);
 #endif
 
 #ifdef MEDIAPIPE_DISABLE_SIGABRT_HANDLER
-#define TRY_ALL TRY
+#define TRY_ALL_NO_SPAN TRY_NO_SPAN
 #define CATCH_ALL CATCH_EXCEPTION
 #else
-#define TRY_ALL                                  \
-  TRY                                            \
+#define TRY_ALL_NO_SPAN                          \
+  TRY_NO_SPAN                                    \
     struct sigaction act;                        \
     sigemptyset(&act.sa_mask);                   \
     act.sa_flags = 0;                            \
@@ -121,6 +128,10 @@ extern void sigabrt_handler(int sig);
   CATCH_EXCEPTION
 #endif  // MEDIAPIPE_DISABLE_SIGABRT_HANDLER
 
+#define TRY_ALL  \
+  MP_CAPI_SPAN() \
+  TRY_ALL_NO_SPAN
+
 #define RETURN_CODE(code) _mp_return_code = code
 
 #ifdef _WIN32
@@ -8,6 +8,55 @@
 
 #include <utility>
 
+#include "mediapipe/framework/port/ret_check.h"
+#include "mediapipe/framework/port/status_macros.h"
+#include "mediapipe_api/framework/expanded_config_cache.h"
+#include "mediapipe_api/framework/graph_profiling.h"
+#include "mediapipe_api/framework/metrics_registry.h"
+#include "mediapipe_api/framework/startup_profiler.h"
+#include "mediapipe_api/tasks/cc/core/shared_model_cache.h"
+
+namespace mp_api {
+
+absl::Status ResetGraph(mediapipe::CalculatorGraph& graph, const std::map<std::string, mediapipe::Packet>& side_packets) {
+  MP_RETURN_IF_ERROR(graph.CloseAllPacketSources());
+  MP_RETURN_IF_ERROR(graph.WaitUntilDone());
+  return graph.StartRun(side_packets);
+}
+
+}  // namespace mp_api
+
+namespace {
+
+void OnStartRun(mediapipe::CalculatorGraph& graph) {
+  // NOTE: the tracer enabled by StartupProfiler is paused when the startup window is closed.
+  if (auto profile = mp_api::StartupProfiler::GetInstance().Find(&graph); profile == nullptr || !profile->tracing()) {
+    mp_api::GraphProfiling::GetInstance().OnStartRun(graph);
+  }
+  if (auto* metrics = mp_api::MetricsRegistry::GetInstance().Find(&graph); metrics != nullptr) {
+    metrics->RecordStartRun();
+  }
+}
+
+// Closes the startup window and pauses the tracer unless the graph is being profiled.
+void EndStartupTracing(mediapipe::CalculatorGraph& graph, mp_api::StartupProfile& profile) {
+  if (profile.EndTracing()) {
+    mp_api::GraphProfiling::GetInstance().OnStartRun(graph);
+  }
+}
+
+// Same as CalculatorGraph::Run, including the status, but calls OnStartRun after the graph is started.
+// NOTE: CalculatorGraph::Run cannot be called as is, because the profiler is resumed when the graph is started.
+absl::Status RunGraph(mediapipe::CalculatorGraph& graph, const std::map<std::string, mediapipe::Packet>& side_packets) {
+  RET_CHECK(graph.Config().input_stream().empty()).SetNoLogging()
+      << "When using graph input streams, call StartRun() instead of Run() so that AddPacketToInputStream() and CloseInputStream() can be called.";
+  MP_RETURN_IF_ERROR(graph.StartRun(side_packets));
+  OnStartRun(graph);
+  return graph.WaitUntilDone();
+}
+
+}  // namespace
+
 MpReturnCode mp_CalculatorGraph__(mediapipe::CalculatorGraph** graph_out) {
   TRY
     *graph_out = new mediapipe::CalculatorGraph();
@@ -15,20 +64,50 @@ MpReturnCode mp_CalculatorGraph__(mediapipe::CalculatorGraph** graph_out) {
   CATCH_EXCEPTION
 }
 
-void mp_CalculatorGraph__delete(mediapipe::CalculatorGraph* graph) { delete graph; }
+void mp_CalculatorGraph__delete(mediapipe::CalculatorGraph* graph) {
+  // NOTE: the model assets must outlive the graph.
+  auto model_assets = mp_api::SharedModelCache::GetInstance().Release(graph);
+  mp_api::StartupProfiler::GetInstance().Detach(graph);
+  mp_api::GraphProfiling::GetInstance().Detach(graph);
+  delete graph;
+  mp_api::MetricsRegistry::GetInstance().Unregister(graph);
+}
 
 MpReturnCode mp_CalculatorGraph__PKc_i(const char* serialized_config, int size, mediapipe::CalculatorGraph** graph_out) {
   TRY_ALL
-    auto config = ParseFromStringAsProto<mediapipe::CalculatorGraphConfig>(serialized_config, size);
+    mp_api::ScopedStartupProfile startup(mp_api::StartupProfiler::GetInstance().NewProfile());
+    auto start = absl::Now();
+    auto config = mp_api::ExpandedConfigCache::GetInstance().GetConfig(serialized_config, size);
+    startup.Record(mp_api::StartupPhaseType::kConfigParse, start);
+    mp_api::GraphProfiling::GetInstance().Configure(&config);
+    startup.EnableTracing(&config);
+    auto model_assets = mp_api::SharedModelCache::GetInstance().ShareModelAssets(config);
+    start = absl::Now();
     *graph_out = new mediapipe::CalculatorGraph(config);
+    startup.Record(mp_api::StartupPhaseType::kValidation, start);
+    mp_api::SharedModelCache::GetInstance().Retain(*graph_out, std::move(model_assets));
+    startup.Attach(*graph_out, (*graph_out)->profiler());
     RETURN_CODE(MpReturnCode::Success);
   CATCH_ALL
 }
 
 MpReturnCode mp_CalculatorGraph__Initialize__PKc_i(mediapipe::CalculatorGraph* graph, const char* serialized_config, int size, absl::Status** status_out) {
   TRY_ALL
-    auto config = ParseFromStringAsProto<mediapipe::CalculatorGraphConfig>(serialized_config, size);
-    *status_out = new absl::Status{graph->Initialize(config)};
+    mp_api::ScopedStartupProfile startup(mp_api::StartupProfiler::GetInstance().NewProfile());
+    auto start = absl::Now();
+    auto config = mp_api::ExpandedConfigCache::GetInstance().GetConfig(serialized_config, size);
+    startup.Record(mp_api::StartupPhaseType::kConfigParse, start);
+    mp_api::GraphProfiling::GetInstance().Configure(&config);
+    startup.EnableTracing(&config);
+    auto model_assets = mp_api::SharedModelCache::GetInstance().ShareModelAssets(config);
+    start = absl::Now();
+    auto status = graph->Initialize(config);
+    startup.Record(mp_api::StartupPhaseType::kValidation, start);
+    if (status.ok()) {
+      startup.Attach(graph, graph->profiler());
+    }
+    *status_out = new absl::Status{std::move(status)};
+    mp_api::SharedModelCache::GetInstance().Retain(graph, std::move(model_assets));
     RETURN_CODE(MpReturnCode::Success);
   CATCH_ALL
 }
@@ -36,8 +115,53 @@ MpReturnCode mp_CalculatorGraph__Initialize__PKc_i(mediapipe::CalculatorGraph* g
 MpReturnCode mp_CalculatorGraph__Initialize__PKc_i_Rsp(mediapipe::CalculatorGraph* graph, const char* serialized_config, int size, SidePackets* side_packets,
                                                        absl::Status** status_out) {
   TRY_ALL
-    auto config = ParseFromStringAsProto<mediapipe::CalculatorGraphConfig>(serialized_config, size);
-    *status_out = new absl::Status{graph->Initialize(config, *side_packets)};
+    mp_api::ScopedStartupProfile startup(mp_api::StartupProfiler::GetInstance().NewProfile());
+    auto start = absl::Now();
+    auto config = mp_api::ExpandedConfigCache::GetInstance().GetConfig(serialized_config, size, side_packets);
+    startup.Record(mp_api::StartupPhaseType::kConfigParse, start);
+    mp_api::GraphProfiling::GetInstance().Configure(&config);
+    startup.EnableTracing(&config);
+    auto model_assets = mp_api::SharedModelCache::GetInstance().ShareModelAssets(config);
+    start = absl::Now();
+    auto status = graph->Initialize(config, *side_packets);
+    startup.Record(mp_api::StartupPhaseType::kValidation, start);
+    if (status.ok()) {
+      startup.Attach(graph, graph->profiler());
+    }
+    *status_out = new absl::Status{std::move(status)};
+    mp_api::SharedModelCache::GetInstance().Retain(graph, std::move(model_assets));
+    RETURN_CODE(MpReturnCode::Success);
+  CATCH_ALL
+}
+
+MpReturnCode mp_CalculatorGraph__GetStartupPhases(mediapipe::CalculatorGraph* graph, mp_api::StructArray<mp_api::StartupPhase>* value_out) {
+  TRY_ALL
+    if (auto profile = mp_api::StartupProfiler::GetInstance().Find(graph); profile != nullptr) {
+      EndStartupTracing(*graph, *profile);
+    }
+    mp_api::GetStartupPhases(graph, value_out);
+    RETURN_CODE(MpReturnCode::Success);
+  CATCH_ALL
+}
+
+MpReturnCode mp_CalculatorGraph__SetProfilingEnabled__b(mediapipe::CalculatorGraph* graph, bool enabled, absl::Status** status_out) {
+  TRY_ALL
+    *status_out = new absl::Status{mp_api::GraphProfiling::GetInstance().SetProfilingEnabled(*graph, enabled)};
+    RETURN_CODE(MpReturnCode::Success);
+  CATCH_ALL
+}
+
+MpReturnCode mp_CalculatorGraph__GetCalculatorProfiles(mediapipe::CalculatorGraph* graph, absl::Status** status_out,
+                                                       mp_api::StructArray<mp_api::CalculatorProfileStats>* value_out) {
+  TRY_ALL
+    *status_out = new absl::Status{mp_api::GraphProfiling::GetCalculatorProfiles(*graph, value_out)};
+    RETURN_CODE(MpReturnCode::Success);
+  CATCH_ALL
+}
+
+MpReturnCode mp_CalculatorGraph__WriteTrace__PKc_d(mediapipe::CalculatorGraph* graph, const char* path, double seconds, absl::Status** status_out) {
+  TRY_ALL
+    *status_out = new absl::Status{mp_api::GraphProfiling::WriteTrace(*graph, path, absl::Seconds(seconds))};
     RETURN_CODE(MpReturnCode::Success);
   CATCH_ALL
 }
@@ -53,9 +177,14 @@ MpReturnCode mp_CalculatorGraph__ObserveOutputStream__PKc_PF_b(mediapipe::Calcul
                                                                NativePacketCallback* packet_callback, bool observe_timestamp_bounds,
                                                                absl::Status** status_out) {
   TRY_ALL
+    auto* metrics = mp_api::MetricsRegistry::GetInstance().Get(graph);
+    auto* stream_metrics = metrics == nullptr ? nullptr : metrics->AddStream(stream_name, observe_timestamp_bounds);
     auto status = graph->ObserveOutputStream(
         stream_name,
-        [graph, stream_id, packet_callback](const mediapipe::Packet& packet) -> ::absl::Status {
+        [graph, stream_id, packet_callback, metrics, stream_metrics](const mediapipe::Packet& packet) -> ::absl::Status {
+          if (stream_metrics != nullptr) {
+            metrics->RecordOutput(stream_metrics, packet.Timestamp().Value(), packet.IsEmpty());
+          }
           auto status_args = packet_callback(graph, stream_id, packet);
           auto callback_status = absl::Status{status_args.code, absl::NullSafeStringView((const char*)status_args.message)};
           if (status_args.message != nullptr) {
@@ -84,7 +213,7 @@ MpReturnCode mp_CalculatorGraph__AddOutputStreamPoller__PKc_b(mediapipe::Calcula
 
 MpReturnCode mp_CalculatorGraph__Run__Rsp(mediapipe::CalculatorGraph* graph, SidePackets* side_packets, absl::Status** status_out) {
   TRY
-    auto status = graph->Run(*side_packets);
+    auto status = RunGraph(*graph, *side_packets);
     *status_out = new absl::Status{std::move(status)};
     RETURN_CODE(MpReturnCode::Success);
   CATCH_EXCEPTION
@@ -92,7 +221,32 @@ MpReturnCode mp_CalculatorGraph__Run__Rsp(mediapipe::CalculatorGraph* graph, Sid
 
 MpReturnCode mp_CalculatorGraph__StartRun__Rsp(mediapipe::CalculatorGraph* graph, SidePackets* side_packets, absl::Status** status_out) {
   TRY
+    auto profile = mp_api::StartupProfiler::GetInstance().Find(graph);
+    if (profile != nullptr && !profile->MarkStarted()) {
+      // NOTE: only the first run is recorded.
+      profile = nullptr;
+    }
+    mp_api::ScopedStartupProfile startup(profile);
+    const auto start = absl::Now();
     auto status = graph->StartRun(*side_packets);
+    startup.Record(mp_api::StartupPhaseType::kStartRun, start);
+    if (profile != nullptr) {
+      profile->CaptureTrace();
+    }
+    if (status.ok()) {
+      OnStartRun(*graph);
+    }
+    *status_out = new absl::Status{std::move(status)};
+    RETURN_CODE(MpReturnCode::Success);
+  CATCH_EXCEPTION
+}
+
+MpReturnCode mp_CalculatorGraph__Reset__Rsp(mediapipe::CalculatorGraph* graph, SidePackets* side_packets, absl::Status** status_out) {
+  TRY
+    auto status = mp_api::ResetGraph(*graph, *side_packets);
+    if (status.ok()) {
+      OnStartRun(*graph);
+    }
     *status_out = new absl::Status{std::move(status)};
     RETURN_CODE(MpReturnCode::Success);
   CATCH_EXCEPTION
@@ -114,12 +268,26 @@ MpReturnCode mp_CalculatorGraph__WaitUntilDone(mediapipe::CalculatorGraph* graph
   CATCH_EXCEPTION
 }
 
-bool mp_CalculatorGraph__HasError(mediapipe::CalculatorGraph* graph) { return graph->HasError(); }
+bool mp_CalculatorGraph__HasError(mediapipe::CalculatorGraph* graph) {
+  MP_CAPI_SPAN();
+  return graph->HasError();
+}
 
 MpReturnCode mp_CalculatorGraph__AddPacketToInputStream__PKc_Ppacket(mediapipe::CalculatorGraph* graph, const char* stream_name, mediapipe::Packet* packet,
                                                                      absl::Status** status_out) {
   TRY
-    *status_out = new absl::Status{graph->AddPacketToInputStream(stream_name, std::move(*packet))};
+    // NOTE: the startup window is closed after a while even if the startup phases are not requested.
+    if (auto profile = mp_api::StartupProfiler::GetInstance().FindExpired(graph); profile != nullptr) {
+      EndStartupTracing(*graph, *profile);
+    }
+    auto* metrics = mp_api::MetricsRegistry::GetInstance().Get(graph);
+    const auto input_index = metrics == nullptr ? 0 : metrics->RecordInput(packet->Timestamp().Value());
+    auto status = graph->AddPacketToInputStream(stream_name, std::move(*packet));
+    if (metrics != nullptr && !status.ok()) {
+      // NOTE: the graph rejects the packet with UNAVAILABLE if it's throttled in the ADD_IF_NOT_FULL mode.
+      metrics->CancelInput(input_index, absl::IsUnavailable(status));
+    }
+    *status_out = new absl::Status{std::move(status)};
     RETURN_CODE(MpReturnCode::Success);
   CATCH_EXCEPTION
 }
@@ -132,7 +300,10 @@ MpReturnCode mp_CalculatorGraph__SetInputStreamMaxQueueSize__PKc_i(mediapipe::Ca
   CATCH_EXCEPTION
 }
 
-bool mp_CalculatorGraph__HasInputStream__PKc(mediapipe::CalculatorGraph* graph, const char* name) { return graph->HasInputStream(name); }
+bool mp_CalculatorGraph__HasInputStream__PKc(mediapipe::CalculatorGraph* graph, const char* name) {
+  MP_CAPI_SPAN();
+  return graph->HasInputStream(name);
+}
 
 MpReturnCode mp_CalculatorGraph__CloseInputStream__PKc(mediapipe::CalculatorGraph* graph, const char* stream_name, absl::Status** status_out) {
   TRY
@@ -155,12 +326,30 @@ MpReturnCode mp_CalculatorGraph__Cancel(mediapipe::CalculatorGraph* graph) {
   CATCH_EXCEPTION
 }
 
-bool mp_CalculatorGraph__GraphInputStreamsClosed(mediapipe::CalculatorGraph* graph) { return graph->GraphInputStreamsClosed(); }
+bool mp_CalculatorGraph__GraphInputStreamsClosed(mediapipe::CalculatorGraph* graph) {
+  MP_CAPI_SPAN();
+  return graph->GraphInputStreamsClosed();
+}
 
-bool mp_CalculatorGraph__IsNodeThrottled__i(mediapipe::CalculatorGraph* graph, int node_id) { return graph->IsNodeThrottled(node_id); }
+bool mp_CalculatorGraph__IsNodeThrottled__i(mediapipe::CalculatorGraph* graph, int node_id) {
+  MP_CAPI_SPAN();
+  const auto throttled = graph->IsNodeThrottled(node_id);
+  if (auto* metrics = mp_api::MetricsRegistry::GetInstance().Find(graph); metrics != nullptr) {
+    metrics->RecordNodeThrottled(node_id, throttled);
+  }
+  return throttled;
+}
 
 bool mp_CalculatorGraph__UnthrottleSources(mediapipe::CalculatorGraph* graph) { return graph->UnthrottleSources(); }
 
+MpReturnCode mp_CalculatorGraph__SetExecutor__PKc_SPe(mediapipe::CalculatorGraph* graph, const char* name,
+                                                      std::shared_ptr<mediapipe::Executor>* executor, absl::Status** status_out) {
+  TRY
+    *status_out = new absl::Status{graph->SetExecutor(name, *executor)};
+    RETURN_CODE(MpReturnCode::Success);
+  CATCH_EXCEPTION
+}
+
 #ifndef MEDIAPIPE_DISABLE_GPU
 MpReturnCode mp_CalculatorGraph__GetGpuResources(mediapipe::CalculatorGraph* graph, std::shared_ptr<mediapipe::GpuResources>** gpu_resources_out) {
   TRY
@@ -15,13 +15,28 @@
 #include "mediapipe_api/common.h"
 #include "mediapipe_api/external/absl/status.h"
 #include "mediapipe_api/external/protobuf.h"
+#include "mediapipe_api/framework/graph_profiling.h"
 #include "mediapipe_api/framework/packet.h"
+#include "mediapipe_api/framework/startup_profiler.h"
 
 #ifndef MEDIAPIPE_DISABLE_GPU
 #include "mediapipe/gpu/gl_calculator_helper.h"
 #include "mediapipe/gpu/gpu_shared_data_internal.h"
 #endif  // !defined(MEDIAPIPE_DISABLE_GPU)
 
+namespace mp_api {
+
+// Closes the graph input streams, waits until the current run is done, and starts a new run with `side_packets`.
+// The timestamps and the calculator states are reset, but unlike recreating the graph, the validated config, the executors,
+// the GPU resources, the graph services, and the output stream observers are reused.
+//
+// If SharedModelCache is enabled, the model files that the graph loads by ExternalFile are kept in memory while the graph is alive,
+// so they are not read again. However, the calculators are created again for each run, so the TFLite interpreters are built again
+// when InferenceCalculator is opened. See calculator_graph_benchmark for what is saved.
+absl::Status ResetGraph(mediapipe::CalculatorGraph& graph, const std::map<std::string, mediapipe::Packet>& side_packets);
+
+}  // namespace mp_api
+
 extern "C" {
 
 typedef std::map<std::string, mediapipe::Packet> SidePackets;
@@ -38,6 +53,13 @@ MP_CAPI(MpReturnCode) mp_CalculatorGraph__Initialize__PKc_i_Rsp(mediapipe::Calcu
                                                                 SidePackets* side_packets, absl::Status** status_out);
 
 MP_CAPI(MpReturnCode) mp_CalculatorGraph__Config(mediapipe::CalculatorGraph* graph, mp_api::SerializedProto* config_out);
+MP_CAPI(MpReturnCode) mp_CalculatorGraph__GetStartupPhases(mediapipe::CalculatorGraph* graph, mp_api::StructArray<mp_api::StartupPhase>* value_out);
+// Turns the profiler on or off. It fails unless the profiler is configured, i.e. GraphProfiling was enabled when the graph was created.
+MP_CAPI(MpReturnCode) mp_CalculatorGraph__SetProfilingEnabled__b(mediapipe::CalculatorGraph* graph, bool enabled, absl::Status** status_out);
+MP_CAPI(MpReturnCode) mp_CalculatorGraph__GetCalculatorProfiles(mediapipe::CalculatorGraph* graph, absl::Status** status_out,
+                                                                mp_api::StructArray<mp_api::CalculatorProfileStats>* value_out);
+// Writes the trace of the last `seconds` to `path` in the Chrome trace event format.
+MP_CAPI(MpReturnCode) mp_CalculatorGraph__WriteTrace__PKc_d(mediapipe::CalculatorGraph* graph, const char* path, double seconds, absl::Status** status_out);
 MP_CAPI(MpReturnCode) mp_CalculatorGraph__ObserveOutputStream__PKc_PF_b(mediapipe::CalculatorGraph* graph, const char* stream_name, int stream_id,
                                                                         NativePacketCallback* packet_callback, bool observe_timestamp_bounds,
                                                                         absl::Status** status_out);
@@ -49,6 +71,8 @@ MP_CAPI(MpReturnCode) mp_CalculatorGraph__Run__Rsp(mediapipe::CalculatorGraph* g
 
 MP_CAPI(MpReturnCode) mp_CalculatorGraph__StartRun__Rsp(mediapipe::CalculatorGraph* graph, SidePackets* side_packets, absl::Status** status_out);
 
+MP_CAPI(MpReturnCode) mp_CalculatorGraph__Reset__Rsp(mediapipe::CalculatorGraph* graph, SidePackets* side_packets, absl::Status** status_out);
+
 MP_CAPI(MpReturnCode) mp_CalculatorGraph__WaitUntilIdle(mediapipe::CalculatorGraph* graph, absl::Status** status_out);
 MP_CAPI(MpReturnCode) mp_CalculatorGraph__WaitUntilDone(mediapipe::CalculatorGraph* graph, absl::Status** status_out);
 MP_CAPI(bool) mp_CalculatorGraph__HasError(mediapipe::CalculatorGraph* graph);
@@ -66,6 +90,9 @@ MP_CAPI(MpReturnCode) mp_CalculatorGraph__Cancel(mediapipe::CalculatorGraph* gra
 MP_CAPI(bool) mp_CalculatorGraph__GraphInputStreamsClosed(mediapipe::CalculatorGraph* graph);
 MP_CAPI(bool) mp_CalculatorGraph__IsNodeThrottled__i(mediapipe::CalculatorGraph* graph, int node_id);
 MP_CAPI(bool) mp_CalculatorGraph__UnthrottleSources(mediapipe::CalculatorGraph* graph);
+// Must be called before the graph is initialized. If `name` is empty, `executor` is used as the default executor.
+MP_CAPI(MpReturnCode) mp_CalculatorGraph__SetExecutor__PKc_SPe(mediapipe::CalculatorGraph* graph, const char* name,
+                                                               std::shared_ptr<mediapipe::Executor>* executor, absl::Status** status_out);
 
 #ifndef MEDIAPIPE_DISABLE_GPU
 MP_CAPI(MpReturnCode) mp_CalculatorGraph__GetGpuResources(mediapipe::CalculatorGraph* graph, std::shared_ptr<mediapipe::GpuResources>** gpu_resources_out);
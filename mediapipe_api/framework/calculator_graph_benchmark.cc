@@ -0,0 +1,256 @@
+// Copyright (c) 2026 homuler
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+// Compares the time to get a graph ready for the next clip by resetting it with the time to recreate it.
+// The graphs with a model show what is saved by keeping the model assets shared by SharedModelCache, since the interpreter is built again
+// in both cases.
+//
+//   bazel run -c opt //mediapipe_api/framework:calculator_graph_benchmark --define MEDIAPIPE_DISABLE_GPU=1
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "absl/strings/str_cat.h"
+#include "benchmark/benchmark.h"
+#include "flatbuffers/flatbuffers.h"
+#include "mediapipe/framework/calculator_framework.h"
+#include "mediapipe/framework/formats/tensor.h"
+#include "mediapipe/framework/port/parse_text_proto.h"
+#include "mediapipe/framework/port/status_macros.h"
+#include "mediapipe/tasks/cc/core/proto/model_resources_calculator.pb.h"
+#include "mediapipe_api/framework/calculator_graph.h"
+#include "mediapipe_api/tasks/cc/core/shared_model_cache.h"
+#include "tensorflow/lite/schema/schema_generated.h"
+
+namespace {
+
+// Builds a graph that passes the input through `num_nodes` PassThroughCalculators.
+mediapipe::CalculatorGraphConfig BuildPassThroughGraph(int num_nodes) {
+  mediapipe::CalculatorGraphConfig config;
+  config.add_input_stream("in");
+  std::string input_stream = "in";
+  for (auto i = 0; i < num_nodes; ++i) {
+    auto output_stream = i == num_nodes - 1 ? std::string("out") : absl::StrCat("s", i);
+    auto* node = config.add_node();
+    node->set_calculator("PassThroughCalculator");
+    node->add_input_stream(input_stream);
+    node->add_output_stream(output_stream);
+    input_stream = std::move(output_stream);
+  }
+  config.add_output_stream("out");
+  return config;
+}
+
+// Writes a model that adds `num_elements` float weights to the input, so that the model file is as large as the weights.
+std::string WriteAddModel(int num_elements) {
+  flatbuffers::FlatBufferBuilder builder;
+  const std::vector<float> weights(num_elements, 1.0f);
+  const std::vector<int32_t> shape = {1, num_elements};
+  std::vector<flatbuffers::Offset<tflite::Buffer>> buffers = {
+      tflite::CreateBuffer(builder),
+      tflite::CreateBuffer(builder, builder.CreateVector(reinterpret_cast<const uint8_t*>(weights.data()), weights.size() * sizeof(float))),
+  };
+  std::vector<flatbuffers::Offset<tflite::Tensor>> tensors = {
+      tflite::CreateTensor(builder, builder.CreateVector(shape), tflite::TensorType_FLOAT32, 0, builder.CreateString("input")),
+      tflite::CreateTensor(builder, builder.CreateVector(shape), tflite::TensorType_FLOAT32, 1, builder.CreateString("weights")),
+      tflite::CreateTensor(builder, builder.CreateVector(shape), tflite::TensorType_FLOAT32, 0, builder.CreateString("output")),
+  };
+  auto opcodes = std::vector<flatbuffers::Offset<tflite::OperatorCode>>{
+      tflite::CreateOperatorCode(builder, tflite::BuiltinOperator_ADD, 0, 1, tflite::BuiltinOperator_ADD)};
+  auto operators = std::vector<flatbuffers::Offset<tflite::Operator>>{
+      tflite::CreateOperator(builder, 0, builder.CreateVector(std::vector<int32_t>{0, 1}), builder.CreateVector(std::vector<int32_t>{2}),
+                             tflite::BuiltinOptions_AddOptions, tflite::CreateAddOptions(builder).Union())};
+  auto subgraphs = std::vector<flatbuffers::Offset<tflite::SubGraph>>{
+      tflite::CreateSubGraph(builder, builder.CreateVector(tensors), builder.CreateVector(std::vector<int32_t>{0}),
+                             builder.CreateVector(std::vector<int32_t>{2}), builder.CreateVector(operators))};
+  auto model = tflite::CreateModel(builder, TFLITE_SCHEMA_VERSION, builder.CreateVector(opcodes), builder.CreateVector(subgraphs),
+                                   builder.CreateString("add"), builder.CreateVector(buffers));
+  tflite::FinishModelBuffer(builder, model);
+
+  const auto path = (std::filesystem::temp_directory_path() / absl::StrCat("calculator_graph_benchmark_", num_elements, ".tflite")).string();
+  std::ofstream(path, std::ios::binary).write(reinterpret_cast<const char*>(builder.GetBufferPointer()), builder.GetSize());
+  return path;
+}
+
+// Builds a graph that loads the model at `model_path` as the tasks graphs do, i.e. by ModelResourcesCalculator,
+// so that SharedModelCache can share the model file.
+mediapipe::CalculatorGraphConfig BuildInferenceGraph(const std::string& model_path) {
+  auto config = mediapipe::ParseTextProtoOrDie<mediapipe::CalculatorGraphConfig>(R"pb(
+    input_stream: "in"
+    output_stream: "out"
+    node {
+      calculator: "ModelResourcesCalculator"
+      output_side_packet: "MODEL:model"
+      output_side_packet: "OP_RESOLVER:op_resolver"
+    }
+    node {
+      calculator: "InferenceCalculator"
+      input_side_packet: "MODEL:model"
+      input_side_packet: "OP_RESOLVER:op_resolver"
+      input_stream: "TENSORS:in"
+      output_stream: "TENSORS:out"
+    }
+  )pb");
+  auto* options = config.mutable_node(0)->mutable_options()->MutableExtension(mediapipe::tasks::core::proto::ModelResourcesCalculatorOptions::ext);
+  options->mutable_model_file()->set_file_name(model_path);
+  return config;
+}
+
+// Runs one clip, i.e. sends a packet and waits until it's processed.
+absl::Status RunClip(mediapipe::CalculatorGraph& graph) {
+  MP_RETURN_IF_ERROR(graph.AddPacketToInputStream("in", mediapipe::MakePacket<int>(0).At(mediapipe::Timestamp(0))));
+  return graph.WaitUntilIdle();
+}
+
+absl::Status RunInferenceClip(mediapipe::CalculatorGraph& graph, int num_elements) {
+  std::vector<mediapipe::Tensor> tensors;
+  tensors.emplace_back(mediapipe::Tensor::ElementType::kFloat32, mediapipe::Tensor::Shape({1, num_elements}));
+  MP_RETURN_IF_ERROR(graph.AddPacketToInputStream("in", mediapipe::MakePacket<std::vector<mediapipe::Tensor>>(std::move(tensors)).At(mediapipe::Timestamp(0))));
+  return graph.WaitUntilIdle();
+}
+
+// A graph created in the same way as mp_CalculatorGraph__PKc_i, which keeps the model assets shared by SharedModelCache while it's alive.
+struct SharedModelGraph {
+  absl::Status Initialize(mediapipe::CalculatorGraphConfig config) {
+    model_assets = mp_api::SharedModelCache::GetInstance().ShareModelAssets(config);
+    graph = std::make_unique<mediapipe::CalculatorGraph>();
+    return graph->Initialize(std::move(config));
+  }
+
+  // NOTE: the model assets must outlive the graph, so declare them first.
+  std::vector<mp_api::SharedModelCache::Handle> model_assets;
+  std::unique_ptr<mediapipe::CalculatorGraph> graph;
+};
+
+void BM_Recreate(benchmark::State& state) {
+  const auto config = BuildPassThroughGraph(state.range(0));
+  auto graph = std::make_unique<mediapipe::CalculatorGraph>();
+  if (auto status = graph->Initialize(config); !status.ok() || !(status = graph->StartRun({})).ok()) {
+    state.SkipWithError(status.ToString().c_str());
+    return;
+  }
+
+  for (auto _ : state) {
+    auto status = RunClip(*graph);
+    if (status.ok()) {
+      status = graph->CloseAllPacketSources();
+    }
+    if (status.ok()) {
+      status = graph->WaitUntilDone();
+    }
+    if (status.ok()) {
+      graph = std::make_unique<mediapipe::CalculatorGraph>();
+      status = graph->Initialize(config);
+    }
+    if (status.ok()) {
+      status = graph->StartRun({});
+    }
+    if (!status.ok()) {
+      state.SkipWithError(status.ToString().c_str());
+      return;
+    }
+  }
+  graph->CloseAllPacketSources().IgnoreError();
+  graph->WaitUntilDone().IgnoreError();
+}
+
+void BM_Reset(benchmark::State& state) {
+  mediapipe::CalculatorGraph graph;
+  if (auto status = graph.Initialize(BuildPassThroughGraph(state.range(0))); !status.ok() || !(status = graph.StartRun({})).ok()) {
+    state.SkipWithError(status.ToString().c_str());
+    return;
+  }
+
+  const std::map<std::string, mediapipe::Packet> side_packets;
+  for (auto _ : state) {
+    auto status = RunClip(graph);
+    if (status.ok()) {
+      status = mp_api::ResetGraph(graph, side_packets);
+    }
+    if (!status.ok()) {
+      state.SkipWithError(status.ToString().c_str());
+      return;
+    }
+  }
+  graph.CloseAllPacketSources().IgnoreError();
+  graph.WaitUntilDone().IgnoreError();
+}
+
+// NOTE: the model file is read again every time, since no other graph shares it.
+void BM_RecreateWithModel(benchmark::State& state) {
+  mp_api::SharedModelCache::GetInstance().set_enabled(true);
+  const int num_elements = state.range(0);
+  const auto config = BuildInferenceGraph(WriteAddModel(num_elements));
+  auto shared_model_graph = std::make_unique<SharedModelGraph>();
+  if (auto status = shared_model_graph->Initialize(config); !status.ok() || !(status = shared_model_graph->graph->StartRun({})).ok()) {
+    state.SkipWithError(status.ToString().c_str());
+    return;
+  }
+
+  for (auto _ : state) {
+    auto status = RunInferenceClip(*shared_model_graph->graph, num_elements);
+    if (status.ok()) {
+      status = shared_model_graph->graph->CloseAllPacketSources();
+    }
+    if (status.ok()) {
+      status = shared_model_graph->graph->WaitUntilDone();
+    }
+    if (status.ok()) {
+      shared_model_graph = std::make_unique<SharedModelGraph>();
+      status = shared_model_graph->Initialize(config);
+    }
+    if (status.ok()) {
+      status = shared_model_graph->graph->StartRun({});
+    }
+    if (!status.ok()) {
+      state.SkipWithError(status.ToString().c_str());
+      return;
+    }
+  }
+  shared_model_graph->graph->CloseAllPacketSources().IgnoreError();
+  shared_model_graph->graph->WaitUntilDone().IgnoreError();
+  state.SetLabel(absl::StrCat(num_elements * sizeof(float) / 1024, " KiB model"));
+}
+
+// NOTE: the model file is kept in memory, but the interpreter is built again when InferenceCalculator is opened.
+void BM_ResetWithModel(benchmark::State& state) {
+  mp_api::SharedModelCache::GetInstance().set_enabled(true);
+  const int num_elements = state.range(0);
+  SharedModelGraph shared_model_graph;
+  if (auto status = shared_model_graph.Initialize(BuildInferenceGraph(WriteAddModel(num_elements)));
+      !status.ok() || !(status = shared_model_graph.graph->StartRun({})).ok()) {
+    state.SkipWithError(status.ToString().c_str());
+    return;
+  }
+
+  const std::map<std::string, mediapipe::Packet> side_packets;
+  for (auto _ : state) {
+    auto status = RunInferenceClip(*shared_model_graph.graph, num_elements);
+    if (status.ok()) {
+      status = mp_api::ResetGraph(*shared_model_graph.graph, side_packets);
+    }
+    if (!status.ok()) {
+      state.SkipWithError(status.ToString().c_str());
+      return;
+    }
+  }
+  shared_model_graph.graph->CloseAllPacketSources().IgnoreError();
+  shared_model_graph.graph->WaitUntilDone().IgnoreError();
+  state.SetLabel(absl::StrCat(num_elements * sizeof(float) / 1024, " KiB model"));
+}
+
+BENCHMARK(BM_Recreate)->Arg(1)->Arg(16)->Arg(64);
+BENCHMARK(BM_Reset)->Arg(1)->Arg(16)->Arg(64);
+BENCHMARK(BM_RecreateWithModel)->Arg(1 << 16)->Arg(1 << 22);
+BENCHMARK(BM_ResetWithModel)->Arg(1 << 16)->Arg(1 << 22);
+
+}  // namespace
@@ -0,0 +1,272 @@
+// Copyright (c) 2026 homuler
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+#include "mediapipe_api/framework/expanded_config_cache.h"
+
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <optional>
+#include <utility>
+
+#include "absl/strings/str_cat.h"
+#include "absl/strings/str_format.h"
+#include "mediapipe/framework/validated_graph_config.h"
+#include "mediapipe_api/calculators/tflite/ssd_anchors_cache.h"
+#include "mediapipe_api/external/protobuf.h"
+#include "mediapipe_api/util/cache_file_util.h"
+
+namespace mp_api {
+
+namespace {
+
+constexpr char kFileMagic[4] = {'M', 'P', 'E', 'C'};
+// Increment this when the file format changes.
+constexpr uint32_t kFileFormatVersion = 2;
+
+std::string MakeKey(const char* serialized_config, int size, const std::map<std::string, mediapipe::Packet>* side_packets) {
+  std::string key(serialized_config, size);
+  if (side_packets != nullptr) {
+    // NOTE: std::map is sorted by the names, so the signature does not depend on the insertion order.
+    for (const auto& [name, packet] : *side_packets) {
+      absl::StrAppend(&key, "\n", name, ":", packet.IsEmpty() ? "" : packet.RegisteredTypeName());
+    }
+  }
+  // NOTE: the expanded config depends on whether SsdAnchorsCalculator is replaced.
+  if (SsdAnchorsCache::GetInstance().enabled()) {
+    absl::StrAppend(&key, "\nCachedSsdAnchorsCalculator");
+  }
+  return key;
+}
+
+std::string GetFilePath(const std::string& directory, uint64_t hash) { return absl::StrFormat("%s/%016x.binarypb", directory, hash); }
+
+std::optional<mediapipe::CalculatorGraphConfig> ReadConfig(const std::string& path, const std::string& key) {
+  std::ifstream file(path, std::ios::binary);
+  if (!file) {
+    return std::nullopt;
+  }
+  char magic[sizeof(kFileMagic)];
+  uint32_t version;
+  uint32_t byte_order_mark;
+  uint64_t build_fingerprint;
+  uint64_t key_size;
+  // NOTE: the version is checked after the byte order, since it's also written in the host byte order.
+  // The files written by another build are rejected, since its calculators or subgraphs may be different.
+  if (!file.read(magic, sizeof(magic)) || std::memcmp(magic, kFileMagic, sizeof(magic)) != 0 ||
+      !file.read(reinterpret_cast<char*>(&byte_order_mark), sizeof(byte_order_mark)) || byte_order_mark != kByteOrderMark ||
+      !file.read(reinterpret_cast<char*>(&version), sizeof(version)) || version != kFileFormatVersion ||
+      !file.read(reinterpret_cast<char*>(&build_fingerprint), sizeof(build_fingerprint)) || build_fingerprint != GetBuildFingerprint() ||
+      !file.read(reinterpret_cast<char*>(&key_size), sizeof(key_size)) || key_size != key.size()) {
+    return std::nullopt;
+  }
+  std::string stored_key(key_size, '\0');
+  if (!file.read(stored_key.data(), key_size) || stored_key != key) {
+    return std::nullopt;
+  }
+  std::string serialized_config{std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+  mediapipe::CalculatorGraphConfig config;
+  if (!config.ParseFromString(serialized_config)) {
+    return std::nullopt;
+  }
+  return config;
+}
+
+void WriteConfig(const std::string& path, const std::string& key, const mediapipe::CalculatorGraphConfig& config) {
+  WriteFileAtomically(path, [&](std::ostream& file) {
+    const uint64_t build_fingerprint = GetBuildFingerprint();
+    const uint64_t key_size = key.size();
+    file.write(kFileMagic, sizeof(kFileMagic));
+    file.write(reinterpret_cast<const char*>(&kByteOrderMark), sizeof(kByteOrderMark));
+    file.write(reinterpret_cast<const char*>(&kFileFormatVersion), sizeof(kFileFormatVersion));
+    file.write(reinterpret_cast<const char*>(&build_fingerprint), sizeof(build_fingerprint));
+    file.write(reinterpret_cast<const char*>(&key_size), sizeof(key_size));
+    file.write(key.data(), key.size());
+    return file && config.SerializeToOstream(&file);
+  });
+}
+
+bool UsesModelResources(const mediapipe::CalculatorGraphConfig& config) {
+  for (const auto& node : config.node()) {
+    if (node.calculator() == "ModelResourcesCalculator") {
+      return true;
+    }
+  }
+  return false;
+}
+
+}  // namespace
+
+ExpandedConfigCache& ExpandedConfigCache::GetInstance() {
+  static auto* instance = new ExpandedConfigCache();
+  return *instance;
+}
+
+mediapipe::CalculatorGraphConfig ExpandedConfigCache::GetConfig(const char* serialized_config, int size,
+                                                                const std::map<std::string, mediapipe::Packet>* side_packets) {
+  std::string directory;
+  {
+    absl::MutexLock lock(&mutex_);
+    if (!enabled_) {
+      return ParseFromStringAsProto<mediapipe::CalculatorGraphConfig>(serialized_config, size);
+    }
+    directory = directory_;
+  }
+
+  auto key = MakeKey(serialized_config, size, side_packets);
+  const auto hash = Fingerprint(key);
+  {
+    absl::MutexLock lock(&mutex_);
+    if (const auto* entry = Find(hash, key); entry != nullptr) {
+      ++hits_;
+      if (entry->config != nullptr) {
+        return *entry->config;
+      }
+      return ParseFromStringAsProto<mediapipe::CalculatorGraphConfig>(serialized_config, size);
+    }
+  }
+
+  // NOTE: the config is expanded without holding the lock, since it can take a while. If another thread expands the same config, the later one wins.
+  if (!directory.empty()) {
+    if (auto config = ReadConfig(GetFilePath(directory, hash), key); config) {
+      auto expanded_config = std::make_shared<const mediapipe::CalculatorGraphConfig>(*std::move(config));
+      absl::MutexLock lock(&mutex_);
+      ++disk_hits_;
+      Insert(hash, Entry{std::move(key), expanded_config});
+      return *expanded_config;
+    }
+  }
+
+  auto config = ParseFromStringAsProto<mediapipe::CalculatorGraphConfig>(serialized_config, size);
+  auto expanded_config = Expand(config);
+  if (expanded_config != nullptr && !directory.empty()) {
+    WriteConfig(GetFilePath(directory, hash), key, *expanded_config);
+  }
+
+  absl::MutexLock lock(&mutex_);
+  ++misses_;
+  Insert(hash, Entry{std::move(key), expanded_config});
+  return expanded_config == nullptr ? std::move(config) : *expanded_config;
+}
+
+std::shared_ptr<const mediapipe::CalculatorGraphConfig> ExpandedConfigCache::Expand(const mediapipe::CalculatorGraphConfig& config) {
+  mediapipe::ValidatedGraphConfig validated_config;
+  if (!validated_config.Initialize(config).ok()) {
+    // NOTE: the error will be reported when the graph is initialized with the original config.
+    return nullptr;
+  }
+  if (UsesModelResources(validated_config.Config())) {
+    return nullptr;
+  }
+  auto config_with_cached_anchors = validated_config.Config();
+  // NOTE: the anchors for the detection subgraphs are shared among the graphs, instead of being generated every time.
+  SsdAnchorsCache::GetInstance().ReplaceCalculators(&config_with_cached_anchors);
+  auto expanded_config = std::make_shared<const mediapipe::CalculatorGraphConfig>(std::move(config_with_cached_anchors));
+
+  // Validating the expanded config again must be a no-op, otherwise it cannot be used in place of the original one.
+  mediapipe::ValidatedGraphConfig revalidated_config;
+  if (!revalidated_config.Initialize(*expanded_config).ok() || revalidated_config.Config().SerializeAsString() != expanded_config->SerializeAsString()) {
+    return nullptr;
+  }
+  return expanded_config;
+}
+
+const ExpandedConfigCache::Entry* ExpandedConfigCache::Find(uint64_t hash, const std::string& key) {
+  auto it = entries_.find(hash);
+  if (it == entries_.end()) {
+    return nullptr;
+  }
+  for (auto& entry : it->second) {
+    if (entry.key == key) {
+      entry.last_used = ++use_counter_;
+      return &entry;
+    }
+  }
+  return nullptr;
+}
+
+void ExpandedConfigCache::Insert(uint64_t hash, Entry entry) {
+  entry.last_used = ++use_counter_;
+  if (auto it = entries_.find(hash); it != entries_.end()) {
+    for (auto& existing : it->second) {
+      if (existing.key == entry.key) {
+        existing = std::move(entry);
+        return;
+      }
+    }
+  }
+  if (entry_count_ >= kMaxEntries) {
+    EvictLeastRecentlyUsed();
+  }
+  entries_[hash].push_back(std::move(entry));
+  ++entry_count_;
+}
+
+void ExpandedConfigCache::EvictLeastRecentlyUsed() {
+  // NOTE: the entries are scanned linearly, since this happens only when a new config is inserted into the full cache.
+  decltype(entries_)::iterator victim_bucket = entries_.end();
+  size_t victim_index = 0;
+  for (auto it = entries_.begin(); it != entries_.end(); ++it) {
+    for (size_t i = 0; i < it->second.size(); ++i) {
+      if (victim_bucket == entries_.end() || it->second[i].last_used < victim_bucket->second[victim_index].last_used) {
+        victim_bucket = it;
+        victim_index = i;
+      }
+    }
+  }
+  if (victim_bucket == entries_.end()) {
+    return;
+  }
+  auto& bucket = victim_bucket->second;
+  bucket.erase(bucket.begin() + victim_index);
+  if (bucket.empty()) {
+    entries_.erase(victim_bucket);
+  }
+  --entry_count_;
+}
+
+bool ExpandedConfigCache::enabled() const {
+  absl::MutexLock lock(&mutex_);
+  return enabled_;
+}
+
+void ExpandedConfigCache::set_enabled(bool enabled) {
+  absl::MutexLock lock(&mutex_);
+  enabled_ = enabled;
+}
+
+void ExpandedConfigCache::SetDirectory(std::string directory) {
+  while (directory.size() > 1 && (directory.back() == '/' || directory.back() == '\\')) {
+    directory.pop_back();
+  }
+  absl::MutexLock lock(&mutex_);
+  directory_ = std::move(directory);
+}
+
+void ExpandedConfigCache::Clear() {
+  absl::MutexLock lock(&mutex_);
+  entries_.clear();
+  entry_count_ = 0;
+}
+
+ExpandedConfigCacheStats ExpandedConfigCache::GetStats() {
+  absl::MutexLock lock(&mutex_);
+  return ExpandedConfigCacheStats{hits_, disk_hits_, misses_, entry_count_};
+}
+
+}  // namespace mp_api
+
+bool mp_ExpandedConfigCache__enabled() { return mp_api::ExpandedConfigCache::GetInstance().enabled(); }
+
+void mp_ExpandedConfigCache__set_enabled__b(bool enabled) { mp_api::ExpandedConfigCache::GetInstance().set_enabled(enabled); }
+
+void mp_ExpandedConfigCache__SetDirectory__PKc(const char* directory) {
+  mp_api::ExpandedConfigCache::GetInstance().SetDirectory(directory == nullptr ? "" : directory);
+}
+
+void mp_ExpandedConfigCache__Clear() { mp_api::ExpandedConfigCache::GetInstance().Clear(); }
+
+void mp_ExpandedConfigCache__GetStats(mp_api::ExpandedConfigCacheStats* stats_out) { *stats_out = mp_api::ExpandedConfigCache::GetInstance().GetStats(); }
@@ -0,0 +1,113 @@
+// Copyright (c) 2026 homuler
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+#ifndef MEDIAPIPE_API_FRAMEWORK_EXPANDED_CONFIG_CACHE_H_
+#define MEDIAPIPE_API_FRAMEWORK_EXPANDED_CONFIG_CACHE_H_
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
+#include "absl/synchronization/mutex.h"
+#include "mediapipe/framework/calculator.pb.h"
+#include "mediapipe/framework/packet.h"
+#include "mediapipe_api/common.h"
+
+namespace mp_api {
+
+struct ExpandedConfigCacheStats {
+  // The number of the configs found in memory.
+  int64_t hits;
+  // The number of the configs loaded from the persistent directory.
+  int64_t disk_hits;
+  // The number of the configs expanded by the cache.
+  int64_t misses;
+  // The number of the configs currently in memory.
+  int64_t entries;
+};
+
+// A process-wide cache of the graph configs whose subgraphs are expanded, keyed by the hash of the serialized config and the side packet signature.
+// CalculatorGraph and ValidatedGraphConfig are initialized with the expanded config, so that subgraph expansion is skipped when the same config is used again.
+//
+// A config is not cached if the graph cannot be initialized with its expanded config in the same way (e.g. the MediaPipe Tasks graphs,
+// whose subgraphs load the model resources while they are expanded). In that case, the original config is used as is.
+//
+// If SsdAnchorsCache is enabled, SsdAnchorsCalculator nodes in the expanded config are replaced with CachedSsdAnchorsCalculator,
+// so that the graphs share the anchors.
+class ExpandedConfigCache {
+ public:
+  // The maximum number of the configs in memory. When it is exceeded, the least recently used config is evicted.
+  static constexpr int kMaxEntries = 256;
+
+  static ExpandedConfigCache& GetInstance();
+
+  // Returns the config equivalent to `serialized_config`, whose subgraphs are expanded if possible.
+  // If the cache is disabled, returns the parsed `serialized_config`.
+  mediapipe::CalculatorGraphConfig GetConfig(const char* serialized_config, int size, const std::map<std::string, mediapipe::Packet>* side_packets = nullptr);
+
+  // Expands the subgraphs in `config` regardless of whether the cache is enabled.
+  // Returns nullptr if `config` is invalid or the graph cannot be initialized with the expanded config in the same way.
+  static std::shared_ptr<const mediapipe::CalculatorGraphConfig> Expand(const mediapipe::CalculatorGraphConfig& config);
+
+  bool enabled() const;
+  void set_enabled(bool enabled);
+
+  // Sets the directory to which the expanded configs are written, and from which they are read when they are not in memory.
+  // The directory must exist. The files written by another build of the library are ignored and overwritten,
+  // because the expansion depends on the registered subgraphs (see GetBuildFingerprint).
+  // If `directory` is empty, the configs are not persisted.
+  void SetDirectory(std::string directory);
+
+  // Removes the configs in memory. The persisted ones are not removed.
+  void Clear();
+
+  ExpandedConfigCacheStats GetStats();
+
+ private:
+  struct Entry {
+    // The serialized config and the side packet signature, which are compared to resolve the hash collisions.
+    std::string key;
+    // nullptr if the config cannot be cached.
+    std::shared_ptr<const mediapipe::CalculatorGraphConfig> config;
+    // The value of the use counter when the entry was used last.
+    uint64_t last_used = 0;
+  };
+
+  ExpandedConfigCache() = default;
+
+  // Marks the found entry as used.
+  const Entry* Find(uint64_t hash, const std::string& key) ABSL_EXCLUSIVE_LOCKS_REQUIRED(mutex_);
+  void Insert(uint64_t hash, Entry entry) ABSL_EXCLUSIVE_LOCKS_REQUIRED(mutex_);
+  void EvictLeastRecentlyUsed() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mutex_);
+
+  mutable absl::Mutex mutex_;
+  bool enabled_ ABSL_GUARDED_BY(mutex_) = false;
+  std::string directory_ ABSL_GUARDED_BY(mutex_);
+  absl::flat_hash_map<uint64_t, std::vector<Entry>> entries_ ABSL_GUARDED_BY(mutex_);
+  int64_t entry_count_ ABSL_GUARDED_BY(mutex_) = 0;
+  uint64_t use_counter_ ABSL_GUARDED_BY(mutex_) = 0;
+  int64_t hits_ ABSL_GUARDED_BY(mutex_) = 0;
+  int64_t disk_hits_ ABSL_GUARDED_BY(mutex_) = 0;
+  int64_t misses_ ABSL_GUARDED_BY(mutex_) = 0;
+};
+
+}  // namespace mp_api
+
+extern "C" {
+
+MP_CAPI(bool) mp_ExpandedConfigCache__enabled();
+MP_CAPI(void) mp_ExpandedConfigCache__set_enabled__b(bool enabled);
+MP_CAPI(void) mp_ExpandedConfigCache__SetDirectory__PKc(const char* directory);
+MP_CAPI(void) mp_ExpandedConfigCache__Clear();
+MP_CAPI(void) mp_ExpandedConfigCache__GetStats(mp_api::ExpandedConfigCacheStats* stats_out);
+
+}  // extern "C"
+
+#endif  // MEDIAPIPE_API_FRAMEWORK_EXPANDED_CONFIG_CACHE_H_
@@ -7,9 +7,11 @@
 #include "mediapipe_api/framework/formats/classification.h"
 
 MpReturnCode mp_Packet__GetClassificationList(mediapipe::Packet* packet, mp_api::SerializedProto* value_out) {
+  MP_CAPI_NAMED_SPAN("mp_Packet__GetClassificationList");
   return mp_Packet__GetSerializedProto<mediapipe::ClassificationList>(packet, value_out);
 }
 
 MpReturnCode mp_Packet__GetClassificationListVector(mediapipe::Packet* packet, mp_api::StructArray<mp_api::SerializedProto>* value_out) {
+  MP_CAPI_NAMED_SPAN("mp_Packet__GetClassificationListVector");
   return mp_Packet__GetSerializedProtoVector<mediapipe::ClassificationList>(packet, value_out);
 }
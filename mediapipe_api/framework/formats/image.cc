@@ -81,6 +81,41 @@ MpReturnCode mp_Image__ConvertToGpu(mediapipe::Image* image, bool* result_out) {
   CATCH_ALL
 }
 
+namespace {
+absl::StatusOr<std::shared_ptr<const mediapipe::ImageFrame>> GetCpuImageFrame(mediapipe::Image* image) {
+  if (image->UsesGpu()) {
+    return absl::FailedPreconditionError("The image is on GPU, call ConvertToCpu first");
+  }
+  return image->GetImageFrameSharedPtr();
+}
+}  // namespace
+
+MpReturnCode mp_Image__ExportMask__i_i_f_Pui8_i(mediapipe::Image* image, int width, int height, float threshold, uint8_t* buffer, int buffer_size,
+                                                absl::Status** status_out) {
+  TRY_ALL
+    auto image_frame = GetCpuImageFrame(image);
+    if (!image_frame.ok()) {
+      *status_out = new absl::Status{image_frame.status()};
+    } else {
+      *status_out = new absl::Status{mp_api::ExportMask(**image_frame, width, height, threshold, buffer, buffer_size)};
+    }
+    RETURN_CODE(MpReturnCode::Success);
+  CATCH_ALL
+}
+
+MpReturnCode mp_Image__ExportCategoryMask__i_i_Pui_i_Pui8_i(mediapipe::Image* image, int width, int height, uint32_t* colors, int colors_size, uint8_t* buffer,
+                                                            int buffer_size, absl::Status** status_out) {
+  TRY_ALL
+    auto image_frame = GetCpuImageFrame(image);
+    if (!image_frame.ok()) {
+      *status_out = new absl::Status{image_frame.status()};
+    } else {
+      *status_out = new absl::Status{mp_api::ExportCategoryMask(**image_frame, width, height, colors, colors_size, buffer, buffer_size)};
+    }
+    RETURN_CODE(MpReturnCode::Success);
+  CATCH_ALL
+}
+
 MpReturnCode mp_PixelWriteLock__RI(mediapipe::Image* image, mediapipe::PixelWriteLock** pixel_Write_lock_out) {
   TRY
     *pixel_Write_lock_out = new mediapipe::PixelWriteLock{image};
@@ -119,10 +154,12 @@ MpReturnCode mp__MakeImagePacket_At__PI_ll(mediapipe::Image* image, int64_t time
 }
 
 MpReturnCode mp_Packet__ConsumeImage(mediapipe::Packet* packet, absl::Status **status_out, mediapipe::Image** value_out) {
+  MP_CAPI_NAMED_SPAN("mp_Packet__ConsumeImage");
   return mp_Packet__Consume(packet, status_out, value_out);
 }
 
 MpReturnCode mp_Packet__GetImage(mediapipe::Packet* packet, const mediapipe::Image** value_out) {
+  MP_CAPI_NAMED_SPAN("mp_Packet__GetImage");
   return mp_Packet__Get(packet, value_out);
 }
 
@@ -14,6 +14,7 @@
 #include "mediapipe/framework/formats/image.h"
 #include "mediapipe_api/framework/packet.h"
 #include "mediapipe_api/common.h"
+#include "mediapipe_api/util/segmentation_mask_util.h"
 
 #if !MEDIAPIPE_DISABLE_GPU
 
@@ -53,6 +54,10 @@ MP_CAPI(mediapipe::ImageFormat::Format) mp_Image__image_format(mediapipe::Image*
 MP_CAPI(mediapipe::GpuBufferFormat) mp_Image__format(mediapipe::Image* image);
 MP_CAPI(MpReturnCode) mp_Image__ConvertToCpu(mediapipe::Image* image, bool* result_out);
 MP_CAPI(MpReturnCode) mp_Image__ConvertToGpu(mediapipe::Image* image, bool* result_out);
+MP_CAPI(MpReturnCode) mp_Image__ExportMask__i_i_f_Pui8_i(mediapipe::Image* image, int width, int height, float threshold, uint8_t* buffer, int buffer_size,
+                                                         absl::Status** status_out);
+MP_CAPI(MpReturnCode) mp_Image__ExportCategoryMask__i_i_Pui_i_Pui8_i(mediapipe::Image* image, int width, int height, uint32_t* colors, int colors_size,
+                                                                     uint8_t* buffer, int buffer_size, absl::Status** status_out);
 
 MP_CAPI(MpReturnCode) mp_PixelWriteLock__RI(mediapipe::Image* image, mediapipe::PixelWriteLock** pixel_Write_lock_out);
 MP_CAPI(void) mp_PixelWriteLock__delete(mediapipe::PixelWriteLock* pixel_Write_lock);
@@ -31,7 +31,10 @@ MpReturnCode mp_ImageFrame__ui_i_i_i_Pui8_PF(mediapipe::ImageFormat::Format form
 
 void mp_ImageFrame__delete(mediapipe::ImageFrame* image_frame) { delete image_frame; }
 
-bool mp_ImageFrame__IsEmpty(mediapipe::ImageFrame* image_frame) { return image_frame->IsEmpty(); }
+bool mp_ImageFrame__IsEmpty(mediapipe::ImageFrame* image_frame) {
+  MP_CAPI_SPAN();
+  return image_frame->IsEmpty();
+}
 
 MpReturnCode mp_ImageFrame__SetToZero(mediapipe::ImageFrame* image_frame) {
   TRY
@@ -47,7 +50,10 @@ MpReturnCode mp_ImageFrame__SetAlignmentPaddingAreas(mediapipe::ImageFrame* imag
   CATCH_EXCEPTION
 }
 
-bool mp_ImageFrame__IsContiguous(mediapipe::ImageFrame* image_frame) { return image_frame->IsContiguous(); }
+bool mp_ImageFrame__IsContiguous(mediapipe::ImageFrame* image_frame) {
+  MP_CAPI_SPAN();
+  return image_frame->IsContiguous();
+}
 
 MpReturnCode mp_ImageFrame__IsAligned__ui(mediapipe::ImageFrame* image_frame, uint32_t alignment_boundary, bool* value_out) {
   TRY_ALL
@@ -56,15 +62,30 @@ MpReturnCode mp_ImageFrame__IsAligned__ui(mediapipe::ImageFrame* image_frame, ui
   CATCH_ALL
 }
 
-mediapipe::ImageFormat::Format mp_ImageFrame__Format(mediapipe::ImageFrame* image_frame) { return image_frame->Format(); }
+mediapipe::ImageFormat::Format mp_ImageFrame__Format(mediapipe::ImageFrame* image_frame) {
+  MP_CAPI_SPAN();
+  return image_frame->Format();
+}
 
-int mp_ImageFrame__Width(mediapipe::ImageFrame* image_frame) { return image_frame->Width(); }
+int mp_ImageFrame__Width(mediapipe::ImageFrame* image_frame) {
+  MP_CAPI_SPAN();
+  return image_frame->Width();
+}
 
-int mp_ImageFrame__Height(mediapipe::ImageFrame* image_frame) { return image_frame->Height(); }
+int mp_ImageFrame__Height(mediapipe::ImageFrame* image_frame) {
+  MP_CAPI_SPAN();
+  return image_frame->Height();
+}
 
-int mp_ImageFrame__WidthStep(mediapipe::ImageFrame* image_frame) { return image_frame->WidthStep(); }
+int mp_ImageFrame__WidthStep(mediapipe::ImageFrame* image_frame) {
+  MP_CAPI_SPAN();
+  return image_frame->WidthStep();
+}
 
-uint8_t* mp_ImageFrame__MutablePixelData(mediapipe::ImageFrame* image_frame) { return image_frame->MutablePixelData(); }
+uint8_t* mp_ImageFrame__MutablePixelData(mediapipe::ImageFrame* image_frame) {
+  MP_CAPI_SPAN();
+  return image_frame->MutablePixelData();
+}
 
 MpReturnCode mp_ImageFrame__CopyToBuffer__Pui8_i(mediapipe::ImageFrame* image_frame, uint8_t* buffer, int buffer_size) {
   TRY_ALL
@@ -87,6 +108,22 @@ MpReturnCode mp_ImageFrame__CopyToBuffer__Pf_i(mediapipe::ImageFrame* image_fram
   CATCH_ALL
 }
 
+MpReturnCode mp_ImageFrame__ExportMask__i_i_f_Pui8_i(mediapipe::ImageFrame* image_frame, int width, int height, float threshold, uint8_t* buffer,
+                                                     int buffer_size, absl::Status** status_out) {
+  TRY_ALL
+    *status_out = new absl::Status{mp_api::ExportMask(*image_frame, width, height, threshold, buffer, buffer_size)};
+    RETURN_CODE(MpReturnCode::Success);
+  CATCH_ALL
+}
+
+MpReturnCode mp_ImageFrame__ExportCategoryMask__i_i_Pui_i_Pui8_i(mediapipe::ImageFrame* image_frame, int width, int height, uint32_t* colors, int colors_size,
+                                                                 uint8_t* buffer, int buffer_size, absl::Status** status_out) {
+  TRY_ALL
+    *status_out = new absl::Status{mp_api::ExportCategoryMask(*image_frame, width, height, colors, colors_size, buffer, buffer_size)};
+    RETURN_CODE(MpReturnCode::Success);
+  CATCH_ALL
+}
+
 // Packet API
 MpReturnCode mp__MakeImageFramePacket__Pif(mediapipe::ImageFrame* image_frame, mediapipe::Packet** packet_out) {
   TRY
@@ -110,10 +147,14 @@ MpReturnCode mp__MakeImageFramePacket_At__Pif_ll(mediapipe::ImageFrame* image_fr
 }
 
 MpReturnCode mp_Packet__ConsumeImageFrame(mediapipe::Packet* packet, absl::Status** status_out, mediapipe::ImageFrame** value_out) {
+  MP_CAPI_NAMED_SPAN("mp_Packet__ConsumeImageFrame");
   return mp_Packet__Consume(packet, status_out, value_out);
 }
 
-MpReturnCode mp_Packet__GetImageFrame(mediapipe::Packet* packet, const mediapipe::ImageFrame** value_out) { return mp_Packet__Get(packet, value_out); }
+MpReturnCode mp_Packet__GetImageFrame(mediapipe::Packet* packet, const mediapipe::ImageFrame** value_out) {
+  MP_CAPI_NAMED_SPAN("mp_Packet__GetImageFrame");
+  return mp_Packet__Get(packet, value_out);
+}
 
 MpReturnCode mp_Packet__ValidateAsImageFrame(mediapipe::Packet* packet, absl::Status** status_out) {
   TRY
@@ -14,6 +14,7 @@
 #include "mediapipe_api/common.h"
 #include "mediapipe_api/external/absl/status.h"
 #include "mediapipe_api/framework/packet.h"
+#include "mediapipe_api/util/segmentation_mask_util.h"
 
 extern "C" {
 
@@ -38,6 +39,10 @@ MP_CAPI(uint8_t*) mp_ImageFrame__MutablePixelData(mediapipe::ImageFrame* image_f
 MP_CAPI(MpReturnCode) mp_ImageFrame__CopyToBuffer__Pui8_i(mediapipe::ImageFrame* image_frame, uint8_t* buffer, int buffer_size);
 MP_CAPI(MpReturnCode) mp_ImageFrame__CopyToBuffer__Pui16_i(mediapipe::ImageFrame* image_frame, uint16_t* buffer, int buffer_size);
 MP_CAPI(MpReturnCode) mp_ImageFrame__CopyToBuffer__Pf_i(mediapipe::ImageFrame* image_frame, float* buffer, int buffer_size);
+MP_CAPI(MpReturnCode) mp_ImageFrame__ExportMask__i_i_f_Pui8_i(mediapipe::ImageFrame* image_frame, int width, int height, float threshold, uint8_t* buffer,
+                                                              int buffer_size, absl::Status** status_out);
+MP_CAPI(MpReturnCode) mp_ImageFrame__ExportCategoryMask__i_i_Pui_i_Pui8_i(mediapipe::ImageFrame* image_frame, int width, int height, uint32_t* colors,
+                                                                          int colors_size, uint8_t* buffer, int buffer_size, absl::Status** status_out);
 
 // Packet API
 MP_CAPI(MpReturnCode) mp__MakeImageFramePacket__Pif(mediapipe::ImageFrame* image_frame, mediapipe::Packet** packet_out);
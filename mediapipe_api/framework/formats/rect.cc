@@ -24,10 +24,12 @@ MpReturnCode mp__MakeRectPacket_At__PKc_i_Rt(const char* serialized_data, int si
 }
 
 MpReturnCode mp_Packet__GetRect(mediapipe::Packet* packet, mp_api::SerializedProto* value_out) {
+  MP_CAPI_NAMED_SPAN("mp_Packet__GetRect");
   return mp_Packet__GetSerializedProto<mediapipe::Rect>(packet, value_out);
 }
 
 MpReturnCode mp_Packet__GetRectVector(mediapipe::Packet* packet, mp_api::StructArray<mp_api::SerializedProto>* value_out) {
+  MP_CAPI_NAMED_SPAN("mp_Packet__GetRectVector");
   return mp_Packet__GetSerializedProtoVector<mediapipe::Rect>(packet, value_out);
 }
 
@@ -56,10 +58,12 @@ MpReturnCode mp__MakeNormalizedRectPacket_At__PKc_i_Rt(const char* serialized_da
 }
 
 MpReturnCode mp_Packet__GetNormalizedRect(mediapipe::Packet* packet, mp_api::SerializedProto* value_out) {
+  MP_CAPI_NAMED_SPAN("mp_Packet__GetNormalizedRect");
   return mp_Packet__GetSerializedProto<mediapipe::NormalizedRect>(packet, value_out);
 }
 
 MpReturnCode mp_Packet__GetNormalizedRectVector(mediapipe::Packet* packet, mp_api::StructArray<mp_api::SerializedProto>* value_out) {
+  MP_CAPI_NAMED_SPAN("mp_Packet__GetNormalizedRectVector");
   return mp_Packet__GetSerializedProtoVector<mediapipe::NormalizedRect>(packet, value_out);
 }
 
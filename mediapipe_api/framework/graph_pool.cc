@@ -0,0 +1,246 @@
+// Copyright (c) 2026 homuler
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+#include "mediapipe_api/framework/graph_pool.h"
+
+#include <algorithm>
+#include <thread>
+#include <utility>
+
+#include "absl/memory/memory.h"
+#include "absl/strings/str_cat.h"
+#include "absl/time/clock.h"
+#include "mediapipe/framework/port/status_macros.h"
+#include "mediapipe/framework/tool/validate_name.h"
+#include "mediapipe_api/external/protobuf.h"
+
+namespace mp_api {
+
+absl::StatusOr<std::unique_ptr<GraphPool>> GraphPool::Create(mediapipe::CalculatorGraphConfig config, int pool_size,
+                                                             std::shared_ptr<mediapipe::Executor> executor, int max_queue_size) {
+  if (pool_size <= 0) {
+    return absl::InvalidArgumentError(absl::StrCat("pool_size must be positive, but got ", pool_size));
+  }
+  if (executor == nullptr) {
+    const int num_threads = std::max(1u, std::thread::hardware_concurrency());
+    MP_ASSIGN_OR_RETURN(executor, ThreadPoolExecutor::Create(num_threads, "mp_api_graph_pool", 0, {}));
+  }
+
+  auto graph_pool = absl::WrapUnique(new GraphPool());
+  graph_pool->model_assets_ = SharedModelCache::GetInstance().ShareModelAssets(config);
+
+  std::vector<std::string> input_stream_names;
+  for (const auto& input_stream : config.input_stream()) {
+    std::string tag, name;
+    int index;
+    MP_RETURN_IF_ERROR(mediapipe::tool::ParseTagIndexName(input_stream, &tag, &index, &name));
+    input_stream_names.push_back(std::move(name));
+  }
+
+  for (auto i = 0; i < pool_size; ++i) {
+    auto stream = std::make_unique<Stream>();
+    stream->graph = std::make_unique<mediapipe::CalculatorGraph>();
+    MP_RETURN_IF_ERROR(stream->graph->SetExecutor("", executor));
+    MP_RETURN_IF_ERROR(stream->graph->Initialize(config));
+    if (max_queue_size > 0) {
+      stream->graph->SetGraphInputStreamAddMode(mediapipe::CalculatorGraph::GraphInputStreamAddMode::ADD_IF_NOT_FULL);
+      for (const auto& name : input_stream_names) {
+        MP_RETURN_IF_ERROR(stream->graph->SetInputStreamMaxQueueSize(name, max_queue_size));
+      }
+    }
+    graph_pool->streams_.push_back(std::move(stream));
+  }
+  return graph_pool;
+}
+
+GraphPool::~GraphPool() {
+  for (auto& stream : streams_) {
+    if (stream->started && !stream->closed) {
+      stream->graph->Cancel();
+    }
+  }
+  for (auto& stream : streams_) {
+    if (stream->started && !stream->closed) {
+      stream->graph->WaitUntilDone().IgnoreError();
+    }
+  }
+}
+
+absl::Status GraphPool::ObserveOutputStream(const std::string& stream_name, PacketCallback callback) {
+  for (auto i = 0; i < pool_size(); ++i) {
+    auto* stream = streams_[i].get();
+    MP_RETURN_IF_ERROR(stream->graph->ObserveOutputStream(stream_name, [i, stream, callback](const mediapipe::Packet& packet) -> absl::Status {
+      stream->packets_out.fetch_add(1, std::memory_order_relaxed);
+      return callback(i, packet);
+    }));
+  }
+  return absl::OkStatus();
+}
+
+absl::Status GraphPool::StartRun(const std::map<std::string, mediapipe::Packet>& side_packets) {
+  for (auto& stream : streams_) {
+    MP_RETURN_IF_ERROR(stream->graph->StartRun(side_packets));
+    stream->started = true;
+  }
+  start_time_ns_.store(absl::GetCurrentTimeNanos());
+  return absl::OkStatus();
+}
+
+absl::Status GraphPool::AddPacketToInputStream(int stream_id, const std::string& stream_name, mediapipe::Packet packet) {
+  MP_RETURN_IF_ERROR(ValidateStreamId(stream_id));
+
+  auto& stream = *streams_[stream_id];
+  auto status = stream.graph->AddPacketToInputStream(stream_name, std::move(packet));
+  if (status.ok()) {
+    stream.packets_in.fetch_add(1, std::memory_order_relaxed);
+  } else if (absl::IsUnavailable(status)) {
+    stream.packets_rejected.fetch_add(1, std::memory_order_relaxed);
+  }
+  return status;
+}
+
+absl::Status GraphPool::CloseStream(int stream_id) {
+  MP_RETURN_IF_ERROR(ValidateStreamId(stream_id));
+
+  auto& stream = *streams_[stream_id];
+  MP_RETURN_IF_ERROR(stream.graph->CloseAllPacketSources());
+  auto status = stream.graph->WaitUntilDone();
+  stream.closed = true;
+  return status;
+}
+
+absl::Status GraphPool::Close() {
+  absl::Status status;
+  for (auto& stream : streams_) {
+    if (stream->started && !stream->closed) {
+      status.Update(stream->graph->CloseAllPacketSources());
+    }
+  }
+  for (auto& stream : streams_) {
+    if (stream->started && !stream->closed) {
+      status.Update(stream->graph->WaitUntilDone());
+      stream->closed = true;
+    }
+  }
+  return status;
+}
+
+absl::StatusOr<GraphPoolStats> GraphPool::GetStreamStats(int stream_id) const {
+  MP_RETURN_IF_ERROR(ValidateStreamId(stream_id));
+
+  const auto& stream = *streams_[stream_id];
+  GraphPoolStats stats{stream.packets_in.load(std::memory_order_relaxed), stream.packets_rejected.load(std::memory_order_relaxed),
+                       stream.packets_out.load(std::memory_order_relaxed), 0};
+  const auto elapsed = ElapsedSeconds();
+  stats.throughput = elapsed > 0 ? stats.packets_out / elapsed : 0;
+  return stats;
+}
+
+GraphPoolStats GraphPool::GetStats() const {
+  GraphPoolStats stats{0, 0, 0, 0};
+  for (const auto& stream : streams_) {
+    stats.packets_in += stream->packets_in.load(std::memory_order_relaxed);
+    stats.packets_rejected += stream->packets_rejected.load(std::memory_order_relaxed);
+    stats.packets_out += stream->packets_out.load(std::memory_order_relaxed);
+  }
+  const auto elapsed = ElapsedSeconds();
+  stats.throughput = elapsed > 0 ? stats.packets_out / elapsed : 0;
+  return stats;
+}
+
+absl::Status GraphPool::ValidateStreamId(int stream_id) const {
+  if (stream_id < 0 || stream_id >= pool_size()) {
+    return absl::OutOfRangeError(absl::StrCat("stream_id must be in [0, ", pool_size(), "), but got ", stream_id));
+  }
+  return absl::OkStatus();
+}
+
+double GraphPool::ElapsedSeconds() const {
+  const auto start_time_ns = start_time_ns_.load();
+  if (start_time_ns == 0) {
+    return 0;
+  }
+  return (absl::GetCurrentTimeNanos() - start_time_ns) / 1e9;
+}
+
+}  // namespace mp_api
+
+MpReturnCode mp_GraphPool_Create__PKc_i_i_Pe_i(const char* serialized_config, int size, int pool_size, SharedExecutor* executor, int max_queue_size,
+                                               absl::Status** status_out, mp_api::GraphPool** graph_pool_out) {
+  TRY_ALL
+    auto config = ParseFromStringAsProto<mediapipe::CalculatorGraphConfig>(serialized_config, size);
+    auto status_or_graph_pool = mp_api::GraphPool::Create(std::move(config), pool_size, executor == nullptr ? nullptr : *executor, max_queue_size);
+    *status_out = new absl::Status{status_or_graph_pool.status()};
+    if (status_or_graph_pool.ok()) {
+      *graph_pool_out = std::move(status_or_graph_pool).value().release();
+    } else {
+      *graph_pool_out = nullptr;
+    }
+    RETURN_CODE(MpReturnCode::Success);
+  CATCH_ALL
+}
+
+void mp_GraphPool__delete(mp_api::GraphPool* graph_pool) { delete graph_pool; }
+
+MpReturnCode mp_GraphPool__ObserveOutputStream__PKc_i_PF(mp_api::GraphPool* graph_pool, const char* stream_name, int callback_id,
+                                                         NativeGraphPoolPacketCallback* packet_callback, absl::Status** status_out) {
+  TRY_ALL
+    auto status = graph_pool->ObserveOutputStream(stream_name, [callback_id, packet_callback](int stream_id, const mediapipe::Packet& packet) -> absl::Status {
+      auto status_args = packet_callback(stream_id, callback_id, packet);
+      auto callback_status = absl::Status{status_args.code, absl::NullSafeStringView((const char*)status_args.message)};
+      if (status_args.message != nullptr) {
+        mp_api::freeHGlobal(status_args.message);
+      }
+      return callback_status;
+    });
+    *status_out = new absl::Status{std::move(status)};
+    RETURN_CODE(MpReturnCode::Success);
+  CATCH_ALL
+}
+
+MpReturnCode mp_GraphPool__StartRun__Rsp(mp_api::GraphPool* graph_pool, std::map<std::string, mediapipe::Packet>* side_packets, absl::Status** status_out) {
+  TRY
+    *status_out = new absl::Status{graph_pool->StartRun(*side_packets)};
+    RETURN_CODE(MpReturnCode::Success);
+  CATCH_EXCEPTION
+}
+
+MpReturnCode mp_GraphPool__AddPacketToInputStream__i_PKc_Ppacket(mp_api::GraphPool* graph_pool, int stream_id, const char* stream_name,
+                                                                 mediapipe::Packet* packet, absl::Status** status_out) {
+  TRY
+    *status_out = new absl::Status{graph_pool->AddPacketToInputStream(stream_id, stream_name, std::move(*packet))};
+    RETURN_CODE(MpReturnCode::Success);
+  CATCH_EXCEPTION
+}
+
+MpReturnCode mp_GraphPool__CloseStream__i(mp_api::GraphPool* graph_pool, int stream_id, absl::Status** status_out) {
+  TRY
+    *status_out = new absl::Status{graph_pool->CloseStream(stream_id)};
+    RETURN_CODE(MpReturnCode::Success);
+  CATCH_EXCEPTION
+}
+
+MpReturnCode mp_GraphPool__Close(mp_api::GraphPool* graph_pool, absl::Status** status_out) {
+  TRY
+    *status_out = new absl::Status{graph_pool->Close()};
+    RETURN_CODE(MpReturnCode::Success);
+  CATCH_EXCEPTION
+}
+
+int mp_GraphPool__pool_size(mp_api::GraphPool* graph_pool) { return graph_pool->pool_size(); }
+
+MpReturnCode mp_GraphPool__GetStreamStats__i(mp_api::GraphPool* graph_pool, int stream_id, absl::Status** status_out, mp_api::GraphPoolStats* stats_out) {
+  TRY
+    auto status_or_stats = graph_pool->GetStreamStats(stream_id);
+    *status_out = new absl::Status{status_or_stats.status()};
+    if (status_or_stats.ok()) {
+      *stats_out = *status_or_stats;
+    }
+    RETURN_CODE(MpReturnCode::Success);
+  CATCH_EXCEPTION
+}
+
+void mp_GraphPool__GetStats(mp_api::GraphPool* graph_pool, mp_api::GraphPoolStats* stats_out) { *stats_out = graph_pool->GetStats(); }
@@ -0,0 +1,125 @@
+// Copyright (c) 2026 homuler
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+#ifndef MEDIAPIPE_API_FRAMEWORK_GRAPH_POOL_H_
+#define MEDIAPIPE_API_FRAMEWORK_GRAPH_POOL_H_
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "absl/status/statusor.h"
+#include "mediapipe/framework/calculator_graph.h"
+#include "mediapipe/framework/executor.h"
+#include "mediapipe_api/common.h"
+#include "mediapipe_api/external/absl/status.h"
+#include "mediapipe_api/framework/thread_pool_executor.h"
+#include "mediapipe_api/tasks/cc/core/shared_model_cache.h"
+
+namespace mp_api {
+
+struct GraphPoolStats {
+  // The number of the packets added to the graph input streams.
+  int64_t packets_in;
+  // The number of the packets rejected because the input streams were full.
+  int64_t packets_rejected;
+  // The number of the packets passed to the output stream observers.
+  int64_t packets_out;
+  // `packets_out` per second since StartRun.
+  double throughput;
+};
+
+// Runs one graph per input stream (e.g. per camera) using the same config.
+// The graphs share one executor and the model assets, and the packets are routed to the graphs by the stream id.
+//
+// Since the worker threads are shared, they are spent on whichever streams have work to do.
+// To keep a busy stream from occupying them, `max_queue_size` can bound the number of the packets queued in each graph,
+// in which case AddPacketToInputStream fails with kUnavailable instead of queueing more packets.
+class GraphPool {
+ public:
+  // Called on the graph threads with the stream id and the output packet.
+  using PacketCallback = std::function<absl::Status(int stream_id, const mediapipe::Packet&)>;
+
+  // If `executor` is null, a thread pool whose size is the number of the CPU cores is created.
+  // If `max_queue_size` is not positive, the input streams are not bounded.
+  static absl::StatusOr<std::unique_ptr<GraphPool>> Create(mediapipe::CalculatorGraphConfig config, int pool_size,
+                                                           std::shared_ptr<mediapipe::Executor> executor, int max_queue_size);
+
+  ~GraphPool();
+
+  // Must be called before StartRun.
+  absl::Status ObserveOutputStream(const std::string& stream_name, PacketCallback callback);
+
+  absl::Status StartRun(const std::map<std::string, mediapipe::Packet>& side_packets);
+
+  absl::Status AddPacketToInputStream(int stream_id, const std::string& stream_name, mediapipe::Packet packet);
+
+  // Closes the input streams of the graph for `stream_id`, and waits until it's done.
+  absl::Status CloseStream(int stream_id);
+
+  // Closes the input streams of all the graphs, and waits until they are done.
+  absl::Status Close();
+
+  absl::StatusOr<GraphPoolStats> GetStreamStats(int stream_id) const;
+  // Returns the sum of the stats of all the streams.
+  GraphPoolStats GetStats() const;
+
+  int pool_size() const { return static_cast<int>(streams_.size()); }
+
+ private:
+  struct Stream {
+    std::unique_ptr<mediapipe::CalculatorGraph> graph;
+    std::atomic<int64_t> packets_in{0};
+    std::atomic<int64_t> packets_rejected{0};
+    std::atomic<int64_t> packets_out{0};
+    // NOTE: StartRun can fail after some of the graphs have started, so it's tracked per stream.
+    std::atomic<bool> started{false};
+    std::atomic<bool> closed{false};
+  };
+
+  GraphPool() = default;
+
+  absl::Status ValidateStreamId(int stream_id) const;
+  double ElapsedSeconds() const;
+
+  // NOTE: the model assets must outlive the graphs, so declare them first.
+  std::vector<SharedModelCache::Handle> model_assets_;
+  std::vector<std::unique_ptr<Stream>> streams_;
+  // The time StartRun is called, in nanoseconds since the epoch. 0 if the graphs have not started yet.
+  std::atomic<int64_t> start_time_ns_{0};
+};
+
+}  // namespace mp_api
+
+extern "C" {
+
+typedef mp_api::StatusArgs NativeGraphPoolPacketCallback(int stream_id, int callback_id, const mediapipe::Packet&);
+
+MP_CAPI(MpReturnCode) mp_GraphPool_Create__PKc_i_i_Pe_i(const char* serialized_config, int size, int pool_size, SharedExecutor* executor, int max_queue_size,
+                                                        absl::Status** status_out, mp_api::GraphPool** graph_pool_out);
+MP_CAPI(void) mp_GraphPool__delete(mp_api::GraphPool* graph_pool);
+
+MP_CAPI(MpReturnCode) mp_GraphPool__ObserveOutputStream__PKc_i_PF(mp_api::GraphPool* graph_pool, const char* stream_name, int callback_id,
+                                                                  NativeGraphPoolPacketCallback* packet_callback, absl::Status** status_out);
+MP_CAPI(MpReturnCode) mp_GraphPool__StartRun__Rsp(mp_api::GraphPool* graph_pool, std::map<std::string, mediapipe::Packet>* side_packets,
+                                                  absl::Status** status_out);
+MP_CAPI(MpReturnCode) mp_GraphPool__AddPacketToInputStream__i_PKc_Ppacket(mp_api::GraphPool* graph_pool, int stream_id, const char* stream_name,
+                                                                          mediapipe::Packet* packet, absl::Status** status_out);
+MP_CAPI(MpReturnCode) mp_GraphPool__CloseStream__i(mp_api::GraphPool* graph_pool, int stream_id, absl::Status** status_out);
+MP_CAPI(MpReturnCode) mp_GraphPool__Close(mp_api::GraphPool* graph_pool, absl::Status** status_out);
+
+MP_CAPI(int) mp_GraphPool__pool_size(mp_api::GraphPool* graph_pool);
+MP_CAPI(MpReturnCode) mp_GraphPool__GetStreamStats__i(mp_api::GraphPool* graph_pool, int stream_id, absl::Status** status_out,
+                                                      mp_api::GraphPoolStats* stats_out);
+MP_CAPI(void) mp_GraphPool__GetStats(mp_api::GraphPool* graph_pool, mp_api::GraphPoolStats* stats_out);
+
+}  // extern "C"
+
+#endif  // MEDIAPIPE_API_FRAMEWORK_GRAPH_POOL_H_
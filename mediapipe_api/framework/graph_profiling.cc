@@ -0,0 +1,193 @@
+// Copyright (c) 2026 homuler
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+#include "mediapipe_api/framework/graph_profiling.h"
+
+#include <algorithm>
+
+#include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
+#include "mediapipe/framework/calculator_profile.pb.h"
+#include "mediapipe/framework/port.h"
+#include "mediapipe/framework/port/file_helpers.h"
+#include "mediapipe/framework/port/status_macros.h"
+
+namespace mp_api {
+
+namespace {
+
+bool IsProfilerConfigured(const mediapipe::CalculatorGraphConfig& config) {
+  return config.profiler_config().enable_profiler() || config.profiler_config().trace_enabled();
+}
+
+void AppendJsonString(std::string* out, absl::string_view str) {
+  out->push_back('"');
+  for (const char c : str) {
+    switch (c) {
+      case '"':
+        out->append("\\\"");
+        break;
+      case '\\':
+        out->append("\\\\");
+        break;
+      default:
+        if (static_cast<unsigned char>(c) < 0x20) {
+          absl::StrAppend(out, "\\u", absl::Hex(static_cast<unsigned char>(c), absl::kZeroPad4));
+        } else {
+          out->push_back(c);
+        }
+    }
+  }
+  out->push_back('"');
+}
+
+// Converts `trace` to the Chrome trace event format.
+// @see https://docs.google.com/document/d/1CvAClvFfyA5R-PhYUmn5OOQtYMH4h6I0nSsKchNAySU
+std::string ToChromeTrace(const mediapipe::GraphTrace& trace) {
+  std::string json = R"({"displayTimeUnit":"ms","traceEvents":[{"name":"process_name","ph":"M","pid":1,"args":{"name":"CalculatorGraph"}})";
+  for (const auto& event : trace.calculator_trace()) {
+    if (!event.has_start_time() && !event.has_finish_time()) {
+      continue;
+    }
+    const auto node_id = event.node_id();
+    const auto& event_type = mediapipe::GraphTrace::EventType_Name(event.event_type());
+
+    json.append(",{\"name\":");
+    AppendJsonString(&json, node_id >= 0 && node_id < trace.calculator_name_size() ? trace.calculator_name(node_id) : event_type);
+    json.append(",\"cat\":");
+    AppendJsonString(&json, event_type);
+    // NOTE: the times in the trace are relative to base_time, which is in microseconds since the epoch.
+    if (event.has_start_time() && event.has_finish_time()) {
+      absl::StrAppend(&json, ",\"ph\":\"X\",\"ts\":", trace.base_time() + event.start_time(), ",\"dur\":", event.finish_time() - event.start_time());
+    } else {
+      const auto time = event.has_start_time() ? event.start_time() : event.finish_time();
+      absl::StrAppend(&json, ",\"ph\":\"i\",\"s\":\"t\",\"ts\":", trace.base_time() + time);
+    }
+    absl::StrAppend(&json, ",\"pid\":1,\"tid\":", event.thread_id(), ",\"args\":{\"node_id\":", node_id, ",\"input_timestamp\":",
+                    trace.base_timestamp() + event.input_timestamp(), "}}");
+  }
+  json.append("]}");
+  return json;
+}
+
+}  // namespace
+
+GraphProfiling& GraphProfiling::GetInstance() {
+  static auto* profiling = new GraphProfiling();
+  return *profiling;
+}
+
+void GraphProfiling::Configure(mediapipe::CalculatorGraphConfig* config) const {
+  if (!enabled() || config->has_profiler_config()) {
+    return;
+  }
+  auto* profiler_config = config->mutable_profiler_config();
+  profiler_config->set_enable_profiler(true);
+  profiler_config->set_histogram_interval_size_usec(kHistogramIntervalUsec);
+  profiler_config->set_num_histogram_intervals(kNumHistogramIntervals);
+  profiler_config->set_trace_enabled(true);
+  // NOTE: the trace is kept in memory until it's written by WriteTrace.
+  profiler_config->set_trace_log_disabled(true);
+  profiler_config->set_trace_log_margin_usec(0);
+}
+
+absl::Status GraphProfiling::SetProfilingEnabled(mediapipe::CalculatorGraph& graph, bool enabled) {
+  if (!IsProfilerConfigured(graph.Config())) {
+    return absl::FailedPreconditionError("The profiler is not configured. Enable GraphProfiling before creating the graph, or set profiler_config");
+  }
+  {
+    absl::MutexLock lock(&mutex_);
+    if (enabled) {
+      profiling_graphs_.insert(&graph);
+    } else {
+      profiling_graphs_.erase(&graph);
+    }
+  }
+  if (enabled) {
+    graph.profiler()->Resume();
+  } else {
+    graph.profiler()->Pause();
+  }
+  return absl::OkStatus();
+}
+
+void GraphProfiling::OnStartRun(mediapipe::CalculatorGraph& graph) {
+  if (!IsProfilerConfigured(graph.Config())) {
+    return;
+  }
+  absl::MutexLock lock(&mutex_);
+  if (!profiling_graphs_.contains(&graph)) {
+    graph.profiler()->Pause();
+  }
+}
+
+void GraphProfiling::Detach(const mediapipe::CalculatorGraph* graph) {
+  absl::MutexLock lock(&mutex_);
+  profiling_graphs_.erase(graph);
+}
+
+absl::Status GraphProfiling::GetCalculatorProfiles(mediapipe::CalculatorGraph& graph, StructArray<CalculatorProfileStats>* value_out) {
+#if MEDIAPIPE_PROFILING
+  std::vector<mediapipe::CalculatorProfile> profiles;
+  if (graph.Config().profiler_config().enable_profiler()) {
+    MP_RETURN_IF_ERROR(graph.profiler()->GetCalculatorProfiles(&profiles));
+  }
+
+  auto data = new CalculatorProfileStats[profiles.size()];
+  for (size_t i = 0; i < profiles.size(); ++i) {
+    const auto& profile = profiles[i];
+    const auto& histogram = profile.process_runtime();
+    auto& stats = data[i];
+    stats.name = strcpy_to_heap(profile.name());
+    stats.open_runtime_us = profile.open_runtime();
+    stats.close_runtime_us = profile.close_runtime();
+    stats.process_runtime_us = histogram.total();
+    stats.interval_size_us = histogram.interval_size_usec();
+    stats.num_intervals = histogram.count_size();
+    stats.process_histogram = new int64_t[histogram.count_size()];
+    std::copy(histogram.count().begin(), histogram.count().end(), stats.process_histogram);
+    stats.process_count = 0;
+    for (const auto count : histogram.count()) {
+      stats.process_count += count;
+    }
+  }
+  value_out->data = data;
+  value_out->size = static_cast<int>(profiles.size());
+  return absl::OkStatus();
+#else
+  return absl::UnimplementedError("The native library is built without the MediaPipe profiler");
+#endif  // MEDIAPIPE_PROFILING
+}
+
+absl::Status GraphProfiling::WriteTrace(mediapipe::CalculatorGraph& graph, const std::string& path, absl::Duration duration) {
+#if MEDIAPIPE_PROFILING
+  auto* tracer = graph.profiler()->tracer();
+  if (tracer == nullptr) {
+    return absl::FailedPreconditionError("The tracer is not enabled. Enable GraphProfiling before creating the graph, or set profiler_config.trace_enabled");
+  }
+  // NOTE: the tracer keeps a limited number of the recent events (ProfilerConfig.trace_log_capacity), so the trace may be shorter than `duration`.
+  const auto end_time = absl::Now();
+  mediapipe::GraphTrace trace;
+  tracer->GetTrace(end_time - duration, end_time, &trace);
+  return mediapipe::file::SetContents(path, ToChromeTrace(trace));
+#else
+  return absl::UnimplementedError("The native library is built without the MediaPipe profiler");
+#endif  // MEDIAPIPE_PROFILING
+}
+
+}  // namespace mp_api
+
+bool mp_GraphProfiling__enabled() { return mp_api::GraphProfiling::GetInstance().enabled(); }
+
+void mp_GraphProfiling__set_enabled__b(bool enabled) { mp_api::GraphProfiling::GetInstance().set_enabled(enabled); }
+
+void mp_api_CalculatorProfileStatsArray__delete(mp_api::StructArray<mp_api::CalculatorProfileStats> array) {
+  for (int i = 0; i < array.size; ++i) {
+    delete[] array.data[i].name;
+    delete[] array.data[i].process_histogram;
+  }
+  delete[] array.data;
+}
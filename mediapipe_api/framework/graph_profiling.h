@@ -0,0 +1,89 @@
+// Copyright (c) 2026 homuler
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+#ifndef MEDIAPIPE_API_FRAMEWORK_GRAPH_PROFILING_H_
+#define MEDIAPIPE_API_FRAMEWORK_GRAPH_PROFILING_H_
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_set.h"
+#include "absl/status/status.h"
+#include "absl/synchronization/mutex.h"
+#include "absl/time/time.h"
+#include "mediapipe/framework/calculator.pb.h"
+#include "mediapipe/framework/calculator_graph.h"
+#include "mediapipe_api/common.h"
+
+namespace mp_api {
+
+struct CalculatorProfileStats {
+  // The name of the calculator node.
+  const char* name;
+  int64_t open_runtime_us;
+  int64_t close_runtime_us;
+  // The number of the Process calls, and the total time taken by them.
+  int64_t process_count;
+  int64_t process_runtime_us;
+  // The histogram of the time taken by Process. The i-th bucket counts the calls that took [i, i + 1) * interval_size_us,
+  // and the last bucket also counts the slower calls.
+  int64_t interval_size_us;
+  int32_t num_intervals;
+  int64_t* process_histogram;
+};
+
+// Lets the CalculatorGraphs created through the C API be profiled by the MediaPipe profiler, which is paused until it's turned on for each graph.
+// While the profiler is paused, the graph only checks a flag, so it's cheap enough to be enabled in release builds.
+class GraphProfiling {
+ public:
+  // The default histogram of the Process runtime, i.e. 1ms * 32 buckets.
+  static constexpr int64_t kHistogramIntervalUsec = 1000;
+  static constexpr int kNumHistogramIntervals = 32;
+
+  static GraphProfiling& GetInstance();
+
+  // It's disabled by default. Only the graphs created while it's enabled can be profiled.
+  bool enabled() const { return enabled_.load(std::memory_order_relaxed); }
+  void set_enabled(bool enabled) { enabled_.store(enabled, std::memory_order_relaxed); }
+
+  // Enables the profiler and the tracer of the graph unless they are configured by the user.
+  void Configure(mediapipe::CalculatorGraphConfig* config) const;
+
+  // Turns the profiler of `graph` on or off. It's off when the graph is created.
+  absl::Status SetProfilingEnabled(mediapipe::CalculatorGraph& graph, bool enabled);
+  // Pauses the profiler unless it's turned on, because the graph resumes it whenever it starts a run.
+  void OnStartRun(mediapipe::CalculatorGraph& graph);
+  void Detach(const mediapipe::CalculatorGraph* graph);
+
+  // Copies the stats of the calculators to a new array, which must be deleted by mp_api_CalculatorProfileStatsArray__delete.
+  static absl::Status GetCalculatorProfiles(mediapipe::CalculatorGraph& graph, StructArray<CalculatorProfileStats>* value_out);
+
+  // Writes the trace events of the last `duration` to `path` in the Chrome trace event format, which can be opened by Perfetto.
+  static absl::Status WriteTrace(mediapipe::CalculatorGraph& graph, const std::string& path, absl::Duration duration);
+
+ private:
+  GraphProfiling() = default;
+
+  std::atomic<bool> enabled_ = false;
+  absl::Mutex mutex_;
+  absl::flat_hash_set<const mediapipe::CalculatorGraph*> profiling_graphs_ ABSL_GUARDED_BY(mutex_);
+};
+
+}  // namespace mp_api
+
+extern "C" {
+
+MP_CAPI(bool) mp_GraphProfiling__enabled();
+MP_CAPI(void) mp_GraphProfiling__set_enabled__b(bool enabled);
+
+MP_CAPI(void) mp_api_CalculatorProfileStatsArray__delete(mp_api::StructArray<mp_api::CalculatorProfileStats> array);
+
+}  // extern "C"
+
+#endif  // MEDIAPIPE_API_FRAMEWORK_GRAPH_PROFILING_H_
@@ -0,0 +1,468 @@
+// Copyright (c) 2026 homuler
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+#include "mediapipe_api/framework/live_graph.h"
+
+#include <algorithm>
+
+#include "absl/memory/memory.h"
+#include "absl/strings/str_cat.h"
+#include "google/protobuf/any.pb.h"
+#include "google/protobuf/descriptor.h"
+#include "google/protobuf/message.h"
+#include "mediapipe/framework/port/logging.h"
+#include "mediapipe/framework/port/status_macros.h"
+#include "mediapipe_api/external/protobuf.h"
+#include "mediapipe_api/framework/expanded_config_cache.h"
+
+namespace mp_api {
+
+namespace {
+
+void CancelGraph(mediapipe::CalculatorGraph* graph) {
+  graph->Cancel();
+  graph->WaitUntilDone().IgnoreError();
+}
+
+// Merges `update` into `any` if they have the same type.
+absl::Status MergeAny(const google::protobuf::Any& update, google::protobuf::Any* any) {
+  const auto& type_url = any->type_url();
+  const auto* type = google::protobuf::DescriptorPool::generated_pool()->FindMessageTypeByName(type_url.substr(type_url.rfind('/') + 1));
+  if (type == nullptr) {
+    return absl::InvalidArgumentError(absl::StrCat("Unknown type: ", type_url));
+  }
+  const auto* prototype = google::protobuf::MessageFactory::generated_factory()->GetPrototype(type);
+  std::unique_ptr<google::protobuf::Message> value(prototype->New());
+  std::unique_ptr<google::protobuf::Message> value_update(prototype->New());
+  if (!any->UnpackTo(value.get()) || !update.UnpackTo(value_update.get())) {
+    return absl::InvalidArgumentError(absl::StrCat("Failed to unpack ", type_url));
+  }
+  value->MergeFrom(*value_update);
+  any->PackFrom(*value);
+  return absl::OkStatus();
+}
+
+absl::Status MergeNodeOptions(const mediapipe::CalculatorGraphConfig::Node& patch, mediapipe::CalculatorGraphConfig::Node* node) {
+  if (patch.has_options()) {
+    node->mutable_options()->MergeFrom(patch.options());
+  }
+  for (const auto& update : patch.node_options()) {
+    auto* node_options = node->mutable_node_options();
+    auto it = std::find_if(node_options->begin(), node_options->end(), [&update](const auto& any) { return any.type_url() == update.type_url(); });
+    if (it == node_options->end()) {
+      *node->add_node_options() = update;
+    } else {
+      MP_RETURN_IF_ERROR(MergeAny(update, &*it));
+    }
+  }
+  return absl::OkStatus();
+}
+
+}  // namespace
+
+absl::StatusOr<std::unique_ptr<LiveGraph>> LiveGraph::Create(mediapipe::CalculatorGraphConfig config) {
+  // NOTE: the nodes in the subgraphs can be updated only if the subgraphs are expanded.
+  if (auto expanded_config = ExpandedConfigCache::Expand(config); expanded_config != nullptr) {
+    config = *expanded_config;
+  }
+  auto live_graph = absl::WrapUnique(new LiveGraph(std::move(config)));
+  live_graph->thread_ = std::thread([ptr = live_graph.get()] { ptr->RunLoop(); });
+  live_graph->drain_thread_ = std::thread([ptr = live_graph.get()] { ptr->DrainLoop(); });
+  return live_graph;
+}
+
+LiveGraph::LiveGraph(mediapipe::CalculatorGraphConfig config) : config_(std::move(config)) {}
+
+LiveGraph::~LiveGraph() {
+  {
+    absl::MutexLock lock(&mutex_);
+    stopped_ = true;
+  }
+  thread_.join();
+  // NOTE: the retired graphs are cancelled since stopped_ is set.
+  drain_thread_.join();
+
+  // NOTE: the graphs are cancelled without the lock, since their callbacks may call the methods that take it.
+  std::unique_ptr<mediapipe::CalculatorGraph> pending_graph;
+  std::unique_ptr<mediapipe::CalculatorGraph> graph;
+  bool done;
+  {
+    absl::MutexLock lock(&mutex_);
+    pending_graph = std::move(pending_graph_);
+    graph = std::move(graph_);
+    done = done_;
+  }
+  if (pending_graph != nullptr) {
+    CancelGraph(pending_graph.get());
+  }
+  if (graph != nullptr && !done) {
+    CancelGraph(graph.get());
+  }
+}
+
+mediapipe::CalculatorGraphConfig LiveGraph::Config() const {
+  absl::MutexLock lock(&mutex_);
+  return config_;
+}
+
+absl::Status LiveGraph::ObserveOutputStream(const std::string& stream_name, PacketCallback callback) {
+  absl::MutexLock lock(&mutex_);
+  if (graph_ != nullptr) {
+    return absl::FailedPreconditionError("ObserveOutputStream must be called before StartRun");
+  }
+  callbacks_.emplace_back(stream_name, std::move(callback));
+  return absl::OkStatus();
+}
+
+absl::Status LiveGraph::StartRun(std::map<std::string, mediapipe::Packet> side_packets) {
+  absl::MutexLock input_lock(&input_mutex_);
+  mediapipe::CalculatorGraphConfig config;
+  {
+    absl::MutexLock lock(&mutex_);
+    if (graph_ != nullptr) {
+      return absl::FailedPreconditionError("The graph has already started");
+    }
+    config = config_;
+  }
+  // NOTE: the graph is started without the lock, since its callbacks take it.
+  auto model_assets = SharedModelCache::GetInstance().ShareModelAssets(config);
+  MP_ASSIGN_OR_RETURN(auto graph, StartGraph(config, side_packets));
+
+  absl::MutexLock lock(&mutex_);
+  graph_ = std::move(graph);
+  model_assets_ = std::move(model_assets);
+  side_packets_ = std::move(side_packets);
+  return absl::OkStatus();
+}
+
+absl::Status LiveGraph::UpdateNodeOptions(const std::string& node_name, const mediapipe::CalculatorGraphConfig::Node& patch) {
+  absl::MutexLock lock(&mutex_);
+  auto* nodes = config_.mutable_node();
+  auto it = std::find_if(nodes->begin(), nodes->end(), [&node_name](const auto& node) { return node.name() == node_name; });
+  if (it == nodes->end()) {
+    return absl::NotFoundError(absl::StrCat("Node not found: ", node_name));
+  }
+  // NOTE: merge into a copy so that the config is not changed if it fails.
+  auto node = *it;
+  MP_RETURN_IF_ERROR(MergeNodeOptions(patch, &node));
+  *it = std::move(node);
+  return absl::OkStatus();
+}
+
+void LiveGraph::UpdateSidePacket(const std::string& name, mediapipe::Packet packet) {
+  absl::MutexLock lock(&mutex_);
+  side_packets_[name] = std::move(packet);
+}
+
+absl::Status LiveGraph::ApplyUpdates() {
+  absl::MutexLock lock(&mutex_);
+  if (graph_ == nullptr) {
+    return absl::FailedPreconditionError("The graph has not started yet");
+  }
+  ++requested_version_;
+  return absl::OkStatus();
+}
+
+absl::Status LiveGraph::WaitForUpdate() {
+  absl::MutexLock lock(&mutex_);
+  auto is_done = [this]() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mutex_) { return stopped_ || started_version_ >= requested_version_; };
+  mutex_.Await(absl::Condition(&is_done));
+  return update_status_;
+}
+
+absl::Status LiveGraph::AddPacketToInputStream(const std::string& stream_name, mediapipe::Packet packet) {
+  absl::MutexLock input_lock(&input_mutex_);
+  mediapipe::CalculatorGraph* graph;
+  {
+    absl::MutexLock lock(&mutex_);
+    if (graph_ == nullptr) {
+      return absl::FailedPreconditionError("The graph has not started yet");
+    }
+    // NOTE: switch only at a new timestamp, so that the packets of the same timestamp are sent to the same graph.
+    if (pending_graph_ != nullptr && packet.Timestamp() > last_timestamp_) {
+      Switch();
+    }
+    last_timestamp_ = packet.Timestamp();
+    graph = graph_.get();
+  }
+  // NOTE: the packet is added without the lock, since it can block until the graph consumes the queued packets,
+  // whose callbacks take the lock.
+  return graph->AddPacketToInputStream(stream_name, std::move(packet));
+}
+
+absl::Status LiveGraph::CloseAllPacketSources() {
+  absl::MutexLock input_lock(&input_mutex_);
+  RetiredGraph pending_graph;
+  mediapipe::CalculatorGraph* graph;
+  {
+    absl::MutexLock lock(&mutex_);
+    if (graph_ == nullptr) {
+      return absl::FailedPreconditionError("The graph has not started yet");
+    }
+    pending_graph = RetiredGraph{std::move(pending_model_assets_), std::move(pending_graph_)};
+    pending_model_assets_.clear();
+    graph = graph_.get();
+  }
+  if (pending_graph.graph != nullptr) {
+    CancelGraph(pending_graph.graph.get());
+  }
+  return graph->CloseAllPacketSources();
+}
+
+absl::Status LiveGraph::WaitUntilDone() {
+  mediapipe::CalculatorGraph* graph;
+  {
+    absl::MutexLock lock(&mutex_);
+    if (graph_ == nullptr) {
+      return absl::FailedPreconditionError("The graph has not started yet");
+    }
+    // NOTE: the graph is no longer switched, since the packet sources must have been closed.
+    graph = graph_.get();
+  }
+  // NOTE: wait without the lock, since the callbacks may call the methods that take it.
+  auto status = graph->WaitUntilDone();
+
+  absl::MutexLock lock(&mutex_);
+  done_ = true;
+  // NOTE: the outputs of the retired graphs are delivered before the current graph finishes, but they may still be being destroyed.
+  auto is_drained = [this]() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mutex_) { return retired_graphs_.empty(); };
+  mutex_.Await(absl::Condition(&is_drained));
+  return status;
+}
+
+int64_t LiveGraph::generation() const {
+  absl::MutexLock lock(&mutex_);
+  return generation_;
+}
+
+absl::StatusOr<std::unique_ptr<mediapipe::CalculatorGraph>> LiveGraph::StartGraph(const mediapipe::CalculatorGraphConfig& config,
+                                                                                  const std::map<std::string, mediapipe::Packet>& side_packets) {
+  auto graph = std::make_unique<mediapipe::CalculatorGraph>();
+  MP_RETURN_IF_ERROR(graph->Initialize(config));
+  for (const auto& [stream_name, callback] : callbacks_) {
+    MP_RETURN_IF_ERROR(graph->ObserveOutputStream(stream_name, [this, graph = graph.get(), &callback = callback](const mediapipe::Packet& packet) {
+      AwaitOutputTurn(graph);
+      return callback(graph, packet);
+    }));
+  }
+  MP_RETURN_IF_ERROR(graph->StartRun(side_packets));
+
+  // NOTE: wait until the calculators are opened, i.e. the models are loaded.
+  if (auto status = graph->WaitUntilIdle(); !status.ok()) {
+    CancelGraph(graph.get());
+    return status;
+  }
+  return graph;
+}
+
+void LiveGraph::RunLoop() {
+  while (true) {
+    mediapipe::CalculatorGraphConfig config;
+    std::map<std::string, mediapipe::Packet> side_packets;
+    int64_t version;
+    {
+      absl::MutexLock lock(&mutex_);
+      auto is_requested = [this]() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mutex_) { return stopped_ || requested_version_ > started_version_; };
+      mutex_.Await(absl::Condition(&is_requested));
+      if (stopped_) {
+        return;
+      }
+      config = config_;
+      side_packets = side_packets_;
+      version = requested_version_;
+    }
+
+    auto model_assets = SharedModelCache::GetInstance().ShareModelAssets(config);
+    auto graph = StartGraph(config, side_packets);
+
+    // The graph that is not used, which is cancelled without the lock.
+    RetiredGraph discarded;
+    {
+      absl::MutexLock lock(&mutex_);
+      started_version_ = version;
+      if (!graph.ok()) {
+        update_status_ = graph.status();
+        continue;
+      }
+      if (version < requested_version_ || stopped_ || done_) {
+        // NOTE: a newer update has been requested, or the graph is no longer used.
+        discarded = RetiredGraph{std::move(model_assets), std::move(graph).value()};
+      } else {
+        update_status_ = absl::OkStatus();
+        discarded = RetiredGraph{std::move(pending_model_assets_), std::move(pending_graph_)};
+        pending_graph_ = std::move(graph).value();
+        pending_model_assets_ = std::move(model_assets);
+      }
+    }
+    if (discarded.graph != nullptr) {
+      CancelGraph(discarded.graph.get());
+    }
+  }
+}
+
+void LiveGraph::DrainLoop() {
+  while (true) {
+    mediapipe::CalculatorGraph* graph;
+    bool stopped;
+    {
+      absl::MutexLock lock(&mutex_);
+      auto has_retired_graph = [this]() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mutex_) { return stopped_ || !retired_graphs_.empty(); };
+      mutex_.Await(absl::Condition(&has_retired_graph));
+      if (retired_graphs_.empty()) {
+        return;
+      }
+      // NOTE: the graph stays at the front while it's drained, so that its outputs are delivered first.
+      graph = retired_graphs_.front().graph.get();
+      stopped = stopped_;
+    }
+
+    if (stopped) {
+      CancelGraph(graph);
+    } else {
+      // NOTE: wait until the graph has processed the packets it has received, which the current graph's outputs are waiting for.
+      auto status = graph->CloseAllPacketSources();
+      if (status.ok()) {
+        status = graph->WaitUntilDone();
+      }
+      if (!status.ok()) {
+        LOG(WARNING) << "The previous graph has failed: " << status;
+      }
+    }
+
+    RetiredGraph retired_graph;
+    {
+      absl::MutexLock lock(&mutex_);
+      retired_graph = std::move(retired_graphs_.front());
+      retired_graphs_.pop_front();
+    }
+    // NOTE: the graph is destroyed here, i.e. without the lock.
+  }
+}
+
+void LiveGraph::Switch() {
+  retired_graphs_.push_back(RetiredGraph{std::move(model_assets_), std::move(graph_)});
+  graph_ = std::move(pending_graph_);
+  model_assets_ = std::move(pending_model_assets_);
+  pending_model_assets_.clear();
+  ++generation_;
+}
+
+void LiveGraph::AwaitOutputTurn(const mediapipe::CalculatorGraph* graph) {
+  absl::MutexLock lock(&mutex_);
+  // NOTE: the current graph waits for all the retired graphs, and a retired graph waits for the older ones.
+  // The pending graphs have received no packet, so they don't wait.
+  auto is_turn = [this, graph]() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mutex_) {
+    if (graph == graph_.get()) {
+      return retired_graphs_.empty();
+    }
+    auto it = std::find_if(retired_graphs_.begin(), retired_graphs_.end(), [graph](const auto& retired) { return retired.graph.get() == graph; });
+    return it == retired_graphs_.end() || it == retired_graphs_.begin();
+  };
+  mutex_.Await(absl::Condition(&is_turn));
+}
+
+}  // namespace mp_api
+
+MpReturnCode mp_LiveGraph_Create__PKc_i(const char* serialized_config, int size, absl::Status** status_out, mp_api::LiveGraph** live_graph_out) {
+  TRY_ALL
+    auto config = ParseFromStringAsProto<mediapipe::CalculatorGraphConfig>(serialized_config, size);
+    auto status_or_live_graph = mp_api::LiveGraph::Create(std::move(config));
+    *status_out = new absl::Status{status_or_live_graph.status()};
+    if (status_or_live_graph.ok()) {
+      *live_graph_out = std::move(status_or_live_graph).value().release();
+    } else {
+      *live_graph_out = nullptr;
+    }
+    RETURN_CODE(MpReturnCode::Success);
+  CATCH_ALL
+}
+
+void mp_LiveGraph__delete(mp_api::LiveGraph* live_graph) { delete live_graph; }
+
+MpReturnCode mp_LiveGraph__Config(mp_api::LiveGraph* live_graph, mp_api::SerializedProto* config_out) {
+  TRY_ALL
+    SerializeProto(live_graph->Config(), config_out);
+    RETURN_CODE(MpReturnCode::Success);
+  CATCH_ALL
+}
+
+MpReturnCode mp_LiveGraph__ObserveOutputStream__PKc_i_PF(mp_api::LiveGraph* live_graph, const char* stream_name, int stream_id,
+                                                         NativePacketCallback* packet_callback, absl::Status** status_out) {
+  TRY_ALL
+    auto status = live_graph->ObserveOutputStream(
+        stream_name, [stream_id, packet_callback](mediapipe::CalculatorGraph* graph, const mediapipe::Packet& packet) -> absl::Status {
+          auto status_args = packet_callback(graph, stream_id, packet);
+          auto callback_status = absl::Status{status_args.code, absl::NullSafeStringView((const char*)status_args.message)};
+          if (status_args.message != nullptr) {
+            mp_api::freeHGlobal(status_args.message);
+          }
+          return callback_status;
+        });
+    *status_out = new absl::Status{std::move(status)};
+    RETURN_CODE(MpReturnCode::Success);
+  CATCH_ALL
+}
+
+MpReturnCode mp_LiveGraph__StartRun__Rsp(mp_api::LiveGraph* live_graph, SidePackets* side_packets, absl::Status** status_out) {
+  TRY_ALL
+    *status_out = new absl::Status{live_graph->StartRun(*side_packets)};
+    RETURN_CODE(MpReturnCode::Success);
+  CATCH_ALL
+}
+
+MpReturnCode mp_LiveGraph__UpdateNodeOptions__PKc_PKc_i(mp_api::LiveGraph* live_graph, const char* node_name, const char* serialized_node, int size,
+                                                        absl::Status** status_out) {
+  TRY_ALL
+    auto patch = ParseFromStringAsProto<mediapipe::CalculatorGraphConfig::Node>(serialized_node, size);
+    *status_out = new absl::Status{live_graph->UpdateNodeOptions(node_name, patch)};
+    RETURN_CODE(MpReturnCode::Success);
+  CATCH_ALL
+}
+
+MpReturnCode mp_LiveGraph__UpdateSidePacket__PKc_Ppacket(mp_api::LiveGraph* live_graph, const char* name, mediapipe::Packet* packet) {
+  TRY
+    live_graph->UpdateSidePacket(name, std::move(*packet));
+    RETURN_CODE(MpReturnCode::Success);
+  CATCH_EXCEPTION
+}
+
+MpReturnCode mp_LiveGraph__ApplyUpdates(mp_api::LiveGraph* live_graph, absl::Status** status_out) {
+  TRY
+    *status_out = new absl::Status{live_graph->ApplyUpdates()};
+    RETURN_CODE(MpReturnCode::Success);
+  CATCH_EXCEPTION
+}
+
+MpReturnCode mp_LiveGraph__WaitForUpdate(mp_api::LiveGraph* live_graph, absl::Status** status_out) {
+  TRY
+    *status_out = new absl::Status{live_graph->WaitForUpdate()};
+    RETURN_CODE(MpReturnCode::Success);
+  CATCH_EXCEPTION
+}
+
+MpReturnCode mp_LiveGraph__AddPacketToInputStream__PKc_Ppacket(mp_api::LiveGraph* live_graph, const char* stream_name, mediapipe::Packet* packet,
+                                                               absl::Status** status_out) {
+  TRY
+    *status_out = new absl::Status{live_graph->AddPacketToInputStream(stream_name, std::move(*packet))};
+    RETURN_CODE(MpReturnCode::Success);
+  CATCH_EXCEPTION
+}
+
+MpReturnCode mp_LiveGraph__CloseAllPacketSources(mp_api::LiveGraph* live_graph, absl::Status** status_out) {
+  TRY
+    *status_out = new absl::Status{live_graph->CloseAllPacketSources()};
+    RETURN_CODE(MpReturnCode::Success);
+  CATCH_EXCEPTION
+}
+
+MpReturnCode mp_LiveGraph__WaitUntilDone(mp_api::LiveGraph* live_graph, absl::Status** status_out) {
+  TRY
+    *status_out = new absl::Status{live_graph->WaitUntilDone()};
+    RETURN_CODE(MpReturnCode::Success);
+  CATCH_EXCEPTION
+}
+
+int64_t mp_LiveGraph__generation(mp_api::LiveGraph* live_graph) { return live_graph->generation(); }
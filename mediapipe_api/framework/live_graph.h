@@ -0,0 +1,148 @@
+// Copyright (c) 2026 homuler
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+#ifndef MEDIAPIPE_API_FRAMEWORK_LIVE_GRAPH_H_
+#define MEDIAPIPE_API_FRAMEWORK_LIVE_GRAPH_H_
+
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/status/statusor.h"
+#include "absl/synchronization/mutex.h"
+#include "mediapipe/framework/calculator_graph.h"
+#include "mediapipe_api/common.h"
+#include "mediapipe_api/external/absl/status.h"
+#include "mediapipe_api/framework/calculator_graph.h"
+#include "mediapipe_api/tasks/cc/core/shared_model_cache.h"
+
+namespace mp_api {
+
+// Runs a graph whose node options and side packets can be updated while it's running.
+//
+// Since the calculators read their options only when they are opened, an update is applied by starting another graph
+// with the updated config in the background. When it's ready, the input packets are switched to it at the next timestamp.
+// The previous graph is closed and destroyed in the background, and the outputs of the new graph are held back
+// until it has processed the packets it has received, so the outputs are never reordered.
+//
+// The subgraphs in the config are expanded (unless it's a MediaPipe Tasks graph), so the nodes in the subgraphs can be updated
+// by their expanded names (e.g. "facedetectionshortrangecpu__TensorsToDetectionsCalculator"). See Config().
+class LiveGraph {
+ public:
+  using PacketCallback = std::function<absl::Status(mediapipe::CalculatorGraph* graph, const mediapipe::Packet&)>;
+
+  static absl::StatusOr<std::unique_ptr<LiveGraph>> Create(mediapipe::CalculatorGraphConfig config);
+
+  ~LiveGraph();
+
+  // Returns the config with the updates applied so far.
+  mediapipe::CalculatorGraphConfig Config() const;
+
+  // Must be called before StartRun.
+  absl::Status ObserveOutputStream(const std::string& stream_name, PacketCallback callback);
+  absl::Status StartRun(std::map<std::string, mediapipe::Packet> side_packets);
+
+  // Merges `options` and `node_options` of `patch` into the node named `node_name`.
+  // The update is not applied until ApplyUpdates is called.
+  absl::Status UpdateNodeOptions(const std::string& node_name, const mediapipe::CalculatorGraphConfig::Node& patch);
+  // The update is not applied until ApplyUpdates is called.
+  void UpdateSidePacket(const std::string& name, mediapipe::Packet packet);
+
+  // Starts a graph with the updates in the background. If another one is being started, it's discarded after it has started.
+  absl::Status ApplyUpdates();
+  // Waits until the graph started by the last ApplyUpdates is ready, and returns the status of starting it.
+  absl::Status WaitForUpdate();
+
+  absl::Status AddPacketToInputStream(const std::string& stream_name, mediapipe::Packet packet);
+  absl::Status CloseAllPacketSources();
+  absl::Status WaitUntilDone();
+
+  // The number of times the graph has been switched.
+  int64_t generation() const;
+
+ private:
+  explicit LiveGraph(mediapipe::CalculatorGraphConfig config);
+
+  absl::StatusOr<std::unique_ptr<mediapipe::CalculatorGraph>> StartGraph(const mediapipe::CalculatorGraphConfig& config,
+                                                                         const std::map<std::string, mediapipe::Packet>& side_packets);
+  void RunLoop();
+  // Closes and destroys the retired graphs in order.
+  void DrainLoop();
+  // Replaces the current graph with the pending one, and retires the current one.
+  void Switch() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mutex_);
+  // Waits until the graphs that received the earlier packets than `graph` are drained.
+  void AwaitOutputTurn(const mediapipe::CalculatorGraph* graph) ABSL_LOCKS_EXCLUDED(mutex_);
+
+  struct RetiredGraph {
+    // NOTE: the model assets must outlive the graph, so declare them first.
+    std::vector<SharedModelCache::Handle> model_assets;
+    std::unique_ptr<mediapipe::CalculatorGraph> graph;
+  };
+
+  // Fixed after StartRun.
+  std::vector<std::pair<std::string, PacketCallback>> callbacks_;
+
+  // Serializes AddPacketToInputStream and CloseAllPacketSources, so that the current graph is not switched while a packet is added to it.
+  // It's acquired before mutex_, and held while a packet is added, which can block.
+  absl::Mutex input_mutex_ ABSL_ACQUIRED_BEFORE(mutex_);
+  // NOTE: it's never held while waiting for a graph, since the callbacks of the graphs take it.
+  mutable absl::Mutex mutex_;
+  mediapipe::CalculatorGraphConfig config_ ABSL_GUARDED_BY(mutex_);
+  std::map<std::string, mediapipe::Packet> side_packets_ ABSL_GUARDED_BY(mutex_);
+  // NOTE: the model assets must outlive the graphs, so declare them first.
+  std::vector<SharedModelCache::Handle> model_assets_ ABSL_GUARDED_BY(mutex_);
+  std::vector<SharedModelCache::Handle> pending_model_assets_ ABSL_GUARDED_BY(mutex_);
+  std::unique_ptr<mediapipe::CalculatorGraph> graph_ ABSL_GUARDED_BY(mutex_);
+  std::unique_ptr<mediapipe::CalculatorGraph> pending_graph_ ABSL_GUARDED_BY(mutex_);
+  // The graphs that have been switched from, in the order they were used. The front one is being drained.
+  std::deque<RetiredGraph> retired_graphs_ ABSL_GUARDED_BY(mutex_);
+  mediapipe::Timestamp last_timestamp_ ABSL_GUARDED_BY(mutex_) = mediapipe::Timestamp::Unset();
+  int64_t generation_ ABSL_GUARDED_BY(mutex_) = 0;
+  // Incremented by ApplyUpdates. The graph being started is discarded if it's older than this.
+  int64_t requested_version_ ABSL_GUARDED_BY(mutex_) = 0;
+  int64_t started_version_ ABSL_GUARDED_BY(mutex_) = 0;
+  absl::Status update_status_ ABSL_GUARDED_BY(mutex_);
+  // true after WaitUntilDone is called.
+  bool done_ ABSL_GUARDED_BY(mutex_) = false;
+  bool stopped_ ABSL_GUARDED_BY(mutex_) = false;
+  std::thread thread_;
+  std::thread drain_thread_;
+};
+
+}  // namespace mp_api
+
+extern "C" {
+
+MP_CAPI(MpReturnCode) mp_LiveGraph_Create__PKc_i(const char* serialized_config, int size, absl::Status** status_out, mp_api::LiveGraph** live_graph_out);
+MP_CAPI(void) mp_LiveGraph__delete(mp_api::LiveGraph* live_graph);
+
+MP_CAPI(MpReturnCode) mp_LiveGraph__Config(mp_api::LiveGraph* live_graph, mp_api::SerializedProto* config_out);
+MP_CAPI(MpReturnCode) mp_LiveGraph__ObserveOutputStream__PKc_i_PF(mp_api::LiveGraph* live_graph, const char* stream_name, int stream_id,
+                                                                  NativePacketCallback* packet_callback, absl::Status** status_out);
+MP_CAPI(MpReturnCode) mp_LiveGraph__StartRun__Rsp(mp_api::LiveGraph* live_graph, SidePackets* side_packets, absl::Status** status_out);
+
+MP_CAPI(MpReturnCode) mp_LiveGraph__UpdateNodeOptions__PKc_PKc_i(mp_api::LiveGraph* live_graph, const char* node_name, const char* serialized_node, int size,
+                                                                 absl::Status** status_out);
+MP_CAPI(MpReturnCode) mp_LiveGraph__UpdateSidePacket__PKc_Ppacket(mp_api::LiveGraph* live_graph, const char* name, mediapipe::Packet* packet);
+MP_CAPI(MpReturnCode) mp_LiveGraph__ApplyUpdates(mp_api::LiveGraph* live_graph, absl::Status** status_out);
+MP_CAPI(MpReturnCode) mp_LiveGraph__WaitForUpdate(mp_api::LiveGraph* live_graph, absl::Status** status_out);
+
+MP_CAPI(MpReturnCode) mp_LiveGraph__AddPacketToInputStream__PKc_Ppacket(mp_api::LiveGraph* live_graph, const char* stream_name, mediapipe::Packet* packet,
+                                                                        absl::Status** status_out);
+MP_CAPI(MpReturnCode) mp_LiveGraph__CloseAllPacketSources(mp_api::LiveGraph* live_graph, absl::Status** status_out);
+MP_CAPI(MpReturnCode) mp_LiveGraph__WaitUntilDone(mp_api::LiveGraph* live_graph, absl::Status** status_out);
+MP_CAPI(int64_t) mp_LiveGraph__generation(mp_api::LiveGraph* live_graph);
+
+}  // extern "C"
+
+#endif  // MEDIAPIPE_API_FRAMEWORK_LIVE_GRAPH_H_
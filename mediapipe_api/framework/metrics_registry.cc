@@ -0,0 +1,294 @@
+// Copyright (c) 2026 homuler
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+#include "mediapipe_api/framework/metrics_registry.h"
+
+#include <algorithm>
+#include <iterator>
+#include <limits>
+
+#include "absl/time/clock.h"
+
+namespace mp_api {
+
+namespace {
+
+constexpr int64_t kUnsetTimestamp = std::numeric_limits<int64_t>::min();
+
+int GetLatencyBucket(int64_t latency_us) {
+  return static_cast<int>(std::distance(std::begin(kStreamLatencyHistogramBoundsUs),
+                                        std::upper_bound(std::begin(kStreamLatencyHistogramBoundsUs), std::end(kStreamLatencyHistogramBoundsUs), latency_us)));
+}
+
+}  // namespace
+
+void StreamMetrics::Record(int64_t latency_us) {
+  packets_.fetch_add(1, std::memory_order_relaxed);
+  latency_total_us_.fetch_add(latency_us, std::memory_order_relaxed);
+  latency_counts_[GetLatencyBucket(latency_us)].fetch_add(1, std::memory_order_relaxed);
+}
+
+void StreamMetrics::Snapshot(int64_t graph_id, StreamMetricsSnapshot* snapshot) const {
+  snapshot->graph_id = graph_id;
+  snapshot->name = name_.load(std::memory_order_acquire);
+  snapshot->packets = packets_.load(std::memory_order_relaxed);
+  snapshot->latency_total_us = latency_total_us_.load(std::memory_order_relaxed);
+  for (int i = 0; i < kStreamLatencyHistogramSize; ++i) {
+    snapshot->latency_counts[i] = latency_counts_[i].load(std::memory_order_relaxed);
+  }
+}
+
+void StreamMetrics::Reset(const char* name, bool observes_timestamp_bounds) {
+  packets_.store(0, std::memory_order_relaxed);
+  latency_total_us_.store(0, std::memory_order_relaxed);
+  for (auto& count : latency_counts_) {
+    count.store(0, std::memory_order_relaxed);
+  }
+  last_timestamp_.store(kUnsetTimestamp, std::memory_order_relaxed);
+  observes_timestamp_bounds_.store(observes_timestamp_bounds, std::memory_order_relaxed);
+  name_.store(name, std::memory_order_release);
+}
+
+uint64_t GraphMetrics::RecordInput(int64_t timestamp) {
+  input_packets_.fetch_add(1, std::memory_order_relaxed);
+  const auto index = next_input_.fetch_add(1, std::memory_order_relaxed);
+  if (num_streams_.load(std::memory_order_relaxed) == 0) {
+    // NOTE: no output stream is observed, so the packet could never be completed.
+    return index;
+  }
+  auto& record = inputs_[index % kNumInputRecords];
+  if (record.pending.exchange(false, std::memory_order_acq_rel)) {
+    // NOTE: the timestamp of the evicted packet has not reached any output stream for a while, e.g. because the observed streams
+    // are sparse, but it's not known whether it's dropped.
+    DecrementQueueDepth();
+  }
+  record.timestamp.store(timestamp, std::memory_order_relaxed);
+  record.time_us.store(absl::GetCurrentTimeNanos() / 1000, std::memory_order_relaxed);
+  record.pending.store(true, std::memory_order_release);
+
+  const auto depth = queue_depth_.fetch_add(1, std::memory_order_relaxed);
+  queue_depth_counts_[std::min<int64_t>(std::max<int64_t>(depth, 0), kQueueDepthHistogramSize - 1)].fetch_add(1, std::memory_order_relaxed);
+  return index;
+}
+
+void GraphMetrics::CancelInput(uint64_t index, bool throttled) {
+  if (inputs_[index % kNumInputRecords].pending.exchange(false, std::memory_order_acq_rel)) {
+    DecrementQueueDepth();
+  }
+  dropped_frames_.fetch_add(1, std::memory_order_relaxed);
+  if (throttled) {
+    RecordThrottled();
+  }
+}
+
+void GraphMetrics::RecordThrottled() { throttle_events_.fetch_add(1, std::memory_order_relaxed); }
+
+void GraphMetrics::RecordNodeThrottled(int node_id, bool throttled) {
+  if (node_id < 0) {
+    return;
+  }
+  auto& nodes = throttled_nodes_[(node_id / 64) % std::size(throttled_nodes_)];
+  const auto bit = uint64_t{1} << (node_id % 64);
+  if (throttled) {
+    if ((nodes.fetch_or(bit, std::memory_order_relaxed) & bit) == 0) {
+      RecordThrottled();
+    }
+  } else if ((nodes.load(std::memory_order_relaxed) & bit) != 0) {
+    nodes.fetch_and(~bit, std::memory_order_relaxed);
+  }
+}
+
+void GraphMetrics::RecordOutput(StreamMetrics* stream, int64_t timestamp, bool empty) {
+  const auto now_us = absl::GetCurrentTimeNanos() / 1000;
+  stream->last_timestamp_.store(timestamp, std::memory_order_relaxed);
+  // NOTE: a timestamp is known to be skipped only by the streams observed with the timestamp bounds, which report every timestamp they process.
+  // The streams are added before the graph starts, so the ones being added can be ignored.
+  auto low_watermark = kUnsetTimestamp;
+  bool observes_timestamp_bounds = false;
+  const auto num_streams = std::min(num_streams_.load(std::memory_order_relaxed), kMaxStreamMetrics);
+  for (int i = 0; i < num_streams; ++i) {
+    if (!streams_[i].observes_timestamp_bounds_.load(std::memory_order_relaxed)) {
+      continue;
+    }
+    const auto last_timestamp = streams_[i].last_timestamp_.load(std::memory_order_relaxed);
+    low_watermark = observes_timestamp_bounds ? std::min(low_watermark, last_timestamp) : last_timestamp;
+    observes_timestamp_bounds = true;
+  }
+
+  int64_t input_time_us = 0;
+  for (auto& record : inputs_) {
+    const auto record_timestamp = record.timestamp.load(std::memory_order_relaxed);
+    if (record_timestamp == timestamp) {
+      // NOTE: the packets of the same timestamp can be added to multiple input streams, so the latest one is taken.
+      input_time_us = std::max(input_time_us, record.time_us.load(std::memory_order_relaxed));
+      if (record.pending.exchange(false, std::memory_order_acq_rel)) {
+        DecrementQueueDepth();
+      }
+    } else if (record_timestamp < low_watermark && record.pending.load(std::memory_order_relaxed) &&
+               record.pending.exchange(false, std::memory_order_acq_rel)) {
+      dropped_frames_.fetch_add(1, std::memory_order_relaxed);
+      DecrementQueueDepth();
+    }
+  }
+  if (input_time_us > 0 && !empty) {
+    stream->Record(std::max<int64_t>(now_us - input_time_us, 0));
+  }
+}
+
+void GraphMetrics::RecordStartRun() {
+  for (auto& record : inputs_) {
+    if (record.pending.exchange(false, std::memory_order_acq_rel)) {
+      DecrementQueueDepth();
+    }
+    record.time_us.store(0, std::memory_order_relaxed);
+  }
+  for (auto& nodes : throttled_nodes_) {
+    nodes.store(0, std::memory_order_relaxed);
+  }
+  const auto num_streams = std::min(num_streams_.load(std::memory_order_relaxed), kMaxStreamMetrics);
+  for (int i = 0; i < num_streams; ++i) {
+    streams_[i].last_timestamp_.store(kUnsetTimestamp, std::memory_order_relaxed);
+  }
+}
+
+StreamMetrics* GraphMetrics::AddStream(absl::string_view name, bool observes_timestamp_bounds) {
+  const auto index = num_streams_.fetch_add(1, std::memory_order_relaxed);
+  if (index >= kMaxStreamMetrics) {
+    return nullptr;
+  }
+  auto* stream = &streams_[index];
+  stream->Reset(MetricsRegistry::GetInstance().InternName(name), observes_timestamp_bounds);
+  return stream;
+}
+
+int GraphMetrics::Snapshot(GraphMetricsSnapshot* graph, StreamMetricsSnapshot* streams, int capacity) const {
+  const auto id = this->id();
+  graph->graph_id = id;
+  graph->input_packets = input_packets_.load(std::memory_order_relaxed);
+  graph->queue_depth = queue_depth_.load(std::memory_order_relaxed);
+  graph->throttle_events = throttle_events_.load(std::memory_order_relaxed);
+  graph->dropped_frames = dropped_frames_.load(std::memory_order_relaxed);
+  for (int i = 0; i < kQueueDepthHistogramSize; ++i) {
+    graph->queue_depth_counts[i] = queue_depth_counts_[i].load(std::memory_order_relaxed);
+  }
+
+  const auto num_streams = std::min(num_streams_.load(std::memory_order_relaxed), kMaxStreamMetrics);
+  int size = 0;
+  for (int i = 0; i < num_streams; ++i) {
+    if (streams_[i].name_.load(std::memory_order_acquire) == nullptr) {
+      // NOTE: the stream is being added.
+      continue;
+    }
+    if (size < capacity) {
+      streams_[i].Snapshot(id, &streams[size]);
+    }
+    ++size;
+  }
+  return size;
+}
+
+void GraphMetrics::Reset(int64_t id) {
+  num_streams_.store(0, std::memory_order_relaxed);
+  for (auto& stream : streams_) {
+    stream.name_.store(nullptr, std::memory_order_relaxed);
+  }
+  for (auto& record : inputs_) {
+    record.pending.store(false, std::memory_order_relaxed);
+    record.time_us.store(0, std::memory_order_relaxed);
+  }
+  next_input_.store(0, std::memory_order_relaxed);
+  input_packets_.store(0, std::memory_order_relaxed);
+  queue_depth_.store(0, std::memory_order_relaxed);
+  throttle_events_.store(0, std::memory_order_relaxed);
+  for (auto& nodes : throttled_nodes_) {
+    nodes.store(0, std::memory_order_relaxed);
+  }
+  dropped_frames_.store(0, std::memory_order_relaxed);
+  for (auto& count : queue_depth_counts_) {
+    count.store(0, std::memory_order_relaxed);
+  }
+  id_.store(id, std::memory_order_release);
+}
+
+void GraphMetrics::DecrementQueueDepth() { queue_depth_.fetch_sub(1, std::memory_order_relaxed); }
+
+MetricsRegistry& MetricsRegistry::GetInstance() {
+  static auto* registry = new MetricsRegistry();
+  return *registry;
+}
+
+GraphMetrics* MetricsRegistry::Get(const void* graph) {
+  if (auto* metrics = Find(graph); metrics != nullptr || !enabled()) {
+    return metrics;
+  }
+  absl::MutexLock lock(&registration_mutex_);
+  // NOTE: the graph may have been registered by another thread since the lookup above.
+  if (auto* metrics = Find(graph); metrics != nullptr) {
+    return metrics;
+  }
+  for (auto& metrics : graphs_) {
+    bool expected = false;
+    if (metrics.claimed_.compare_exchange_strong(expected, true, std::memory_order_acq_rel)) {
+      metrics.Reset(next_id_.fetch_add(1, std::memory_order_relaxed));
+      metrics.owner_.store(graph, std::memory_order_release);
+      return &metrics;
+    }
+  }
+  return nullptr;
+}
+
+GraphMetrics* MetricsRegistry::Find(const void* graph) {
+  for (auto& metrics : graphs_) {
+    if (metrics.owner_.load(std::memory_order_acquire) == graph) {
+      return &metrics;
+    }
+  }
+  return nullptr;
+}
+
+void MetricsRegistry::Unregister(const void* graph) {
+  if (auto* metrics = Find(graph); metrics != nullptr) {
+    metrics->id_.store(0, std::memory_order_release);
+    metrics->owner_.store(nullptr, std::memory_order_release);
+    metrics->claimed_.store(false, std::memory_order_release);
+  }
+}
+
+void MetricsRegistry::Snapshot(GraphMetricsSnapshot* graphs, int graphs_capacity, int* graphs_size_out, StreamMetricsSnapshot* streams, int streams_capacity,
+                               int* streams_size_out) const {
+  int graphs_size = 0;
+  int streams_size = 0;
+  for (const auto& metrics : graphs_) {
+    if (metrics.id() == 0) {
+      continue;
+    }
+    GraphMetricsSnapshot snapshot;
+    const auto num_streams = metrics.Snapshot(&snapshot, streams + std::min(streams_size, streams_capacity), std::max(streams_capacity - streams_size, 0));
+    if (graphs_size < graphs_capacity) {
+      graphs[graphs_size] = snapshot;
+    }
+    ++graphs_size;
+    streams_size += num_streams;
+  }
+  *graphs_size_out = graphs_size;
+  *streams_size_out = streams_size;
+}
+
+const char* MetricsRegistry::InternName(absl::string_view name) {
+  absl::MutexLock lock(&names_mutex_);
+  return names_.emplace(name).first->c_str();
+}
+
+}  // namespace mp_api
+
+bool mp_MetricsRegistry__enabled() { return mp_api::MetricsRegistry::GetInstance().enabled(); }
+
+void mp_MetricsRegistry__set_enabled__b(bool enabled) { mp_api::MetricsRegistry::GetInstance().set_enabled(enabled); }
+
+void mp_MetricsRegistry__Snapshot(mp_api::GraphMetricsSnapshot* graphs, int graphs_capacity, int* graphs_size_out, mp_api::StreamMetricsSnapshot* streams,
+                                  int streams_capacity, int* streams_size_out) {
+  mp_api::MetricsRegistry::GetInstance().Snapshot(graphs, graphs_capacity, graphs_size_out, streams, streams_capacity, streams_size_out);
+}
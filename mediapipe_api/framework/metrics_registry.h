@@ -0,0 +1,183 @@
+// Copyright (c) 2026 homuler
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+#ifndef MEDIAPIPE_API_FRAMEWORK_METRICS_REGISTRY_H_
+#define MEDIAPIPE_API_FRAMEWORK_METRICS_REGISTRY_H_
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/container/node_hash_set.h"
+#include "absl/strings/string_view.h"
+#include "absl/synchronization/mutex.h"
+#include "mediapipe_api/common.h"
+
+namespace mp_api {
+
+// The maximum number of the graphs and of the output streams per graph whose metrics are recorded.
+constexpr int kMaxGraphMetrics = 32;
+constexpr int kMaxStreamMetrics = 16;
+// The number of the nodes whose throttled states are tracked per graph. The larger node ids share the states with the smaller ones.
+constexpr int kMaxThrottledNodes = 256;
+
+// queue_depth_counts[i] is the number of the input packets that were added when i packets were in flight.
+// The last bucket also counts the deeper queues.
+constexpr int kQueueDepthHistogramSize = 16;
+constexpr int kStreamLatencyHistogramSize = 12;
+// The upper bounds (exclusive) of the latency buckets except the last one, in microseconds.
+constexpr int64_t kStreamLatencyHistogramBoundsUs[kStreamLatencyHistogramSize - 1] = {1000,  2000,   5000,   10000,  20000, 33000,
+                                                                                       50000, 100000, 200000, 500000, 1000000};
+
+struct GraphMetricsSnapshot {
+  // A unique id of the graph, which is not reused in the process.
+  int64_t graph_id;
+  int64_t input_packets;
+  // The number of the input packets whose timestamps have not reached any observed output stream yet.
+  int64_t queue_depth;
+  // The number of the times a node became throttled as found by IsNodeThrottled, or the graph rejected an input packet because it was throttled.
+  int64_t throttle_events;
+  // The number of the input packets rejected by the graph, and the ones whose timestamps were skipped by every output stream
+  // observed with the timestamp bounds, e.g. the frames dropped by FlowLimiterCalculator.
+  // NOTE: a stream observed without the timestamp bounds cannot tell a dropped frame from a sparse output, so it's not counted.
+  int64_t dropped_frames;
+  int64_t queue_depth_counts[kQueueDepthHistogramSize];
+};
+
+struct StreamMetricsSnapshot {
+  // The id of the graph to which the stream belongs.
+  int64_t graph_id;
+  // The name of the output stream. It's valid during the process.
+  const char* name;
+  int64_t packets;
+  // The time from when the input packet of the same timestamp was added until the packet was observed.
+  int64_t latency_total_us;
+  int64_t latency_counts[kStreamLatencyHistogramSize];
+};
+
+class StreamMetrics {
+ public:
+  void Record(int64_t latency_us);
+  void Snapshot(int64_t graph_id, StreamMetricsSnapshot* snapshot) const;
+
+ private:
+  friend class GraphMetrics;
+
+  void Reset(const char* name, bool observes_timestamp_bounds);
+
+  std::atomic<const char*> name_ = nullptr;
+  std::atomic<bool> observes_timestamp_bounds_ = false;
+  // The timestamp of the last packet observed in the current run.
+  std::atomic<int64_t> last_timestamp_ = 0;
+  std::atomic<int64_t> packets_ = 0;
+  std::atomic<int64_t> latency_total_us_ = 0;
+  std::atomic<int64_t> latency_counts_[kStreamLatencyHistogramSize] = {};
+};
+
+// The metrics of a CalculatorGraph. They are updated by atomic operations, so the graph threads are never blocked by them.
+class GraphMetrics {
+ public:
+  // Must be called before the packet is added to the graph. Returns the index to be passed to CancelInput.
+  uint64_t RecordInput(int64_t timestamp);
+  // Called when the graph rejects the packet recorded by RecordInput.
+  void CancelInput(uint64_t index, bool throttled);
+  void RecordThrottled();
+  // Records the throttled state of the node found by IsNodeThrottled. Only the transitions into the throttled state are counted.
+  void RecordNodeThrottled(int node_id, bool throttled);
+  // Records the latency of the packet observed in `stream`. `empty` is true if the packet only tells the timestamp bound.
+  // The pending input packets are regarded as dropped once every stream observed with the timestamp bounds has passed their timestamps.
+  void RecordOutput(StreamMetrics* stream, int64_t timestamp, bool empty);
+  // Called when the graph starts a new run, since the timestamps are reused.
+  void RecordStartRun();
+
+  // Returns nullptr if no more stream can be added.
+  StreamMetrics* AddStream(absl::string_view name, bool observes_timestamp_bounds);
+
+  int64_t id() const { return id_.load(std::memory_order_acquire); }
+  // Returns the number of the streams, which are copied to `streams` as long as the capacity allows.
+  int Snapshot(GraphMetricsSnapshot* graph, StreamMetricsSnapshot* streams, int capacity) const;
+
+ private:
+  friend class MetricsRegistry;
+
+  // The recent input packets, which are matched with the output packets by their timestamps.
+  static constexpr int kNumInputRecords = 64;
+  struct InputRecord {
+    std::atomic<int64_t> timestamp = 0;
+    std::atomic<int64_t> time_us = 0;
+    std::atomic<bool> pending = false;
+  };
+
+  void Reset(int64_t id);
+  void DecrementQueueDepth();
+
+  // NOTE: the slot is claimed before it's reset, and then `owner_` is published, so that Find never returns the metrics being reset.
+  std::atomic<bool> claimed_ = false;
+  std::atomic<const void*> owner_ = nullptr;
+  std::atomic<int64_t> id_ = 0;
+  std::atomic<int64_t> input_packets_ = 0;
+  std::atomic<int64_t> queue_depth_ = 0;
+  std::atomic<int64_t> throttle_events_ = 0;
+  std::atomic<uint64_t> throttled_nodes_[kMaxThrottledNodes / 64] = {};
+  std::atomic<int64_t> dropped_frames_ = 0;
+  std::atomic<int64_t> queue_depth_counts_[kQueueDepthHistogramSize] = {};
+  std::atomic<uint64_t> next_input_ = 0;
+  InputRecord inputs_[kNumInputRecords];
+  std::atomic<int> num_streams_ = 0;
+  StreamMetrics streams_[kMaxStreamMetrics];
+};
+
+// A process-wide registry of the metrics of the CalculatorGraphs used through the C API.
+// The metrics are preallocated and never freed, so they can be updated and copied without locks.
+class MetricsRegistry {
+ public:
+  static MetricsRegistry& GetInstance();
+
+  // It's disabled by default. While it's disabled, no graph is registered, but the registered graphs are still updated.
+  bool enabled() const { return enabled_.load(std::memory_order_relaxed); }
+  void set_enabled(bool enabled) { enabled_.store(enabled, std::memory_order_relaxed); }
+
+  // Returns the metrics of `graph`. If it's not registered yet, it's registered if the registry is enabled.
+  // Returns nullptr if it's not registered.
+  GraphMetrics* Get(const void* graph);
+  GraphMetrics* Find(const void* graph);
+  // Must be called after `graph` is destroyed, since its callbacks may refer to the metrics.
+  void Unregister(const void* graph);
+
+  // Copies the metrics to the buffers as long as the capacities allow, and sets the numbers of them, which can be greater than the capacities.
+  // The graphs are not paused, so the values can be a little inconsistent with each other.
+  void Snapshot(GraphMetricsSnapshot* graphs, int graphs_capacity, int* graphs_size_out, StreamMetricsSnapshot* streams, int streams_capacity,
+                int* streams_size_out) const;
+
+  // Returns a copy of `name` which is valid during the process.
+  const char* InternName(absl::string_view name);
+
+ private:
+  MetricsRegistry() = default;
+
+  std::atomic<bool> enabled_ = false;
+  std::atomic<int64_t> next_id_ = 1;
+  GraphMetrics graphs_[kMaxGraphMetrics];
+  // NOTE: only the registration of the graphs takes this lock, so that a graph is not registered twice by concurrent calls.
+  absl::Mutex registration_mutex_;
+  // NOTE: only the registration of the output streams takes this lock.
+  absl::Mutex names_mutex_;
+  absl::node_hash_set<std::string> names_ ABSL_GUARDED_BY(names_mutex_);
+};
+
+}  // namespace mp_api
+
+extern "C" {
+
+MP_CAPI(bool) mp_MetricsRegistry__enabled();
+MP_CAPI(void) mp_MetricsRegistry__set_enabled__b(bool enabled);
+MP_CAPI(void) mp_MetricsRegistry__Snapshot(mp_api::GraphMetricsSnapshot* graphs, int graphs_capacity, int* graphs_size_out,
+                                           mp_api::StreamMetricsSnapshot* streams, int streams_capacity, int* streams_size_out);
+
+}  // extern "C"
+
+#endif  // MEDIAPIPE_API_FRAMEWORK_METRICS_REGISTRY_H_
@@ -26,7 +26,10 @@ MpReturnCode mp_Packet__At__Rt(mediapipe::Packet* packet, mediapipe::Timestamp*
   CATCH_EXCEPTION
 }
 
-bool mp_Packet__IsEmpty(mediapipe::Packet* packet) { return packet->IsEmpty(); }
+bool mp_Packet__IsEmpty(mediapipe::Packet* packet) {
+  MP_CAPI_SPAN();
+  return packet->IsEmpty();
+}
 
 MpReturnCode mp_Packet__Timestamp(mediapipe::Packet* packet, mediapipe::Timestamp** timestamp_out) {
   TRY
@@ -98,14 +101,17 @@ MpReturnCode mp_Packet__ValidateAsBool(mediapipe::Packet* packet, absl::Status**
 
 // BoolVectorPacket
 MpReturnCode mp__MakeBoolVectorPacket__Pb_i(bool* value, int size, mediapipe::Packet** packet_out) {
+  MP_CAPI_NAMED_SPAN("mp__MakeBoolVectorPacket__Pb_i");
   return mp__MakeVectorPacket(value, size, packet_out);
 }
 
 MpReturnCode mp__MakeBoolVectorPacket_At__Pb_i_ll(bool* value, int size, int64_t timestampMicrosec, mediapipe::Packet** packet_out) {
+  MP_CAPI_NAMED_SPAN("mp__MakeBoolVectorPacket_At__Pb_i_ll");
   return mp__MakeVectorPacket_At(value, size, timestampMicrosec, packet_out);
 }
 
 MpReturnCode mp_Packet__GetBoolVector(mediapipe::Packet* packet, mp_api::StructArray<bool>* value_out) {
+  MP_CAPI_NAMED_SPAN("mp_Packet__GetBoolVector");
   return mp_Packet__GetStructVector(packet, value_out);
 }
 
@@ -227,17 +233,23 @@ MpReturnCode mp_Packet__ValidateAsFloatArray(mediapipe::Packet* packet, absl::St
 }
 
 // FloatVectorPacket
-MpReturnCode mp__MakeFloatVectorPacket__Pf_i(float* value, int size, mediapipe::Packet** packet_out) { return mp__MakeVectorPacket(value, size, packet_out); }
+MpReturnCode mp__MakeFloatVectorPacket__Pf_i(float* value, int size, mediapipe::Packet** packet_out) {
+  MP_CAPI_NAMED_SPAN("mp__MakeFloatVectorPacket__Pf_i");
+  return mp__MakeVectorPacket(value, size, packet_out);
+}
 
 MpReturnCode mp__MakeFloatVectorPacket_At__Pf_i_Rt(float* value, int size, mediapipe::Timestamp* timestamp, mediapipe::Packet** packet_out) {
+  MP_CAPI_NAMED_SPAN("mp__MakeFloatVectorPacket_At__Pf_i_Rt");
   return mp__MakeVectorPacket_At(value, size, timestamp, packet_out);
 }
 
 MpReturnCode mp__MakeFloatVectorPacket_At__Pf_i_ll(float* value, int size, int64_t timestampMicrosec, mediapipe::Packet** packet_out) {
+  MP_CAPI_NAMED_SPAN("mp__MakeFloatVectorPacket_At__Pf_i_ll");
   return mp__MakeVectorPacket_At(value, size, timestampMicrosec, packet_out);
 }
 
 MpReturnCode mp_Packet__GetFloatVector(mediapipe::Packet* packet, mp_api::StructArray<float>* value_out) {
+  MP_CAPI_NAMED_SPAN("mp_Packet__GetFloatVector");
   return mp_Packet__GetStructVector(packet, value_out);
 }
 
@@ -458,6 +470,13 @@ MpReturnCode mp_PacketMap__emplace__PKc_Rp(PacketMap* packet_map, const char* ke
   CATCH_EXCEPTION
 }
 
+MpReturnCode mp_PacketMap__insert_or_assign__PKc_Rp(PacketMap* packet_map, const char* key, mediapipe::Packet* packet) {
+  TRY
+    packet_map->insert_or_assign(std::string(key), std::move(*packet));
+    RETURN_CODE(MpReturnCode::Success);
+  CATCH_EXCEPTION
+}
+
 MpReturnCode mp_PacketMap__find__PKc(PacketMap* packet_map, const char* key, mediapipe::Packet** packet_out) {
   TRY
     auto iter = packet_map->find(std::string(key));
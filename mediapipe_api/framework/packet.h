@@ -118,6 +118,7 @@ MP_CAPI(MpReturnCode) mp_Packet__ValidateAsProtoMessageLite(mediapipe::Packet* p
 MP_CAPI(MpReturnCode) mp_PacketMap__(PacketMap** packet_map_out);
 MP_CAPI(void) mp_PacketMap__delete(PacketMap* packet_map);
 MP_CAPI(MpReturnCode) mp_PacketMap__emplace__PKc_Rp(PacketMap* packet_map, const char* key, mediapipe::Packet* packet);
+MP_CAPI(MpReturnCode) mp_PacketMap__insert_or_assign__PKc_Rp(PacketMap* packet_map, const char* key, mediapipe::Packet* packet);
 MP_CAPI(MpReturnCode) mp_PacketMap__find__PKc(PacketMap* packet_map, const char* key, mediapipe::Packet** packet_out);
 MP_CAPI(MpReturnCode) mp_PacketMap__erase__PKc(PacketMap* packet_map, const char* key, int* count_out);
 MP_CAPI(void) mp_PacketMap__clear(PacketMap* packet_map);
@@ -127,7 +128,7 @@ MP_CAPI(int) mp_PacketMap__size(PacketMap* packet_map);
 
 template <typename T>
 inline MpReturnCode mp_Packet__Consume(mediapipe::Packet* packet, absl::Status** status_out, T** value_out) {
-  TRY_ALL
+  TRY_ALL_NO_SPAN
     auto status_or_unique_ptr = packet->Consume<T>();
 
     *status_out = new absl::Status{status_or_unique_ptr.status()};
@@ -140,7 +141,7 @@ inline MpReturnCode mp_Packet__Consume(mediapipe::Packet* packet, absl::Status**
 
 template <typename T>
 inline MpReturnCode mp_Packet__Get(mediapipe::Packet* packet, const T** value_out) {
-  TRY_ALL
+  TRY_ALL_NO_SPAN
     auto holder = packet->IsEmpty() ? nullptr : mediapipe::packet_internal::GetHolder(*packet)->As<T>();
     auto unsafe_holder = static_cast<const mp_api::UnsafePacketHolder<T>*>(holder);
 
@@ -157,7 +158,7 @@ inline MpReturnCode mp_Packet__Get(mediapipe::Packet* packet, const T** value_ou
 
 template <typename T>
 inline MpReturnCode mp__MakeVectorPacket(const T* array, int size, mediapipe::Packet** packet_out) {
-  TRY
+  TRY_NO_SPAN
     std::vector<T> vector(array, array + size);
     *packet_out = new mediapipe::Packet{mediapipe::MakePacket<std::vector<T>>(vector)};
     RETURN_CODE(MpReturnCode::Success);
@@ -166,7 +167,7 @@ inline MpReturnCode mp__MakeVectorPacket(const T* array, int size, mediapipe::Pa
 
 template <typename T>
 inline MpReturnCode mp__MakeVectorPacket_At(const T* array, int size, mediapipe::Timestamp* timestamp, mediapipe::Packet** packet_out) {
-  TRY
+  TRY_NO_SPAN
     std::vector<T> vector(array, array + size);
     *packet_out = new mediapipe::Packet{mediapipe::MakePacket<std::vector<T>>(vector).At(*timestamp)};
     RETURN_CODE(MpReturnCode::Success);
@@ -175,7 +176,7 @@ inline MpReturnCode mp__MakeVectorPacket_At(const T* array, int size, mediapipe:
 
 template <typename T>
 inline MpReturnCode mp__MakeVectorPacket_At(const T* array, int size, int64_t timestampMicrosec, mediapipe::Packet** packet_out) {
-  TRY
+  TRY_NO_SPAN
     std::vector<T> vector(array, array + size);
     *packet_out = new mediapipe::Packet{mediapipe::MakePacket<std::vector<T>>(vector).At(mediapipe::Timestamp(timestampMicrosec))};
     RETURN_CODE(MpReturnCode::Success);
@@ -184,7 +185,7 @@ inline MpReturnCode mp__MakeVectorPacket_At(const T* array, int size, int64_t ti
 
 template <typename T>
 inline MpReturnCode mp_Packet__GetStructVector(mediapipe::Packet* packet, mp_api::StructArray<T>* value_out) {
-  TRY_ALL
+  TRY_ALL_NO_SPAN
     auto vec = packet->Get<std::vector<T>>();
     auto size = vec.size();
     auto data = new T[size];
@@ -202,7 +203,7 @@ inline MpReturnCode mp_Packet__GetStructVector(mediapipe::Packet* packet, mp_api
 
 template <typename T>
 inline MpReturnCode mp_Packet__GetSerializedProto(mediapipe::Packet* packet, mp_api::SerializedProto* value_out) {
-  TRY_ALL
+  TRY_ALL_NO_SPAN
     auto proto = packet->Get<T>();
     SerializeProto(proto, value_out);
     RETURN_CODE(MpReturnCode::Success);
@@ -211,7 +212,7 @@ inline MpReturnCode mp_Packet__GetSerializedProto(mediapipe::Packet* packet, mp_
 
 template <typename T>
 inline MpReturnCode mp_Packet__GetSerializedProtoVector(mediapipe::Packet* packet, mp_api::StructArray<mp_api::SerializedProto>* value_out) {
-  TRY_ALL
+  TRY_ALL_NO_SPAN
     auto proto_vec = packet->Get<std::vector<T>>();
     SerializeProtoVector(proto_vec, value_out);
     RETURN_CODE(MpReturnCode::Success);
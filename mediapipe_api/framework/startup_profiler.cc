@@ -0,0 +1,304 @@
+// Copyright (c) 2026 homuler
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+#include "mediapipe_api/framework/startup_profiler.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "mediapipe/framework/calculator_profile.pb.h"
+#include "mediapipe/framework/port/logging.h"
+#include "mediapipe/framework/profiler/graph_profiler.h"
+#include "mediapipe/framework/tool/name_util.h"
+
+namespace mp_api {
+
+namespace {
+
+// The profile of the graph being started on the current thread.
+thread_local StartupProfile* current_profile = nullptr;
+
+}  // namespace
+
+StartupProfile::~StartupProfile() {
+  if (tracing_) {
+    StartupProfiler::GetInstance().num_tracing_.fetch_sub(1, std::memory_order_relaxed);
+  }
+}
+
+void StartupProfile::Record(StartupPhaseType type, int node_id, absl::string_view name, absl::Time start, absl::Time end) {
+  absl::MutexLock lock(&mutex_);
+  records_.push_back(Record{type, node_id, std::string(name), start, end});
+}
+
+void StartupProfile::SetProfiler(mediapipe::ProfilingContext* profiler) {
+  absl::MutexLock lock(&mutex_);
+  profiler_ = profiler;
+}
+
+void StartupProfile::CaptureTrace() {
+  absl::MutexLock lock(&mutex_);
+  CaptureTraceLocked();
+}
+
+void StartupProfile::CaptureTraceLocked() {
+  if (!tracing_ || profiler_ == nullptr) {
+    return;
+  }
+  // NOTE: the node names are taken from the validated config, where the subgraphs are expanded, only when the trace is captured first.
+  const auto populate_config = node_names_.empty() ? mediapipe::PopulateGraphConfig::kFull : mediapipe::PopulateGraphConfig::kNo;
+  mediapipe::GraphProfile profile;
+  if (auto status = profiler_->CaptureProfile(&profile, populate_config); !status.ok()) {
+    LOG(WARNING) << "Failed to capture the startup trace: " << status;
+    return;
+  }
+  if (profile.has_config()) {
+    const auto& config = profile.config();
+    node_names_.reserve(config.node_size());
+    for (int i = 0; i < config.node_size(); ++i) {
+      node_names_.push_back(mediapipe::tool::CanonicalNodeName(config, i));
+    }
+  }
+
+  for (const auto& trace : profile.graph_trace()) {
+    // NOTE: the times in the trace are relative to base_time, which is in microseconds since the epoch.
+    for (const auto& event : trace.calculator_trace()) {
+      absl::flat_hash_set<int>* recorded_nodes;
+      StartupPhaseType type;
+      if (event.event_type() == mediapipe::GraphTrace::OPEN) {
+        recorded_nodes = &opened_nodes_;
+        type = StartupPhaseType::kOpen;
+      } else if (event.event_type() == mediapipe::GraphTrace::PROCESS) {
+        recorded_nodes = &processed_nodes_;
+        type = StartupPhaseType::kFirstProcess;
+      } else {
+        continue;
+      }
+      if (!event.has_finish_time() || !recorded_nodes->insert(event.node_id()).second) {
+        continue;
+      }
+      const auto node_id = event.node_id();
+      auto name = node_id >= 0 && node_id < static_cast<int>(node_names_.size()) ? node_names_[node_id] : std::string();
+      if (name == kStartupTraceNodeName) {
+        continue;
+      }
+      records_.push_back(Record{type, node_id, std::move(name), absl::FromUnixMicros(trace.base_time() + event.start_time()),
+                                absl::FromUnixMicros(trace.base_time() + event.finish_time())});
+    }
+  }
+}
+
+bool StartupProfile::EndTracing() {
+  absl::MutexLock lock(&mutex_);
+  if (!started_ || !tracing_) {
+    return false;
+  }
+  CaptureTraceLocked();
+  tracing_ = false;
+  StartupProfiler::GetInstance().num_tracing_.fetch_sub(1, std::memory_order_relaxed);
+  return true;
+}
+
+bool StartupProfile::IsTracingExpired() {
+  absl::MutexLock lock(&mutex_);
+  return tracing_ && absl::Now() - start_time_ > kMaxTracingDuration;
+}
+
+void StartupProfile::PauseTracer() {
+  absl::MutexLock lock(&mutex_);
+  if (profiler_ != nullptr) {
+    profiler_->Pause();
+  }
+}
+
+bool StartupProfile::MarkStarted() {
+  absl::MutexLock lock(&mutex_);
+  return !std::exchange(started_, true);
+}
+
+bool StartupProfile::MarkProcessed() {
+  absl::MutexLock lock(&mutex_);
+  return !std::exchange(processed_, true);
+}
+
+bool StartupProfile::tracing() {
+  absl::MutexLock lock(&mutex_);
+  return tracing_;
+}
+
+void StartupProfile::StartTracing() {
+  absl::MutexLock lock(&mutex_);
+  if (!std::exchange(tracing_, true)) {
+    StartupProfiler::GetInstance().num_tracing_.fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
+std::vector<StartupPhase> StartupProfile::GetPhases() {
+  absl::MutexLock lock(&mutex_);
+  std::vector<StartupPhase> phases;
+  phases.reserve(records_.size());
+  for (const auto& record : records_) {
+    phases.push_back(StartupPhase{static_cast<int32_t>(record.type), record.node_id, record.name.c_str(),
+                                  absl::ToInt64Microseconds(record.start - start_time_), absl::ToInt64Microseconds(record.end - record.start)});
+  }
+  std::stable_sort(phases.begin(), phases.end(), [](const StartupPhase& a, const StartupPhase& b) { return a.start_us < b.start_us; });
+  return phases;
+}
+
+StartupProfiler& StartupProfiler::GetInstance() {
+  static auto* profiler = new StartupProfiler();
+  return *profiler;
+}
+
+std::shared_ptr<StartupProfile> StartupProfiler::NewProfile() {
+  if (!enabled()) {
+    return nullptr;
+  }
+  return std::make_shared<StartupProfile>();
+}
+
+void StartupProfiler::Attach(const void* owner, std::shared_ptr<StartupProfile> profile) {
+  absl::MutexLock lock(&mutex_);
+  profiles_[owner] = std::move(profile);
+}
+
+std::shared_ptr<StartupProfile> StartupProfiler::Find(const void* owner) {
+  absl::MutexLock lock(&mutex_);
+  auto it = profiles_.find(owner);
+  return it == profiles_.end() ? nullptr : it->second;
+}
+
+void StartupProfiler::Detach(const void* owner) {
+  std::shared_ptr<StartupProfile> profile;
+  absl::MutexLock lock(&mutex_);
+  if (auto it = profiles_.find(owner); it != profiles_.end()) {
+    // NOTE: destroy the profile outside the lock.
+    profile = std::move(it->second);
+    profiles_.erase(it);
+  }
+}
+
+std::shared_ptr<StartupProfile> StartupProfiler::FindExpired(const void* owner) {
+  if (!HasTracingProfiles()) {
+    return nullptr;
+  }
+  auto profile = Find(owner);
+  return profile != nullptr && profile->IsTracingExpired() ? profile : nullptr;
+}
+
+void StartupProfiler::RecordActive(StartupPhaseType type, absl::string_view name, absl::Time start) {
+  if (!HasActiveProfiles()) {
+    return;
+  }
+  const auto end = absl::Now();
+  if (current_profile != nullptr) {
+    current_profile->Record(type, -1, name, start, end);
+    return;
+  }
+  std::shared_ptr<StartupProfile> profile;
+  {
+    absl::MutexLock lock(&mutex_);
+    if (active_profiles_.size() != 1) {
+      return;
+    }
+    profile = active_profiles_.front();
+  }
+  profile->Record(type, -1, name, start, end);
+}
+
+void StartupProfiler::Activate(std::shared_ptr<StartupProfile> profile) {
+  absl::MutexLock lock(&mutex_);
+  active_profiles_.push_back(std::move(profile));
+  num_active_.store(static_cast<int>(active_profiles_.size()), std::memory_order_relaxed);
+}
+
+void StartupProfiler::Deactivate(const StartupProfile* profile) {
+  absl::MutexLock lock(&mutex_);
+  auto it = std::find_if(active_profiles_.begin(), active_profiles_.end(), [profile](const auto& active) { return active.get() == profile; });
+  if (it != active_profiles_.end()) {
+    active_profiles_.erase(it);
+  }
+  num_active_.store(static_cast<int>(active_profiles_.size()), std::memory_order_relaxed);
+}
+
+ScopedStartupProfile::ScopedStartupProfile(std::shared_ptr<StartupProfile> profile) : profile_(std::move(profile)) {
+  if (profile_ != nullptr) {
+    StartupProfiler::GetInstance().Activate(profile_);
+    previous_profile_ = std::exchange(current_profile, profile_.get());
+  }
+}
+
+ScopedStartupProfile::~ScopedStartupProfile() {
+  if (profile_ != nullptr) {
+    current_profile = previous_profile_;
+    StartupProfiler::GetInstance().Deactivate(profile_.get());
+  }
+}
+
+void ScopedStartupProfile::Record(StartupPhaseType type, absl::Time start) {
+  if (profile_ != nullptr) {
+    profile_->Record(type, -1, "", start, absl::Now());
+  }
+}
+
+void ScopedStartupProfile::EnableTracing(mediapipe::CalculatorGraphConfig* config) {
+  if (profile_ == nullptr) {
+    return;
+  }
+  if (config->has_profiler_config()) {
+    // NOTE: capturing the trace would interfere with the trace log of the profiler configured by the user,
+    // but it can be shared with the one configured by GraphProfiling, which does not write the trace log.
+    const auto& profiler_config = config->profiler_config();
+    if (profiler_config.trace_enabled() && profiler_config.trace_log_disabled()) {
+      profile_->StartTracing();
+    }
+    return;
+  }
+  auto* profiler_config = config->mutable_profiler_config();
+  profiler_config->set_trace_enabled(true);
+  profiler_config->set_trace_log_disabled(true);
+  profiler_config->set_trace_log_margin_usec(0);
+  profile_->StartTracing();
+}
+
+void ScopedStartupProfile::EnableTaskTracing(mediapipe::CalculatorGraphConfig* config, std::map<std::string, mediapipe::Packet>* side_packets) {
+  // NOTE: unlike CalculatorGraph, the tracer configured by the user is not shared, because it would be paused when the startup window is closed.
+  if (profile_ == nullptr || config->has_profiler_config()) {
+    return;
+  }
+  EnableTracing(config);
+  auto* node = config->add_node();
+  node->set_name(kStartupTraceNodeName);
+  node->set_calculator("StartupTraceCalculator");
+  node->add_input_side_packet(kStartupProfileSidePacket);
+  side_packets->emplace(kStartupProfileSidePacket, mediapipe::MakePacket<std::shared_ptr<StartupProfile>>(profile_));
+}
+
+void ScopedStartupProfile::Attach(const void* owner, mediapipe::ProfilingContext* profiler) {
+  if (profile_ != nullptr) {
+    if (profiler != nullptr) {
+      profile_->SetProfiler(profiler);
+    }
+    StartupProfiler::GetInstance().Attach(owner, profile_);
+  }
+}
+
+void GetStartupPhases(const void* owner, StructArray<StartupPhase>* value_out) {
+  auto profile = StartupProfiler::GetInstance().Find(owner);
+  auto phases = profile == nullptr ? std::vector<StartupPhase>{} : profile->GetPhases();
+  auto data = new StartupPhase[phases.size()];
+  std::copy(phases.begin(), phases.end(), data);
+  value_out->data = data;
+  value_out->size = static_cast<int>(phases.size());
+}
+
+}  // namespace mp_api
+
+bool mp_StartupProfiler__enabled() { return mp_api::StartupProfiler::GetInstance().enabled(); }
+
+void mp_StartupProfiler__set_enabled__b(bool enabled) { mp_api::StartupProfiler::GetInstance().set_enabled(enabled); }
+
+void mp_api_StartupPhaseArray__delete(mp_api::StructArray<mp_api::StartupPhase> array) { delete[] array.data; }
@@ -0,0 +1,217 @@
+// Copyright (c) 2026 homuler
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+#ifndef MEDIAPIPE_API_FRAMEWORK_STARTUP_PROFILER_H_
+#define MEDIAPIPE_API_FRAMEWORK_STARTUP_PROFILER_H_
+
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
+#include "absl/container/flat_hash_set.h"
+#include "absl/strings/string_view.h"
+#include "absl/synchronization/mutex.h"
+#include "absl/time/time.h"
+#include "mediapipe/framework/calculator.pb.h"
+#include "mediapipe/framework/calculator_graph.h"
+#include "mediapipe_api/common.h"
+
+namespace mp_api {
+
+enum class StartupPhaseType : int32_t {
+  // Parsing the serialized config, including the expansion by ExpandedConfigCache if it's enabled.
+  kConfigParse = 0,
+  // Validating the config and expanding the subgraphs, i.e. CalculatorGraph::Initialize.
+  // NOTE: it includes GetContract of every calculator, which is not broken down because ValidatedGraphConfig does not expose the time.
+  kValidation = 1,
+  // Reading a resource, e.g. a model asset.
+  kModelLoad = 2,
+  // Building an interpreter and applying the delegate to it.
+  kDelegateInit = 3,
+  // CalculatorGraph::StartRun. For TaskRunner, it also includes kValidation.
+  kStartRun = 4,
+  // Open of a calculator.
+  kOpen = 5,
+  // The first Process of a calculator, or the first TaskRunner::Process.
+  kFirstProcess = 6,
+};
+
+struct StartupPhase {
+  int32_t type;
+  // The id of the calculator node, or -1 if the phase is not of a calculator.
+  int32_t node_id;
+  // The name of the calculator node, or the path of the model asset. It's valid while the graph is alive.
+  const char* name;
+  // The time elapsed since the startup began.
+  int64_t start_us;
+  int64_t duration_us;
+};
+
+// The phases of the startup of a CalculatorGraph or a TaskRunner.
+class StartupProfile {
+ public:
+  // The startup window is closed automatically after this duration since the startup began, if EndTracing is not called before.
+  static constexpr absl::Duration kMaxTracingDuration = absl::Seconds(5);
+
+  StartupProfile() : start_time_(absl::Now()) {}
+  ~StartupProfile();
+
+  StartupProfile(const StartupProfile&) = delete;
+  StartupProfile& operator=(const StartupProfile&) = delete;
+
+  void Record(StartupPhaseType type, int node_id, absl::string_view name, absl::Time start, absl::Time end);
+
+  // Sets the profiler of the graph, which must outlive the profile unless it's reset to nullptr.
+  void SetProfiler(mediapipe::ProfilingContext* profiler);
+
+  // Records Open and the first Process of each calculator that are traced by the graph since the last call.
+  // It does nothing unless the tracer is enabled by StartupProfiler, or after EndTracing.
+  void CaptureTrace();
+
+  void StartTracing();
+  // Captures the trace and ends the startup window after the graph is started, so that the tracer can be paused.
+  // Returns true if the startup has been traced until this call.
+  bool EndTracing();
+  // Returns true if the startup is being traced for longer than kMaxTracingDuration.
+  bool IsTracingExpired();
+  // Pauses the tracer of the graph. It's for TaskRunner, whose tracer is not paused by GraphProfiling.
+  void PauseTracer();
+
+  // Returns true only for the first call.
+  bool MarkStarted();
+  bool MarkProcessed();
+  bool tracing();
+
+  std::vector<StartupPhase> GetPhases();
+
+ private:
+  struct Record {
+    StartupPhaseType type;
+    int node_id;
+    std::string name;
+    absl::Time start;
+    absl::Time end;
+  };
+
+  void CaptureTraceLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mutex_);
+
+  const absl::Time start_time_;
+  absl::Mutex mutex_;
+  mediapipe::ProfilingContext* profiler_ ABSL_GUARDED_BY(mutex_) = nullptr;
+  // NOTE: std::deque does not move the elements, so the names can be referred to by StartupPhase.
+  std::deque<Record> records_ ABSL_GUARDED_BY(mutex_);
+  std::vector<std::string> node_names_ ABSL_GUARDED_BY(mutex_);
+  absl::flat_hash_set<int> opened_nodes_ ABSL_GUARDED_BY(mutex_);
+  absl::flat_hash_set<int> processed_nodes_ ABSL_GUARDED_BY(mutex_);
+  bool started_ ABSL_GUARDED_BY(mutex_) = false;
+  bool processed_ ABSL_GUARDED_BY(mutex_) = false;
+  bool tracing_ ABSL_GUARDED_BY(mutex_) = false;
+};
+
+// Records the startup of the CalculatorGraphs and the TaskRunners created through the C API, so that the slow startup can be broken down.
+// It's disabled by default.
+class StartupProfiler {
+ public:
+  static StartupProfiler& GetInstance();
+
+  bool enabled() const { return enabled_.load(std::memory_order_relaxed); }
+  void set_enabled(bool enabled) { enabled_.store(enabled, std::memory_order_relaxed); }
+
+  // Returns a new profile, or nullptr if the profiler is disabled.
+  std::shared_ptr<StartupProfile> NewProfile();
+
+  void Attach(const void* owner, std::shared_ptr<StartupProfile> profile);
+  std::shared_ptr<StartupProfile> Find(const void* owner);
+  void Detach(const void* owner);
+  // Returns the profile of `owner` if its startup has been traced for longer than StartupProfile::kMaxTracingDuration.
+  std::shared_ptr<StartupProfile> FindExpired(const void* owner);
+
+  // Records the phase from `start` to now to the profile of the graph being started, because the model assets are loaded
+  // and the delegates are initialized on the executor threads.
+  // The phase on the thread that starts a graph is recorded to its profile. The one on another thread is recorded only if a single graph is
+  // being started, since it cannot be attributed to one of the graphs being started concurrently.
+  void RecordActive(StartupPhaseType type, absl::string_view name, absl::Time start);
+  bool HasActiveProfiles() const { return num_active_.load(std::memory_order_relaxed) > 0; }
+  // Returns true if the startup of any graph is being traced, so that the hot paths can skip looking up the profile.
+  bool HasTracingProfiles() const { return num_tracing_.load(std::memory_order_relaxed) > 0; }
+
+ private:
+  friend class ScopedStartupProfile;
+  friend class StartupProfile;
+
+  StartupProfiler() = default;
+
+  void Activate(std::shared_ptr<StartupProfile> profile);
+  void Deactivate(const StartupProfile* profile);
+
+  std::atomic<bool> enabled_ = false;
+  std::atomic<int> num_active_ = 0;
+  std::atomic<int> num_tracing_ = 0;
+  absl::Mutex mutex_;
+  absl::flat_hash_map<const void*, std::shared_ptr<StartupProfile>> profiles_ ABSL_GUARDED_BY(mutex_);
+  std::vector<std::shared_ptr<StartupProfile>> active_profiles_ ABSL_GUARDED_BY(mutex_);
+};
+
+// While it's alive, the phases recorded by StartupProfiler::RecordActive are added to the profile.
+// The phases recorded on the current thread are attributed to the innermost one.
+// If the profile is null, all the methods do nothing.
+class ScopedStartupProfile {
+ public:
+  explicit ScopedStartupProfile(std::shared_ptr<StartupProfile> profile);
+  ~ScopedStartupProfile();
+
+  ScopedStartupProfile(const ScopedStartupProfile&) = delete;
+  ScopedStartupProfile& operator=(const ScopedStartupProfile&) = delete;
+
+  // Records the phase from `start` to now.
+  void Record(StartupPhaseType type, absl::Time start);
+
+  // Enables the tracer of the graph unless the profiler is configured by the user, so that Open and Process can be captured.
+  // NOTE: the tracer records every event of the graph until the startup window is closed by StartupProfile::EndTracing,
+  // and then it's paused as the one enabled by GraphProfiling is.
+  void EnableTracing(mediapipe::CalculatorGraphConfig* config);
+
+  // Enables the tracer as EnableTracing, and adds a StartupTraceCalculator node to `config`, which passes the profiler of the graph
+  // to the profile through `side_packets`. It's for TaskRunner, which does not expose its graph.
+  void EnableTaskTracing(mediapipe::CalculatorGraphConfig* config, std::map<std::string, mediapipe::Packet>* side_packets);
+
+  // Sets the profiler of the graph to the profile unless it's null, and associates the profile with `owner`.
+  void Attach(const void* owner, mediapipe::ProfilingContext* profiler);
+
+  const std::shared_ptr<StartupProfile>& profile() const { return profile_; }
+
+ private:
+  std::shared_ptr<StartupProfile> profile_;
+  StartupProfile* previous_profile_ = nullptr;
+};
+
+// The name of the input side packet of StartupTraceCalculator, which is a std::shared_ptr<StartupProfile>.
+inline constexpr char kStartupProfileSidePacket[] = "__startup_profile";
+// The name of the StartupTraceCalculator node, whose events are not recorded.
+inline constexpr char kStartupTraceNodeName[] = "__startup_trace";
+
+// Copies the phases recorded for `owner` to a new array, which must be deleted by mp_api_StartupPhaseArray__delete.
+// The array is empty if the profiler was disabled when `owner` was created.
+void GetStartupPhases(const void* owner, StructArray<StartupPhase>* value_out);
+
+}  // namespace mp_api
+
+extern "C" {
+
+MP_CAPI(bool) mp_StartupProfiler__enabled();
+MP_CAPI(void) mp_StartupProfiler__set_enabled__b(bool enabled);
+
+MP_CAPI(void) mp_api_StartupPhaseArray__delete(mp_api::StructArray<mp_api::StartupPhase> array);
+
+}  // extern "C"
+
+#endif  // MEDIAPIPE_API_FRAMEWORK_STARTUP_PROFILER_H_
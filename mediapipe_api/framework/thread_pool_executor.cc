@@ -0,0 +1,63 @@
+// Copyright (c) 2026 homuler
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+#include "mediapipe_api/framework/thread_pool_executor.h"
+
+#include <utility>
+
+#include "absl/strings/str_cat.h"
+
+namespace mp_api {
+
+absl::StatusOr<std::shared_ptr<ThreadPoolExecutor>> ThreadPoolExecutor::Create(int num_threads, const std::string& thread_name_prefix,
+                                                                               int nice_priority_level, const std::set<int>& cpu_set) {
+  if (num_threads <= 0) {
+    return absl::InvalidArgumentError(absl::StrCat("num_threads must be positive, but got ", num_threads));
+  }
+  for (auto cpu : cpu_set) {
+    if (cpu < 0) {
+      return absl::InvalidArgumentError(absl::StrCat("Invalid CPU index: ", cpu));
+    }
+  }
+
+  mediapipe::ThreadOptions thread_options;
+  thread_options.set_name_prefix(thread_name_prefix.empty() ? "mp_api_executor" : thread_name_prefix)
+      .set_nice_priority_level(nice_priority_level)
+      .set_cpu_set(cpu_set);
+  return std::make_shared<ThreadPoolExecutor>(thread_options, num_threads);
+}
+
+ThreadPoolExecutor::ThreadPoolExecutor(const mediapipe::ThreadOptions& thread_options, int num_threads)
+    : thread_pool_(thread_options, thread_options.name_prefix(), num_threads) {
+  thread_pool_.StartWorkers();
+}
+
+void ThreadPoolExecutor::Schedule(std::function<void()> task) { thread_pool_.Schedule(std::move(task)); }
+
+}  // namespace mp_api
+
+void mp_SharedExecutor__delete(SharedExecutor* executor) { delete executor; }
+
+mediapipe::Executor* mp_SharedExecutor__get(SharedExecutor* executor) { return executor->get(); }
+
+void mp_SharedExecutor__reset(SharedExecutor* executor) { executor->reset(); }
+
+MpReturnCode mp_ThreadPoolExecutor_Create__i_PKc_i_Pi_i(int num_threads, const char* thread_name_prefix, int nice_priority_level,
+                                                        int* cpu_set, int cpu_set_size, absl::Status** status_out, SharedExecutor** executor_out) {
+  TRY
+    auto status_or_executor = mp_api::ThreadPoolExecutor::Create(num_threads, thread_name_prefix == nullptr ? "" : thread_name_prefix, nice_priority_level,
+                                                                 std::set<int>(cpu_set, cpu_set + cpu_set_size));
+    *status_out = new absl::Status{status_or_executor.status()};
+    if (status_or_executor.ok()) {
+      *executor_out = new SharedExecutor{std::move(status_or_executor).value()};
+    } else {
+      *executor_out = nullptr;
+    }
+    RETURN_CODE(MpReturnCode::Success);
+  CATCH_EXCEPTION
+}
+
+int mp_ThreadPoolExecutor__num_threads(mp_api::ThreadPoolExecutor* executor) { return executor->num_threads(); }
@@ -0,0 +1,60 @@
+// Copyright (c) 2026 homuler
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+#ifndef MEDIAPIPE_API_FRAMEWORK_THREAD_POOL_EXECUTOR_H_
+#define MEDIAPIPE_API_FRAMEWORK_THREAD_POOL_EXECUTOR_H_
+
+#include <functional>
+#include <memory>
+#include <set>
+#include <string>
+
+#include "absl/status/statusor.h"
+#include "mediapipe/framework/deps/thread_options.h"
+#include "mediapipe/framework/executor.h"
+#include "mediapipe/framework/port/threadpool.h"
+#include "mediapipe_api/common.h"
+
+namespace mp_api {
+
+// An executor backed by a fixed-size thread pool, which can be shared by multiple graphs and TaskRunners,
+// so that the number of the worker threads in the process is bounded.
+//
+// Unlike mediapipe::ThreadPoolExecutor, the worker threads can be pinned to the specified CPUs.
+class ThreadPoolExecutor : public mediapipe::Executor {
+ public:
+  // `num_threads` must be positive. If `cpu_set` is not empty, the worker threads can run only on the specified CPUs.
+  // `nice_priority_level` and `cpu_set` are ignored on the platforms that don't support them.
+  static absl::StatusOr<std::shared_ptr<ThreadPoolExecutor>> Create(int num_threads, const std::string& thread_name_prefix, int nice_priority_level,
+                                                                    const std::set<int>& cpu_set);
+
+  ThreadPoolExecutor(const mediapipe::ThreadOptions& thread_options, int num_threads);
+
+  void Schedule(std::function<void()> task) override;
+
+  int num_threads() const { return thread_pool_.num_threads(); }
+
+ private:
+  mediapipe::ThreadPool thread_pool_;
+};
+
+}  // namespace mp_api
+
+extern "C" {
+
+typedef std::shared_ptr<mediapipe::Executor> SharedExecutor;
+
+MP_CAPI(void) mp_SharedExecutor__delete(SharedExecutor* executor);
+MP_CAPI(mediapipe::Executor*) mp_SharedExecutor__get(SharedExecutor* executor);
+MP_CAPI(void) mp_SharedExecutor__reset(SharedExecutor* executor);
+
+MP_CAPI(MpReturnCode) mp_ThreadPoolExecutor_Create__i_PKc_i_Pi_i(int num_threads, const char* thread_name_prefix, int nice_priority_level,
+                                                                 int* cpu_set, int cpu_set_size, absl::Status** status_out, SharedExecutor** executor_out);
+MP_CAPI(int) mp_ThreadPoolExecutor__num_threads(mp_api::ThreadPoolExecutor* executor);
+
+}  // extern "C"
+
+#endif  // MEDIAPIPE_API_FRAMEWORK_THREAD_POOL_EXECUTOR_H_
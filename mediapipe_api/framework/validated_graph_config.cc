@@ -1,5 +1,6 @@
 #include "mediapipe_api/framework/validated_graph_config.h"
 #include "mediapipe_api/external/absl/statusor.h"
+#include "mediapipe_api/framework/expanded_config_cache.h"
 
 MpReturnCode mp_ValidatedGraphConfig__(mediapipe::ValidatedGraphConfig** config_out) {
   TRY
@@ -13,7 +14,7 @@ void mp_ValidatedGraphConfig__delete(mediapipe::ValidatedGraphConfig* config) {
 MpReturnCode mp_ValidatedGraphConfig__Initialize__Rcgc(mediapipe::ValidatedGraphConfig* config, const char* serialized_config, int size,
                                                        absl::Status** status_out) {
   TRY
-    auto graph_config = ParseFromStringAsProto<mediapipe::CalculatorGraphConfig>(serialized_config, size);
+    auto graph_config = mp_api::ExpandedConfigCache::GetInstance().GetConfig(serialized_config, size);
     auto status = config->Initialize(graph_config);
     *status_out = new absl::Status(std::move(status));
     RETURN_CODE(MpReturnCode::Success);
@@ -0,0 +1,271 @@
+// Copyright (c) 2026 homuler
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+#include "mediapipe_api/framework/warm_graph_pool.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "absl/memory/memory.h"
+#include "absl/strings/str_cat.h"
+#include "mediapipe/framework/port/status_macros.h"
+#include "mediapipe/framework/tool/validate_name.h"
+#include "mediapipe_api/framework/expanded_config_cache.h"
+
+namespace mp_api {
+
+absl::Status WarmGraph::OutputRouter::Dispatch(const std::string& stream_name, const mediapipe::Packet& packet) {
+  PacketCallback callback;
+  {
+    absl::MutexLock lock(&mutex);
+    auto it = callbacks.find(stream_name);
+    if (it == callbacks.end()) {
+      return absl::OkStatus();
+    }
+    callback = it->second;
+  }
+  return callback(packet);
+}
+
+WarmGraph::~WarmGraph() {
+  if (running_) {
+    graph_->Cancel();
+    graph_->WaitUntilDone().IgnoreError();
+  }
+}
+
+absl::Status WarmGraph::ObserveOutputStream(const std::string& stream_name, PacketCallback callback) {
+  if (std::find(output_streams_.begin(), output_streams_.end(), stream_name) == output_streams_.end()) {
+    return absl::InvalidArgumentError(absl::StrCat(stream_name, " is not observed by the pool"));
+  }
+  absl::MutexLock lock(&router_->mutex);
+  router_->callbacks[stream_name] = std::move(callback);
+  return absl::OkStatus();
+}
+
+absl::Status WarmGraph::AddPacketToInputStream(const std::string& stream_name, mediapipe::Packet packet) {
+  return graph_->AddPacketToInputStream(stream_name, std::move(packet));
+}
+
+absl::Status WarmGraph::CloseInputStream(const std::string& stream_name) { return graph_->CloseInputStream(stream_name); }
+
+absl::Status WarmGraph::CloseAllPacketSources() { return graph_->CloseAllPacketSources(); }
+
+absl::Status WarmGraph::WaitUntilIdle() { return graph_->WaitUntilIdle(); }
+
+absl::Status WarmGraph::WaitUntilDone() {
+  auto status = graph_->WaitUntilDone();
+  running_ = false;
+  return status;
+}
+
+bool WarmGraph::HasError() const { return graph_->HasError(); }
+
+absl::StatusOr<std::unique_ptr<WarmGraphPool>> WarmGraphPool::Create(mediapipe::CalculatorGraphConfig config, Options options) {
+  if (options.size <= 0) {
+    return absl::InvalidArgumentError(absl::StrCat("size must be positive, but got ", options.size));
+  }
+  if (options.output_streams.empty()) {
+    for (const auto& output_stream : config.output_stream()) {
+      std::string tag, name;
+      int index;
+      MP_RETURN_IF_ERROR(mediapipe::tool::ParseTagIndexName(output_stream, &tag, &index, &name));
+      options.output_streams.push_back(std::move(name));
+    }
+  }
+  for (auto& [name, packet] : options.warmup_inputs) {
+    packet = packet.At(options.warmup_timestamp);
+  }
+
+  // NOTE: the model assets are loaded once, and the graphs refer to them.
+  auto model_assets = SharedModelCache::GetInstance().ShareModelAssets(config);
+  auto warm_graph_pool = absl::WrapUnique(new WarmGraphPool(std::move(config), std::move(options), std::move(model_assets)));
+  warm_graph_pool->thread_ = std::thread([pool = warm_graph_pool.get()] { pool->RunLoop(); });
+  return warm_graph_pool;
+}
+
+WarmGraphPool::WarmGraphPool(mediapipe::CalculatorGraphConfig config, Options options, std::vector<SharedModelCache::Handle> model_assets)
+    : config_(std::move(config)), options_(std::move(options)), model_assets_(std::move(model_assets)) {}
+
+WarmGraphPool::~WarmGraphPool() {
+  {
+    absl::MutexLock lock(&mutex_);
+    stopped_ = true;
+  }
+  thread_.join();
+}
+
+absl::StatusOr<std::unique_ptr<WarmGraph>> WarmGraphPool::Acquire() {
+  absl::MutexLock lock(&mutex_);
+  auto is_ready = [this]() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mutex_) { return !ready_graphs_.empty() || !error_.ok(); };
+  mutex_.Await(absl::Condition(&is_ready));
+
+  if (ready_graphs_.empty()) {
+    return error_;
+  }
+  auto warm_graph = std::move(ready_graphs_.front());
+  ready_graphs_.pop_front();
+  return warm_graph;
+}
+
+int WarmGraphPool::ready_count() const {
+  absl::MutexLock lock(&mutex_);
+  return static_cast<int>(ready_graphs_.size());
+}
+
+void WarmGraphPool::RunLoop() {
+  auto retry_delay = kMinRetryDelay;
+  while (true) {
+    {
+      absl::MutexLock lock(&mutex_);
+      auto should_wake = [this]() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mutex_) { return stopped_ || static_cast<int>(ready_graphs_.size()) < options_.size; };
+      mutex_.Await(absl::Condition(&should_wake));
+      if (stopped_) {
+        return;
+      }
+    }
+
+    auto warm_graph = Prepare();
+
+    absl::MutexLock lock(&mutex_);
+    if (!warm_graph.ok()) {
+      // NOTE: the failure can be transient (e.g. out of memory while another scene is loaded), so keep retrying until the pool is stopped.
+      // Acquire fails with the error in the meantime, instead of waiting for a graph that may never be ready.
+      error_ = warm_graph.status();
+      auto is_stopped = [this]() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mutex_) { return stopped_; };
+      mutex_.AwaitWithTimeout(absl::Condition(&is_stopped), retry_delay);
+      retry_delay = std::min(retry_delay * 2, kMaxRetryDelay);
+      continue;
+    }
+    error_ = absl::OkStatus();
+    retry_delay = kMinRetryDelay;
+    // NOTE: if the pool is stopped, the graph is destroyed when the queue is destroyed.
+    ready_graphs_.push_back(std::move(warm_graph).value());
+  }
+}
+
+absl::StatusOr<std::unique_ptr<WarmGraph>> WarmGraphPool::Prepare() const {
+  auto warm_graph = absl::WrapUnique(new WarmGraph());
+  warm_graph->model_assets_ = model_assets_;
+  warm_graph->output_streams_ = options_.output_streams;
+  warm_graph->graph_ = std::make_unique<mediapipe::CalculatorGraph>();
+
+  auto* graph = warm_graph->graph_.get();
+  MP_RETURN_IF_ERROR(graph->Initialize(config_));
+  for (const auto& stream_name : options_.output_streams) {
+    MP_RETURN_IF_ERROR(graph->ObserveOutputStream(stream_name, [router = warm_graph->router_, stream_name](const mediapipe::Packet& packet) {
+      return router->Dispatch(stream_name, packet);
+    }));
+  }
+  MP_RETURN_IF_ERROR(graph->StartRun(options_.side_packets));
+  warm_graph->running_ = true;
+
+  for (const auto& [stream_name, packet] : options_.warmup_inputs) {
+    MP_RETURN_IF_ERROR(graph->AddPacketToInputStream(stream_name, packet));
+  }
+  MP_RETURN_IF_ERROR(graph->WaitUntilIdle());
+  return warm_graph;
+}
+
+}  // namespace mp_api
+
+MpReturnCode mp_WarmGraphPool_Create__PKc_i_i_PPKc_i_Rsp_ll_Rsp(const char* serialized_config, int size, int pool_size, const char** output_streams,
+                                                               int output_stream_count, SidePackets* warmup_inputs, int64_t warmup_timestamp_us,
+                                                               SidePackets* side_packets, absl::Status** status_out,
+                                                               mp_api::WarmGraphPool** warm_graph_pool_out) {
+  TRY_ALL
+    mp_api::WarmGraphPool::Options options;
+    options.size = pool_size;
+    options.output_streams.assign(output_streams, output_streams + output_stream_count);
+    options.warmup_inputs = *warmup_inputs;
+    options.warmup_timestamp = mediapipe::Timestamp(warmup_timestamp_us);
+    options.side_packets = *side_packets;
+
+    auto config = mp_api::ExpandedConfigCache::GetInstance().GetConfig(serialized_config, size, side_packets);
+    auto status_or_warm_graph_pool = mp_api::WarmGraphPool::Create(std::move(config), std::move(options));
+    *status_out = new absl::Status{status_or_warm_graph_pool.status()};
+    if (status_or_warm_graph_pool.ok()) {
+      *warm_graph_pool_out = std::move(status_or_warm_graph_pool).value().release();
+    } else {
+      *warm_graph_pool_out = nullptr;
+    }
+    RETURN_CODE(MpReturnCode::Success);
+  CATCH_ALL
+}
+
+void mp_WarmGraphPool__delete(mp_api::WarmGraphPool* warm_graph_pool) { delete warm_graph_pool; }
+
+MpReturnCode mp_WarmGraphPool__Acquire(mp_api::WarmGraphPool* warm_graph_pool, absl::Status** status_out, mp_api::WarmGraph** warm_graph_out) {
+  TRY_ALL
+    auto status_or_warm_graph = warm_graph_pool->Acquire();
+    *status_out = new absl::Status{status_or_warm_graph.status()};
+    if (status_or_warm_graph.ok()) {
+      *warm_graph_out = std::move(status_or_warm_graph).value().release();
+    } else {
+      *warm_graph_out = nullptr;
+    }
+    RETURN_CODE(MpReturnCode::Success);
+  CATCH_ALL
+}
+
+int mp_WarmGraphPool__ready_count(mp_api::WarmGraphPool* warm_graph_pool) { return warm_graph_pool->ready_count(); }
+
+void mp_WarmGraph__delete(mp_api::WarmGraph* warm_graph) { delete warm_graph; }
+
+MpReturnCode mp_WarmGraph__ObserveOutputStream__PKc_i_PF(mp_api::WarmGraph* warm_graph, const char* stream_name, int stream_id,
+                                                         NativePacketCallback* packet_callback, absl::Status** status_out) {
+  TRY_ALL
+    auto* graph = &warm_graph->graph();
+    auto status = warm_graph->ObserveOutputStream(stream_name, [graph, stream_id, packet_callback](const mediapipe::Packet& packet) -> absl::Status {
+      auto status_args = packet_callback(graph, stream_id, packet);
+      auto callback_status = absl::Status{status_args.code, absl::NullSafeStringView((const char*)status_args.message)};
+      if (status_args.message != nullptr) {
+        mp_api::freeHGlobal(status_args.message);
+      }
+      return callback_status;
+    });
+    *status_out = new absl::Status{std::move(status)};
+    RETURN_CODE(MpReturnCode::Success);
+  CATCH_ALL
+}
+
+MpReturnCode mp_WarmGraph__AddPacketToInputStream__PKc_Ppacket(mp_api::WarmGraph* warm_graph, const char* stream_name, mediapipe::Packet* packet,
+                                                               absl::Status** status_out) {
+  TRY
+    *status_out = new absl::Status{warm_graph->AddPacketToInputStream(stream_name, std::move(*packet))};
+    RETURN_CODE(MpReturnCode::Success);
+  CATCH_EXCEPTION
+}
+
+MpReturnCode mp_WarmGraph__CloseInputStream__PKc(mp_api::WarmGraph* warm_graph, const char* stream_name, absl::Status** status_out) {
+  TRY
+    *status_out = new absl::Status{warm_graph->CloseInputStream(stream_name)};
+    RETURN_CODE(MpReturnCode::Success);
+  CATCH_EXCEPTION
+}
+
+MpReturnCode mp_WarmGraph__CloseAllPacketSources(mp_api::WarmGraph* warm_graph, absl::Status** status_out) {
+  TRY
+    *status_out = new absl::Status{warm_graph->CloseAllPacketSources()};
+    RETURN_CODE(MpReturnCode::Success);
+  CATCH_EXCEPTION
+}
+
+MpReturnCode mp_WarmGraph__WaitUntilIdle(mp_api::WarmGraph* warm_graph, absl::Status** status_out) {
+  TRY
+    *status_out = new absl::Status{warm_graph->WaitUntilIdle()};
+    RETURN_CODE(MpReturnCode::Success);
+  CATCH_EXCEPTION
+}
+
+MpReturnCode mp_WarmGraph__WaitUntilDone(mp_api::WarmGraph* warm_graph, absl::Status** status_out) {
+  TRY
+    *status_out = new absl::Status{warm_graph->WaitUntilDone()};
+    RETURN_CODE(MpReturnCode::Success);
+  CATCH_EXCEPTION
+}
+
+bool mp_WarmGraph__HasError(mp_api::WarmGraph* warm_graph) { return warm_graph->HasError(); }
@@ -0,0 +1,157 @@
+// Copyright (c) 2026 homuler
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+#ifndef MEDIAPIPE_API_FRAMEWORK_WARM_GRAPH_POOL_H_
+#define MEDIAPIPE_API_FRAMEWORK_WARM_GRAPH_POOL_H_
+
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
+#include "absl/status/statusor.h"
+#include "absl/synchronization/mutex.h"
+#include "absl/time/time.h"
+#include "mediapipe/framework/calculator_graph.h"
+#include "mediapipe_api/common.h"
+#include "mediapipe_api/external/absl/status.h"
+#include "mediapipe_api/framework/calculator_graph.h"
+#include "mediapipe_api/tasks/cc/core/shared_model_cache.h"
+
+namespace mp_api {
+
+// A graph that has been started and has processed the warmup inputs, so the models are loaded and the delegates are initialized.
+class WarmGraph {
+ public:
+  using PacketCallback = std::function<absl::Status(const mediapipe::Packet&)>;
+
+  // Cancels the graph if it's still running.
+  ~WarmGraph();
+
+  // Passes the packets of `stream_name` to `callback` from now on.
+  // `stream_name` must be one of the output streams observed by the pool, since the graph is already running.
+  absl::Status ObserveOutputStream(const std::string& stream_name, PacketCallback callback);
+
+  absl::Status AddPacketToInputStream(const std::string& stream_name, mediapipe::Packet packet);
+  absl::Status CloseInputStream(const std::string& stream_name);
+  absl::Status CloseAllPacketSources();
+  absl::Status WaitUntilIdle();
+  absl::Status WaitUntilDone();
+  bool HasError() const;
+
+  mediapipe::CalculatorGraph& graph() { return *graph_; }
+
+ private:
+  friend class WarmGraphPool;
+
+  // Forwards the output packets to the callbacks. The packets are discarded until a callback is set, i.e. during the warmup.
+  struct OutputRouter {
+    absl::Status Dispatch(const std::string& stream_name, const mediapipe::Packet& packet);
+
+    absl::Mutex mutex;
+    absl::flat_hash_map<std::string, PacketCallback> callbacks ABSL_GUARDED_BY(mutex);
+  };
+
+  WarmGraph() = default;
+
+  // NOTE: the model assets must outlive the graph, so declare them first.
+  std::vector<SharedModelCache::Handle> model_assets_;
+  // NOTE: the observers of the graph refer to the router, so it must outlive the graph.
+  std::shared_ptr<OutputRouter> router_ = std::make_shared<OutputRouter>();
+  std::vector<std::string> output_streams_;
+  std::unique_ptr<mediapipe::CalculatorGraph> graph_;
+  bool running_ = false;
+};
+
+// Prepares graphs of the same config in the background, so that a new stream (e.g. after a scene switch) can start at the steady-state latency.
+//
+// Each graph is initialized, started, and fed the warmup inputs, whose outputs are discarded.
+// Since the warmup inputs are sent at `warmup_timestamp`, the packets sent to an acquired graph must have greater timestamps.
+//
+// NOTE: the graph is not reset after the warmup, so the stateful calculators keep the state of the warmup inputs
+// (e.g. the previous landmarks of a tracking loop, or the history of a smoothing filter).
+// Use the inputs that leave no state (e.g. a blank image, in which nothing is detected), or don't use the pool for such graphs.
+//
+// If a graph fails to be prepared, the pool retries with an exponential backoff until it's destroyed.
+class WarmGraphPool {
+ public:
+  // The delay before the first retry, which doubles after each failure up to kMaxRetryDelay.
+  static constexpr absl::Duration kMinRetryDelay = absl::Milliseconds(100);
+  static constexpr absl::Duration kMaxRetryDelay = absl::Seconds(10);
+
+  struct Options {
+    // The number of the graphs kept ready.
+    int size = 1;
+    // The output streams that can be observed after the graph is acquired. If empty, the graph output streams of the config are used.
+    std::vector<std::string> output_streams;
+    // The packets sent to the graph input streams to run the first inference.
+    std::map<std::string, mediapipe::Packet> warmup_inputs;
+    mediapipe::Timestamp warmup_timestamp = mediapipe::Timestamp(0);
+    std::map<std::string, mediapipe::Packet> side_packets;
+  };
+
+  static absl::StatusOr<std::unique_ptr<WarmGraphPool>> Create(mediapipe::CalculatorGraphConfig config, Options options);
+
+  // Stops preparing graphs. The graphs that have not been acquired are cancelled.
+  ~WarmGraphPool();
+
+  // Returns a ready graph, waiting for one if there's none, and starts preparing another one.
+  // If there's none and the last attempt to prepare a graph has failed, returns the error without waiting.
+  absl::StatusOr<std::unique_ptr<WarmGraph>> Acquire();
+
+  // The number of the graphs that can be acquired without waiting.
+  int ready_count() const;
+
+ private:
+  WarmGraphPool(mediapipe::CalculatorGraphConfig config, Options options, std::vector<SharedModelCache::Handle> model_assets);
+
+  void RunLoop();
+  absl::StatusOr<std::unique_ptr<WarmGraph>> Prepare() const;
+
+  const mediapipe::CalculatorGraphConfig config_;
+  const Options options_;
+  const std::vector<SharedModelCache::Handle> model_assets_;
+
+  mutable absl::Mutex mutex_;
+  std::deque<std::unique_ptr<WarmGraph>> ready_graphs_ ABSL_GUARDED_BY(mutex_);
+  // The error of the last attempt to prepare a graph, which is cleared when a graph is prepared.
+  absl::Status error_ ABSL_GUARDED_BY(mutex_);
+  bool stopped_ ABSL_GUARDED_BY(mutex_) = false;
+  std::thread thread_;
+};
+
+}  // namespace mp_api
+
+extern "C" {
+
+MP_CAPI(MpReturnCode) mp_WarmGraphPool_Create__PKc_i_i_PPKc_i_Rsp_ll_Rsp(const char* serialized_config, int size, int pool_size, const char** output_streams,
+                                                                        int output_stream_count, SidePackets* warmup_inputs, int64_t warmup_timestamp_us,
+                                                                        SidePackets* side_packets, absl::Status** status_out,
+                                                                        mp_api::WarmGraphPool** warm_graph_pool_out);
+MP_CAPI(void) mp_WarmGraphPool__delete(mp_api::WarmGraphPool* warm_graph_pool);
+MP_CAPI(MpReturnCode) mp_WarmGraphPool__Acquire(mp_api::WarmGraphPool* warm_graph_pool, absl::Status** status_out, mp_api::WarmGraph** warm_graph_out);
+MP_CAPI(int) mp_WarmGraphPool__ready_count(mp_api::WarmGraphPool* warm_graph_pool);
+
+MP_CAPI(void) mp_WarmGraph__delete(mp_api::WarmGraph* warm_graph);
+MP_CAPI(MpReturnCode) mp_WarmGraph__ObserveOutputStream__PKc_i_PF(mp_api::WarmGraph* warm_graph, const char* stream_name, int stream_id,
+                                                                  NativePacketCallback* packet_callback, absl::Status** status_out);
+MP_CAPI(MpReturnCode) mp_WarmGraph__AddPacketToInputStream__PKc_Ppacket(mp_api::WarmGraph* warm_graph, const char* stream_name, mediapipe::Packet* packet,
+                                                                        absl::Status** status_out);
+MP_CAPI(MpReturnCode) mp_WarmGraph__CloseInputStream__PKc(mp_api::WarmGraph* warm_graph, const char* stream_name, absl::Status** status_out);
+MP_CAPI(MpReturnCode) mp_WarmGraph__CloseAllPacketSources(mp_api::WarmGraph* warm_graph, absl::Status** status_out);
+MP_CAPI(MpReturnCode) mp_WarmGraph__WaitUntilIdle(mp_api::WarmGraph* warm_graph, absl::Status** status_out);
+MP_CAPI(MpReturnCode) mp_WarmGraph__WaitUntilDone(mp_api::WarmGraph* warm_graph, absl::Status** status_out);
+MP_CAPI(bool) mp_WarmGraph__HasError(mp_api::WarmGraph* warm_graph);
+
+}  // extern "C"
+
+#endif  // MEDIAPIPE_API_FRAMEWORK_WARM_GRAPH_POOL_H_
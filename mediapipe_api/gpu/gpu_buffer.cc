@@ -48,10 +48,14 @@ MpReturnCode mp__MakeGpuBufferPacket_At__Rgb_ll(mediapipe::GpuBuffer* gpu_buffer
 }
 
 MpReturnCode mp_Packet__ConsumeGpuBuffer(mediapipe::Packet* packet, absl::Status** status_out, mediapipe::GpuBuffer** value_out) {
+  MP_CAPI_NAMED_SPAN("mp_Packet__ConsumeGpuBuffer");
   return mp_Packet__Consume(packet, status_out, value_out);
 }
 
-MpReturnCode mp_Packet__GetGpuBuffer(mediapipe::Packet* packet, const mediapipe::GpuBuffer** value_out) { return mp_Packet__Get(packet, value_out); }
+MpReturnCode mp_Packet__GetGpuBuffer(mediapipe::Packet* packet, const mediapipe::GpuBuffer** value_out) {
+  MP_CAPI_NAMED_SPAN("mp_Packet__GetGpuBuffer");
+  return mp_Packet__Get(packet, value_out);
+}
 
 MpReturnCode mp_Packet__ValidateAsGpuBuffer(mediapipe::Packet* packet, absl::Status** status_out) {
   TRY
@@ -6,7 +6,8 @@
 
 """Asset Packager
 
-Macros to zip dependent assets (e.g. *.tflite) in a format compatible with Unity.
+Macros to zip dependent assets (e.g. *.tflite) in a format compatible with Unity,
+or to pack them into a single bundle that can be memory-mapped.
 """
 
 load("@rules_pkg//:pkg.bzl", "pkg_zip")
@@ -70,3 +71,43 @@ _normalize_exts = rule(
         "txt_exts": attr.string_list(default = ["pbtxt"]),
     },
 )
+
+def _pkg_asset_bundle_impl(ctx):
+    output = ctx.actions.declare_file(ctx.label.name + ".bin")
+
+    args = ctx.actions.args()
+    args.add("--output", output)
+    args.add("--alignment", ctx.attr.alignment)
+    args.add_all(ctx.attr.compress, before_each = "--compress")
+    args.add_all(ctx.files.srcs)
+
+    ctx.actions.run(
+        inputs = ctx.files.srcs,
+        outputs = [output],
+        executable = ctx.executable._packer,
+        arguments = [args],
+        mnemonic = "PackAssetBundle",
+        progress_message = "Packing assets into {}...".format(output.short_path),
+    )
+
+    return [
+        DefaultInfo(files = depset([output])),
+    ]
+
+pkg_asset_bundle = rule(
+    implementation = _pkg_asset_bundle_impl,
+    doc = """Packs assets into <name>.bin, which can be loaded by ResourceUtil.SetAssetBundle.
+
+    The assets are looked up by their base names (e.g. face_detection_short_range.tflite).
+    """,
+    attrs = {
+        "srcs": attr.label_list(allow_files = True),
+        "compress": attr.string_list(doc = "The patterns of the asset names to be compressed (e.g. *.txt)"),
+        "alignment": attr.int(default = 64, doc = "The alignment of the asset contents, which must be a power of 2"),
+        "_packer": attr.label(
+            default = "//mediapipe_api:pack_asset_bundle",
+            executable = True,
+            cfg = "exec",
+        ),
+    },
+)
@@ -0,0 +1,138 @@
+# Copyright (c) 2026 homuler
+#
+# Use of this source code is governed by an MIT-style
+# license that can be found in the LICENSE file or at
+# https://opensource.org/licenses/MIT.
+
+"""Packs assets into a single bundle that can be memory-mapped and looked up by name in O(1).
+
+The layout (little endian) must be kept in sync with mediapipe_api/util/asset_bundle.cc.
+
+  header:  magic "MPAB", u32 version, u32 entry_count, u32 bucket_count, u32 alignment, u32 reserved,
+           u64 buckets_offset, u64 entries_offset, u64 names_offset, u64 names_size
+  buckets: u32[bucket_count], the entry index + 1 (0 if empty), probed linearly from hash & (bucket_count - 1)
+  entries: {u64 hash, u32 name_offset, u32 name_size, u64 data_offset, u64 stored_size, u64 size, u32 compression, u32 reserved}[entry_count]
+  names:   the entry names (UTF-8), which are the base names of the input files
+  data:    the entry contents, each aligned to --alignment bytes relative to the start of the bundle
+"""
+
+import argparse
+import fnmatch
+import os
+import struct
+import sys
+import zlib
+
+_MAGIC = b'MPAB'
+_VERSION = 2
+_HEADER_FORMAT = '<4sIIIII4Q'
+_ENTRY_FORMAT = '<QIIQQQII'
+
+_COMPRESSION_NONE = 0
+_COMPRESSION_ZLIB = 1
+
+
+def fingerprint(name):
+  """FNV-1a 64, which must be the same as mp_api::Fingerprint in mediapipe_api/util/cache_file_util.cc"""
+  h = 14695981039346656037
+  for c in name:
+    h ^= c
+    h = (h * 1099511628211) & 0xFFFFFFFFFFFFFFFF
+  return h
+
+
+def align(offset, alignment):
+  return (offset + alignment - 1) // alignment * alignment
+
+
+def collect_entries(paths):
+  entries = {}
+  for path in paths:
+    name = os.path.basename(path)
+    with open(path, 'rb') as f:
+      data = f.read()
+
+    if name in entries:
+      # the same asset can be included by multiple solutions
+      if entries[name] != data:
+        raise ValueError(f'{name} is found more than once with different contents')
+      continue
+    entries[name] = data
+  return entries
+
+
+def pack(paths, output, alignment, compress_patterns, compression_level):
+  entries = collect_entries(paths)
+  names = sorted(entries.keys())
+
+  bucket_count = 1
+  while bucket_count < 2 * len(names):
+    bucket_count *= 2
+
+  buckets = [0] * bucket_count
+  encoded_names = [name.encode('utf-8') for name in names]
+  for index, encoded_name in enumerate(encoded_names):
+    bucket = fingerprint(encoded_name) & (bucket_count - 1)
+    while buckets[bucket] != 0:
+      bucket = (bucket + 1) & (bucket_count - 1)
+    buckets[bucket] = index + 1
+
+  header_size = struct.calcsize(_HEADER_FORMAT)
+  entry_size = struct.calcsize(_ENTRY_FORMAT)
+  buckets_offset = header_size
+  entries_offset = buckets_offset + 4 * bucket_count
+  names_offset = entries_offset + entry_size * len(names)
+  names_blob = b''.join(encoded_names)
+
+  data_offset = align(names_offset + len(names_blob), alignment)
+  records = []
+  blobs = []
+  name_offset = 0
+  for name, encoded_name in zip(names, encoded_names):
+    data = entries[name]
+    compression = _COMPRESSION_NONE
+    stored = data
+    if any(fnmatch.fnmatch(name, pattern) for pattern in compress_patterns):
+      compressed = zlib.compress(data, compression_level)
+      # keep it uncompressed if it does not shrink, since it can be mapped without being copied
+      if len(compressed) < len(data):
+        compression = _COMPRESSION_ZLIB
+        stored = compressed
+
+    records.append(struct.pack(_ENTRY_FORMAT, fingerprint(encoded_name), name_offset, len(encoded_name), data_offset, len(stored), len(data), compression, 0))
+    blobs.append((data_offset, stored))
+    name_offset += len(encoded_name)
+    data_offset = align(data_offset + len(stored), alignment)
+
+  with open(output, 'wb') as f:
+    f.write(struct.pack(_HEADER_FORMAT, _MAGIC, _VERSION, len(names), bucket_count, alignment, 0, buckets_offset, entries_offset, names_offset, len(names_blob)))
+    f.write(struct.pack(f'<{bucket_count}I', *buckets))
+    f.write(b''.join(records))
+    f.write(names_blob)
+    for offset, stored in blobs:
+      f.write(b'\0' * (offset - f.tell()))
+      f.write(stored)
+
+
+def main():
+  parser = argparse.ArgumentParser(description='Pack assets into a bundle')
+  parser.add_argument('--output', '-o', required=True)
+  parser.add_argument('--alignment', type=int, default=64, help='The alignment of the entry contents, which must be a power of 2')
+  parser.add_argument('--compress', action='append', default=[], help='The pattern of the entry names to be compressed (e.g. *.txt)')
+  parser.add_argument('--compression_level', type=int, default=9, choices=range(0, 10))
+  parser.add_argument('srcs', nargs='*')
+  args = parser.parse_args()
+
+  if args.alignment <= 0 or args.alignment & (args.alignment - 1) != 0:
+    parser.error(f'--alignment must be a power of 2, but got {args.alignment}')
+
+  try:
+    pack(args.srcs, args.output, args.alignment, args.compress, args.compression_level)
+  except ValueError as e:
+    print(e, file=sys.stderr)
+    return 1
+  return 0
+
+
+if __name__ == '__main__':
+  sys.exit(main())
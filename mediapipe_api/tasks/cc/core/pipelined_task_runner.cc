@@ -0,0 +1,388 @@
+// Copyright (c) 2026 homuler
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+#include "mediapipe_api/tasks/cc/core/pipelined_task_runner.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "absl/memory/memory.h"
+#include "absl/strings/str_cat.h"
+#include "mediapipe/framework/port/status_macros.h"
+#include "mediapipe/tasks/cc/core/mediapipe_builtin_op_resolver.h"
+#include "mediapipe_api/tasks/cc/core/shared_model_cache.h"
+
+namespace mp_api {
+
+namespace {
+
+absl::Status ValidateMaxInFlight(int max_in_flight) {
+  if (max_in_flight <= 0) {
+    return absl::InvalidArgumentError(absl::StrCat("max_in_flight must be positive, but got ", max_in_flight));
+  }
+  return absl::OkStatus();
+}
+
+// Returns the timestamp of the packets, ignoring the empty ones.
+mediapipe::Timestamp GetTimestamp(const PacketMap& packets) {
+  auto timestamp = mediapipe::Timestamp::Unset();
+  for (const auto& [_, packet] : packets) {
+    if (!packet.IsEmpty() && (timestamp == mediapipe::Timestamp::Unset() || packet.Timestamp() > timestamp)) {
+      timestamp = packet.Timestamp();
+    }
+  }
+  return timestamp;
+}
+
+}  // namespace
+
+absl::StatusOr<std::unique_ptr<PipelinedTaskRunner>> PipelinedTaskRunner::Create(mediapipe::CalculatorGraphConfig config, int max_in_flight,
+                                                                                  std::shared_ptr<mediapipe::Executor> executor) {
+  MP_RETURN_IF_ERROR(ValidateMaxInFlight(max_in_flight));
+  auto runner = absl::WrapUnique(new PipelinedTaskRunner(max_in_flight));
+  MP_ASSIGN_OR_RETURN(runner->task_runner_, TaskRunner::Create(std::move(config),
+                                                               absl::make_unique<mediapipe::tasks::core::MediaPipeBuiltinOpResolver>(),
+                                                               runner->BuildPacketsCallback(), std::move(executor)));
+  return runner;
+}
+
+#if !MEDIAPIPE_DISABLE_GPU
+absl::StatusOr<std::unique_ptr<PipelinedTaskRunner>> PipelinedTaskRunner::Create(mediapipe::CalculatorGraphConfig config, int max_in_flight,
+                                                                                  std::shared_ptr<mediapipe::GpuResources> gpu_resources,
+                                                                                  std::shared_ptr<mediapipe::Executor> executor) {
+  MP_RETURN_IF_ERROR(ValidateMaxInFlight(max_in_flight));
+  auto runner = absl::WrapUnique(new PipelinedTaskRunner(max_in_flight));
+  MP_ASSIGN_OR_RETURN(runner->task_runner_, TaskRunner::Create(std::move(config),
+                                                               absl::make_unique<mediapipe::tasks::core::MediaPipeBuiltinOpResolver>(),
+                                                               runner->BuildPacketsCallback(),
+                                                               std::move(executor),
+                                                               /* input_side_packes= */ std::nullopt, std::move(gpu_resources)));
+  return runner;
+}
+#endif  // !MEDIAPIPE_DISABLE_GPU
+
+mediapipe::tasks::core::PacketsCallback PipelinedTaskRunner::BuildPacketsCallback() {
+  return [this](absl::StatusOr<PacketMap> status_or_packets) -> void { OnPackets(std::move(status_or_packets)); };
+}
+
+absl::StatusOr<int64_t> PipelinedTaskRunner::TrySend(PacketMap& inputs) {
+  const auto timestamp = GetTimestamp(inputs);
+  if (timestamp == mediapipe::Timestamp::Unset()) {
+    return absl::InvalidArgumentError("The inputs must contain at least one packet with a timestamp");
+  }
+
+  int64_t ticket;
+  {
+    absl::MutexLock lock(&mutex_);
+    if (pending_.size() >= static_cast<size_t>(max_in_flight_)) {
+      return kWouldBlock;
+    }
+    ticket = next_ticket_++;
+    // NOTE: register the ticket before sending the inputs, since the result can be emitted before Send returns.
+    pending_.push_back(Pending{ticket, timestamp});
+  }
+
+  auto status = task_runner_->Send(std::move(inputs));
+  inputs.clear();
+  if (!status.ok()) {
+    absl::MutexLock lock(&mutex_);
+    for (auto it = pending_.begin(); it != pending_.end(); ++it) {
+      if (it->ticket == ticket) {
+        pending_.erase(it);
+        break;
+      }
+    }
+    return status;
+  }
+  return ticket;
+}
+
+bool PipelinedTaskRunner::TryPop(int64_t ticket, absl::Duration timeout, Result* result) {
+  absl::MutexLock lock(&mutex_);
+  auto is_done = [this, ticket]() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mutex_) {
+    if (completed_.count(ticket) > 0) {
+      return true;
+    }
+    // Stop waiting if the ticket is unknown.
+    for (const auto& pending : pending_) {
+      if (pending.ticket == ticket) {
+        return false;
+      }
+    }
+    return true;
+  };
+  mutex_.AwaitWithTimeout(absl::Condition(&is_done), timeout);
+
+  auto it = completed_.find(ticket);
+  if (it == completed_.end()) {
+    return false;
+  }
+  *result = std::move(it->second);
+  completed_.erase(it);
+  return true;
+}
+
+bool PipelinedTaskRunner::TryPopNext(absl::Duration timeout, Result* result) {
+  absl::MutexLock lock(&mutex_);
+  auto is_done = [this]() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mutex_) { return !completed_.empty() || pending_.empty(); };
+  mutex_.AwaitWithTimeout(absl::Condition(&is_done), timeout);
+
+  if (completed_.empty()) {
+    return false;
+  }
+  auto it = completed_.begin();
+  *result = std::move(it->second);
+  completed_.erase(it);
+  return true;
+}
+
+absl::StatusOr<std::vector<PipelinedTaskRunner::Result>> PipelinedTaskRunner::ProcessBatch(std::vector<PacketMap> inputs, absl::Duration timeout) {
+  const auto deadline = absl::Now() + timeout;
+  std::vector<int64_t> tickets;
+  tickets.reserve(inputs.size());
+
+  for (auto& input : inputs) {
+    bool has_room;
+    {
+      absl::MutexLock lock(&mutex_);
+      auto is_not_full = [this]() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mutex_) { return pending_.size() < static_cast<size_t>(max_in_flight_); };
+      has_room = mutex_.AwaitWithDeadline(absl::Condition(&is_not_full), deadline);
+    }
+    if (!has_room) {
+      Discard(tickets);
+      return absl::DeadlineExceededError("Timed out while waiting for the pipeline to have room");
+    }
+    auto ticket = TrySend(input);
+    if (!ticket.ok() || *ticket == kWouldBlock) {
+      Discard(tickets);
+      return ticket.ok() ? absl::FailedPreconditionError("Other thread is sending inputs concurrently") : ticket.status();
+    }
+    tickets.push_back(*ticket);
+  }
+
+  std::vector<Result> results(tickets.size());
+  for (size_t i = 0; i < tickets.size(); ++i) {
+    if (!TryPop(tickets[i], std::max(deadline - absl::Now(), absl::ZeroDuration()), &results[i])) {
+      Discard(std::vector<int64_t>(tickets.begin() + i, tickets.end()));
+      return absl::DeadlineExceededError(absl::StrCat("Timed out while waiting for the result of the frame ", i));
+    }
+  }
+  return results;
+}
+
+int PipelinedTaskRunner::in_flight_count() const {
+  absl::MutexLock lock(&mutex_);
+  return static_cast<int>(pending_.size());
+}
+
+int PipelinedTaskRunner::completed_count() const {
+  absl::MutexLock lock(&mutex_);
+  return static_cast<int>(completed_.size());
+}
+
+absl::Status PipelinedTaskRunner::Close() {
+  auto status = task_runner_->Close();
+
+  absl::MutexLock lock(&mutex_);
+  CompleteAllPending(absl::UnavailableError("The graph is closed before the result is emitted"));
+  return status;
+}
+
+void PipelinedTaskRunner::OnPackets(absl::StatusOr<PacketMap> status_or_packets) {
+  absl::MutexLock lock(&mutex_);
+  if (pending_.empty()) {
+    // NOTE: an unexpected output (e.g. emitted by a calculator that doesn't respect the input timestamp), so there's no ticket to complete.
+    return;
+  }
+
+  if (!status_or_packets.ok()) {
+    auto ticket = pending_.front().ticket;
+    pending_.pop_front();
+    Complete(ticket, std::move(status_or_packets).status(), {});
+    return;
+  }
+
+  const auto timestamp = GetTimestamp(*status_or_packets);
+  // The outputs are emitted in the timestamp order, so the older inputs whose outputs are not emitted have been dropped.
+  while (timestamp != mediapipe::Timestamp::Unset() && pending_.size() > 1 && pending_.front().timestamp < timestamp) {
+    auto ticket = pending_.front().ticket;
+    pending_.pop_front();
+    Complete(ticket, absl::UnavailableError("The input is dropped by the graph"), {});
+  }
+  auto ticket = pending_.front().ticket;
+  pending_.pop_front();
+  Complete(ticket, absl::OkStatus(), std::move(status_or_packets).value());
+}
+
+void PipelinedTaskRunner::Complete(int64_t ticket, absl::Status status, PacketMap packets) {
+  if (discarded_.erase(ticket) > 0) {
+    return;
+  }
+  completed_[ticket] = Result{ticket, std::move(status), std::move(packets)};
+}
+
+void PipelinedTaskRunner::Discard(const std::vector<int64_t>& tickets) {
+  absl::MutexLock lock(&mutex_);
+  for (auto ticket : tickets) {
+    if (completed_.erase(ticket) == 0) {
+      discarded_.insert(ticket);
+    }
+  }
+}
+
+void PipelinedTaskRunner::CompleteAllPending(const absl::Status& status) {
+  while (!pending_.empty()) {
+    Complete(pending_.front().ticket, status, {});
+    pending_.pop_front();
+  }
+}
+
+}  // namespace mp_api
+
+namespace {
+
+void ExportResult(PipelinedTaskRunner::Result&& result, absl::Status** status_out, PacketMap** value_out) {
+  if (result.status.ok()) {
+    *value_out = new PacketMap{std::move(result.packets)};
+  } else {
+    *value_out = nullptr;
+  }
+  *status_out = new absl::Status{std::move(result.status)};
+}
+
+}  // namespace
+
+#if !MEDIAPIPE_DISABLE_GPU
+MpReturnCode mp_tasks_core_PipelinedTaskRunner_Create__PKc_i_i_Pgr_Pe(const char* serialized_config, int size, int max_in_flight,
+                                                                      std::shared_ptr<mediapipe::GpuResources>* gpu_resources,
+                                                                      std::shared_ptr<mediapipe::Executor>* executor,
+                                                                      absl::Status** status_out, PipelinedTaskRunner** task_runner_out) {
+  TRY
+    auto config = ParseFromStringAsProto<mediapipe::CalculatorGraphConfig>(serialized_config, size);
+    auto model_assets = mp_api::SharedModelCache::GetInstance().ShareModelAssets(config);
+    auto status_or_task_runner = PipelinedTaskRunner::Create(std::move(config), max_in_flight, gpu_resources == nullptr ? nullptr : *gpu_resources,
+                                                             executor == nullptr ? nullptr : *executor);
+
+    *status_out = new absl::Status{status_or_task_runner.status()};
+    if (status_or_task_runner.ok()) {
+      *task_runner_out = status_or_task_runner.value().release();
+      mp_api::SharedModelCache::GetInstance().Retain(*task_runner_out, std::move(model_assets));
+    } else {
+      *task_runner_out = nullptr;
+    }
+    RETURN_CODE(MpReturnCode::Success);
+  CATCH_EXCEPTION
+}
+#endif  // !MEDIAPIPE_DISABLE_GPU
+
+MpReturnCode mp_tasks_core_PipelinedTaskRunner_Create__PKc_i_i_Pe(const char* serialized_config, int size, int max_in_flight,
+                                                                  std::shared_ptr<mediapipe::Executor>* executor,
+                                                                  absl::Status** status_out, PipelinedTaskRunner** task_runner_out) {
+  TRY
+    auto config = ParseFromStringAsProto<mediapipe::CalculatorGraphConfig>(serialized_config, size);
+    auto model_assets = mp_api::SharedModelCache::GetInstance().ShareModelAssets(config);
+    auto status_or_task_runner = PipelinedTaskRunner::Create(std::move(config), max_in_flight, executor == nullptr ? nullptr : *executor);
+
+    *status_out = new absl::Status{status_or_task_runner.status()};
+    if (status_or_task_runner.ok()) {
+      *task_runner_out = status_or_task_runner.value().release();
+      mp_api::SharedModelCache::GetInstance().Retain(*task_runner_out, std::move(model_assets));
+    } else {
+      *task_runner_out = nullptr;
+    }
+    RETURN_CODE(MpReturnCode::Success);
+  CATCH_EXCEPTION
+}
+
+void mp_tasks_core_PipelinedTaskRunner__delete(PipelinedTaskRunner* task_runner) {
+  // NOTE: the model assets must outlive the graph.
+  auto model_assets = mp_api::SharedModelCache::GetInstance().Release(task_runner);
+  delete task_runner;
+}
+
+MpReturnCode mp_tasks_core_PipelinedTaskRunner__TrySend__Ppm(PipelinedTaskRunner* task_runner, PacketMap* inputs,
+                                                             absl::Status** status_out, int64_t* ticket_out) {
+  TRY
+    auto status_or_ticket = task_runner->TrySend(*inputs);
+    *status_out = new absl::Status{status_or_ticket.status()};
+    *ticket_out = status_or_ticket.ok() ? status_or_ticket.value() : PipelinedTaskRunner::kWouldBlock;
+    RETURN_CODE(MpReturnCode::Success);
+  CATCH_EXCEPTION
+}
+
+MpReturnCode mp_tasks_core_PipelinedTaskRunner__TryPop__ll_i(PipelinedTaskRunner* task_runner, int64_t ticket, int timeout_ms,
+                                                             bool* found_out, absl::Status** status_out, PacketMap** value_out) {
+  TRY
+    PipelinedTaskRunner::Result result;
+    *found_out = task_runner->TryPop(ticket, absl::Milliseconds(timeout_ms), &result);
+    if (*found_out) {
+      ExportResult(std::move(result), status_out, value_out);
+    } else {
+      *status_out = nullptr;
+      *value_out = nullptr;
+    }
+    RETURN_CODE(MpReturnCode::Success);
+  CATCH_EXCEPTION
+}
+
+MpReturnCode mp_tasks_core_PipelinedTaskRunner__TryPopNext__i(PipelinedTaskRunner* task_runner, int timeout_ms, bool* found_out,
+                                                              int64_t* ticket_out, absl::Status** status_out, PacketMap** value_out) {
+  TRY
+    PipelinedTaskRunner::Result result;
+    *found_out = task_runner->TryPopNext(absl::Milliseconds(timeout_ms), &result);
+    if (*found_out) {
+      *ticket_out = result.ticket;
+      ExportResult(std::move(result), status_out, value_out);
+    } else {
+      *ticket_out = PipelinedTaskRunner::kWouldBlock;
+      *status_out = nullptr;
+      *value_out = nullptr;
+    }
+    RETURN_CODE(MpReturnCode::Success);
+  CATCH_EXCEPTION
+}
+
+MpReturnCode mp_tasks_core_PipelinedTaskRunner__ProcessBatch__PPpm_i_i(PipelinedTaskRunner* task_runner, PacketMap** inputs, int size,
+                                                                       int timeout_ms, absl::Status** status_out, PacketMap** values_out) {
+  TRY
+    std::vector<PacketMap> batch;
+    batch.reserve(size);
+    for (auto i = 0; i < size; ++i) {
+      batch.push_back(std::move(*inputs[i]));
+      inputs[i]->clear();
+      values_out[i] = nullptr;
+    }
+
+    auto status_or_results = task_runner->ProcessBatch(std::move(batch), absl::Milliseconds(timeout_ms));
+    if (!status_or_results.ok()) {
+      *status_out = new absl::Status{status_or_results.status()};
+    } else {
+      auto status = absl::OkStatus();
+      auto& results = *status_or_results;
+      for (auto i = 0; i < size; ++i) {
+        if (results[i].status.ok()) {
+          values_out[i] = new PacketMap{std::move(results[i].packets)};
+        } else if (status.ok() || (absl::IsUnavailable(status) && !absl::IsUnavailable(results[i].status))) {
+          // NOTE: prefer the actual errors to kUnavailable, which just means that the frame is dropped.
+          status = std::move(results[i].status);
+        }
+      }
+      *status_out = new absl::Status{std::move(status)};
+    }
+    RETURN_CODE(MpReturnCode::Success);
+  CATCH_EXCEPTION
+}
+
+int mp_tasks_core_PipelinedTaskRunner__in_flight_count(PipelinedTaskRunner* task_runner) { return task_runner->in_flight_count(); }
+
+int mp_tasks_core_PipelinedTaskRunner__completed_count(PipelinedTaskRunner* task_runner) { return task_runner->completed_count(); }
+
+MpReturnCode mp_tasks_core_PipelinedTaskRunner__Close(PipelinedTaskRunner* task_runner, absl::Status** status_out) {
+  TRY
+    *status_out = new absl::Status{task_runner->Close()};
+    RETURN_CODE(MpReturnCode::Success);
+  CATCH_EXCEPTION
+}
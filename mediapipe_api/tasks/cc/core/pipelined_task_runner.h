@@ -0,0 +1,146 @@
+// Copyright (c) 2026 homuler
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+#ifndef MEDIAPIPE_API_TASKS_CC_CORE_PIPELINED_TASK_RUNNER_H_
+#define MEDIAPIPE_API_TASKS_CC_CORE_PIPELINED_TASK_RUNNER_H_
+
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <memory>
+#include <vector>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_set.h"
+#include "absl/status/statusor.h"
+#include "absl/synchronization/mutex.h"
+#include "absl/time/time.h"
+#include "mediapipe/tasks/cc/core/task_runner.h"
+#include "mediapipe_api/common.h"
+#include "mediapipe_api/tasks/cc/core/task_runner.h"
+
+namespace mp_api {
+
+// Runs a TaskRunner in the live stream mode, limiting the number of inputs in flight.
+// Each accepted input is given a ticket, and its result is stored in the completion queue until the caller takes it,
+// so that the caller doesn't need to handle the results on the graph thread.
+//
+// The results are matched with the tickets by the input timestamp, so every input map must contain at least one packet
+// with a timestamp. If the graph drops an input (e.g. by FlowLimiterCalculator), its ticket completes with kUnavailable.
+// TrySend is expected to be called from a single thread, while the results can be taken from any thread.
+class PipelinedTaskRunner {
+ public:
+  static constexpr int64_t kWouldBlock = -1;
+
+  struct Result {
+    int64_t ticket;
+    absl::Status status;
+    PacketMap packets;
+  };
+
+  // If `executor` is null, the graph creates its own thread pool.
+  static absl::StatusOr<std::unique_ptr<PipelinedTaskRunner>> Create(mediapipe::CalculatorGraphConfig config, int max_in_flight,
+                                                                     std::shared_ptr<mediapipe::Executor> executor = nullptr);
+#if !MEDIAPIPE_DISABLE_GPU
+  static absl::StatusOr<std::unique_ptr<PipelinedTaskRunner>> Create(mediapipe::CalculatorGraphConfig config, int max_in_flight,
+                                                                     std::shared_ptr<mediapipe::GpuResources> gpu_resources,
+                                                                     std::shared_ptr<mediapipe::Executor> executor = nullptr);
+#endif  // !MEDIAPIPE_DISABLE_GPU
+
+  // Sends `inputs` to the graph and returns the ticket for the result.
+  // If `max_in_flight` inputs are already in flight, returns kWouldBlock without touching `inputs`.
+  // Otherwise, `inputs` is moved.
+  absl::StatusOr<int64_t> TrySend(PacketMap& inputs);
+
+  // Takes the result of `ticket`, waiting at most `timeout` until it completes.
+  // Returns false if the result is not available (yet).
+  bool TryPop(int64_t ticket, absl::Duration timeout, Result* result);
+
+  // Takes the result with the smallest ticket among the completed ones, waiting at most `timeout` until any completes.
+  bool TryPopNext(absl::Duration timeout, Result* result);
+
+  // Sends all the `inputs` in order, waiting for a free slot when the pipeline is full, and returns their results in the same order.
+  // The frames are processed concurrently up to `max_in_flight`, so the calculators can work on different frames at the same time.
+  // Returns kDeadlineExceeded if the results are not emitted within `timeout`. The results that arrive later are discarded.
+  absl::StatusOr<std::vector<Result>> ProcessBatch(std::vector<PacketMap> inputs, absl::Duration timeout);
+
+  int in_flight_count() const;
+  int completed_count() const;
+
+  // Closes the graph after the inputs in flight are processed.
+  // The tickets whose results are not emitted complete with kUnavailable.
+  absl::Status Close();
+
+ private:
+  struct Pending {
+    int64_t ticket;
+    mediapipe::Timestamp timestamp;
+  };
+
+  explicit PipelinedTaskRunner(int max_in_flight) : max_in_flight_(max_in_flight) {}
+
+  mediapipe::tasks::core::PacketsCallback BuildPacketsCallback();
+
+  void OnPackets(absl::StatusOr<PacketMap> status_or_packets);
+  void Complete(int64_t ticket, absl::Status status, PacketMap packets) ABSL_EXCLUSIVE_LOCKS_REQUIRED(mutex_);
+  void CompleteAllPending(const absl::Status& status) ABSL_EXCLUSIVE_LOCKS_REQUIRED(mutex_);
+  void Discard(const std::vector<int64_t>& tickets);
+
+  const int max_in_flight_;
+
+  mutable absl::Mutex mutex_;
+  int64_t next_ticket_ ABSL_GUARDED_BY(mutex_) = 0;
+  std::deque<Pending> pending_ ABSL_GUARDED_BY(mutex_);
+  std::map<int64_t, Result> completed_ ABSL_GUARDED_BY(mutex_);
+  // The tickets whose results are not needed anymore.
+  absl::flat_hash_set<int64_t> discarded_ ABSL_GUARDED_BY(mutex_);
+
+  // NOTE: declared last so that it's destroyed first, since the callback may be called while closing the graph.
+  std::unique_ptr<TaskRunner> task_runner_;
+};
+
+}  // namespace mp_api
+
+using PipelinedTaskRunner = mp_api::PipelinedTaskRunner;
+
+extern "C" {
+
+#if !MEDIAPIPE_DISABLE_GPU
+MP_CAPI(MpReturnCode) mp_tasks_core_PipelinedTaskRunner_Create__PKc_i_i_Pgr_Pe(const char* serialized_config, int size, int max_in_flight,
+                                                                               std::shared_ptr<mediapipe::GpuResources>* gpu_resources,
+                                                                               std::shared_ptr<mediapipe::Executor>* executor,
+                                                                               absl::Status** status_out, PipelinedTaskRunner** task_runner_out);
+#endif  // !MEDIAPIPE_DISABLE_GPU
+
+// `executor` can be null, in which case the graph creates its own thread pool.
+MP_CAPI(MpReturnCode) mp_tasks_core_PipelinedTaskRunner_Create__PKc_i_i_Pe(const char* serialized_config, int size, int max_in_flight,
+                                                                           std::shared_ptr<mediapipe::Executor>* executor,
+                                                                           absl::Status** status_out, PipelinedTaskRunner** task_runner_out);
+
+MP_CAPI(void) mp_tasks_core_PipelinedTaskRunner__delete(PipelinedTaskRunner* task_runner);
+
+// `ticket_out` is set to -1 if the pipeline is full. In that case, `inputs` is not moved.
+MP_CAPI(MpReturnCode) mp_tasks_core_PipelinedTaskRunner__TrySend__Ppm(PipelinedTaskRunner* task_runner, PacketMap* inputs,
+                                                                      absl::Status** status_out, int64_t* ticket_out);
+
+// If the result is found, `status_out` is set to its status, and `value_out` is set to the output packets (or null if the status is not OK).
+MP_CAPI(MpReturnCode) mp_tasks_core_PipelinedTaskRunner__TryPop__ll_i(PipelinedTaskRunner* task_runner, int64_t ticket, int timeout_ms,
+                                                                      bool* found_out, absl::Status** status_out, PacketMap** value_out);
+MP_CAPI(MpReturnCode) mp_tasks_core_PipelinedTaskRunner__TryPopNext__i(PipelinedTaskRunner* task_runner, int timeout_ms, bool* found_out,
+                                                                       int64_t* ticket_out, absl::Status** status_out, PacketMap** value_out);
+
+// `inputs` and `values_out` must have `size` elements. `inputs` are moved, and `values_out` are set to the results (or null if failed).
+// `status_out` is set to the first error, if any. kUnavailable (dropped frames) is reported only if there's no other error.
+MP_CAPI(MpReturnCode) mp_tasks_core_PipelinedTaskRunner__ProcessBatch__PPpm_i_i(PipelinedTaskRunner* task_runner, PacketMap** inputs, int size,
+                                                                                int timeout_ms, absl::Status** status_out, PacketMap** values_out);
+
+MP_CAPI(int) mp_tasks_core_PipelinedTaskRunner__in_flight_count(PipelinedTaskRunner* task_runner);
+MP_CAPI(int) mp_tasks_core_PipelinedTaskRunner__completed_count(PipelinedTaskRunner* task_runner);
+MP_CAPI(MpReturnCode) mp_tasks_core_PipelinedTaskRunner__Close(PipelinedTaskRunner* task_runner, absl::Status** status_out);
+
+}  // extern "C"
+
+#endif  // MEDIAPIPE_API_TASKS_CC_CORE_PIPELINED_TASK_RUNNER_H_
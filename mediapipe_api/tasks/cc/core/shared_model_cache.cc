@@ -0,0 +1,258 @@
+// Copyright (c) 2026 homuler
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+#include "mediapipe_api/tasks/cc/core/shared_model_cache.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "absl/hash/hash.h"
+#include "absl/time/time.h"
+#include "google/protobuf/any.pb.h"
+#include "google/protobuf/descriptor.h"
+#include "google/protobuf/message.h"
+#include "mediapipe/tasks/cc/core/proto/external_file.pb.h"
+#include "mediapipe/util/resource_util.h"
+#include "mediapipe_api/framework/startup_profiler.h"
+#include "mediapipe_api/util/resource_util_custom.h"
+
+namespace mp_api {
+
+namespace {
+
+using ::google::protobuf::FieldDescriptor;
+using ::google::protobuf::Message;
+using ::mediapipe::tasks::core::proto::ExternalFile;
+
+// Calls `fn` for each ExternalFile in `message`, unpacking google.protobuf.Any if necessary.
+// Returns true if `fn` returns true for any of them, i.e. `message` is modified.
+template <typename F>
+bool VisitExternalFiles(Message* message, const F& fn) {
+  const auto* descriptor = message->GetDescriptor();
+  if (descriptor == ExternalFile::descriptor()) {
+    return fn(static_cast<ExternalFile*>(message));
+  }
+  if (descriptor == google::protobuf::Any::descriptor()) {
+    auto* any = static_cast<google::protobuf::Any*>(message);
+    const auto& type_url = any->type_url();
+    const auto* type = google::protobuf::DescriptorPool::generated_pool()->FindMessageTypeByName(type_url.substr(type_url.rfind('/') + 1));
+    if (type == nullptr) {
+      return false;
+    }
+    std::unique_ptr<Message> value(google::protobuf::MessageFactory::generated_factory()->GetPrototype(type)->New());
+    if (!any->UnpackTo(value.get()) || !VisitExternalFiles(value.get(), fn)) {
+      return false;
+    }
+    any->PackFrom(*value);
+    return true;
+  }
+
+  const auto* reflection = message->GetReflection();
+  std::vector<const FieldDescriptor*> fields;
+  reflection->ListFields(*message, &fields);
+
+  bool modified = false;
+  for (const auto* field : fields) {
+    if (field->cpp_type() != FieldDescriptor::CPPTYPE_MESSAGE) {
+      continue;
+    }
+    if (field->is_repeated()) {
+      const auto size = reflection->FieldSize(*message, field);
+      for (auto i = 0; i < size; ++i) {
+        modified |= VisitExternalFiles(reflection->MutableRepeatedMessage(message, field, i), fn);
+      }
+    } else {
+      modified |= VisitExternalFiles(reflection->MutableMessage(message, field), fn);
+    }
+  }
+  return modified;
+}
+
+// Owns a buffer on the heap, which is referred to by the aliasing Handle.
+struct HeapBuffer {
+  std::string content;
+  absl::string_view view;
+};
+
+void SetPointer(const SharedModelCache::Handle& handle, ExternalFile* external_file) {
+  external_file->Clear();
+  auto* meta = external_file->mutable_file_pointer_meta();
+  meta->set_pointer(reinterpret_cast<uint64_t>(handle->data()));
+  meta->set_length(static_cast<int64_t>(handle->size()));
+}
+
+}  // namespace
+
+SharedModelCache& SharedModelCache::GetInstance() {
+  static auto* instance = new SharedModelCache();
+  return *instance;
+}
+
+std::vector<SharedModelCache::Handle> SharedModelCache::ShareModelAssets(mediapipe::CalculatorGraphConfig& config) {
+  std::vector<Handle> handles;
+  if (!enabled()) {
+    return handles;
+  }
+
+  VisitExternalFiles(&config, [this, &handles](ExternalFile* external_file) -> bool {
+    Handle handle;
+    if (external_file->has_file_content()) {
+      handle = AcquireContent(std::move(*external_file->mutable_file_content()));
+    } else if (external_file->has_file_name()) {
+      auto status_or_handle = AcquireFile(external_file->file_name());
+      if (!status_or_handle.ok()) {
+        // NOTE: leave it to the graph, which reports the error when it's initialized.
+        return false;
+      }
+      handle = std::move(status_or_handle).value();
+    } else {
+      return false;
+    }
+    SetPointer(handle, external_file);
+    handles.push_back(std::move(handle));
+    return true;
+  });
+  return handles;
+}
+
+SharedModelCache::Handle SharedModelCache::AcquireContent(std::string content) {
+  const auto hash = absl::Hash<std::string>{}(content);
+  absl::MutexLock lock(&mutex_);
+  if (auto handle = FindContent(hash, content)) {
+    RecordHit(handle);
+    return handle;
+  }
+
+  ++misses_;
+  RemoveExpiredEntries();
+  auto buffer = std::make_shared<HeapBuffer>();
+  buffer->content = std::move(content);
+  buffer->view = buffer->content;
+  auto handle = Handle(buffer, &buffer->view);
+  contents_[hash].push_back(handle);
+  return handle;
+}
+
+absl::StatusOr<SharedModelCache::Handle> SharedModelCache::AcquireFile(const std::string& path) {
+  {
+    absl::MutexLock lock(&mutex_);
+    auto it = files_.find(path);
+    if (it != files_.end()) {
+      if (auto handle = it->second.lock()) {
+        RecordHit(handle);
+        return handle;
+      }
+    }
+  }
+
+  const auto start = absl::Now();
+  if (auto status_or_buffer = GetResourceBuffer(path); status_or_buffer.ok()) {
+    // NOTE: the mappings are shared by MappedFile, so they are not deduplicated by the contents.
+    auto handle = std::move(status_or_buffer).value();
+    StartupProfiler::GetInstance().RecordActive(StartupPhaseType::kModelLoad, path, start);
+    absl::MutexLock lock(&mutex_);
+    ++misses_;
+    RemoveExpiredEntries();
+    files_[path] = handle;
+    return handle;
+  } else if (!absl::IsNotFound(status_or_buffer.status())) {
+    return status_or_buffer.status();
+  }
+
+  // NOTE: read the file without the lock, since it can take a while.
+  std::string content;
+  auto status = mediapipe::GetResourceContents(path, &content);
+  if (!status.ok()) {
+    return status;
+  }
+  // The same content may be already cached by another path.
+  auto handle = AcquireContent(std::move(content));
+
+  absl::MutexLock lock(&mutex_);
+  files_[path] = handle;
+  return handle;
+}
+
+void SharedModelCache::Retain(const void* owner, std::vector<Handle> handles) {
+  if (handles.empty()) {
+    return;
+  }
+  absl::MutexLock lock(&mutex_);
+  auto& retained = owners_[owner];
+  retained.insert(retained.end(), std::make_move_iterator(handles.begin()), std::make_move_iterator(handles.end()));
+}
+
+std::vector<SharedModelCache::Handle> SharedModelCache::Release(const void* owner) {
+  absl::MutexLock lock(&mutex_);
+  auto node = owners_.extract(owner);
+  return node.empty() ? std::vector<Handle>{} : std::move(node.mapped());
+}
+
+bool SharedModelCache::enabled() const {
+  absl::MutexLock lock(&mutex_);
+  return enabled_;
+}
+
+void SharedModelCache::set_enabled(bool enabled) {
+  absl::MutexLock lock(&mutex_);
+  enabled_ = enabled;
+}
+
+SharedModelCacheStats SharedModelCache::GetStats() {
+  absl::MutexLock lock(&mutex_);
+  SharedModelCacheStats stats{hits_, misses_, 0, 0, shared_bytes_};
+
+  RemoveExpiredEntries();
+  for (const auto& [hash, buffers] : contents_) {
+    for (const auto& buffer : buffers) {
+      if (auto handle = buffer.lock()) {
+        ++stats.entries;
+        stats.cached_bytes += static_cast<int64_t>(handle->size());
+      }
+    }
+  }
+  return stats;
+}
+
+void SharedModelCache::RemoveExpiredEntries() {
+  // NOTE: the cache doesn't know when the handles are destroyed, so the expired entries are removed when a new entry is added.
+  for (auto it = contents_.begin(); it != contents_.end();) {
+    auto& buffers = it->second;
+    buffers.erase(std::remove_if(buffers.begin(), buffers.end(), [](const auto& buffer) { return buffer.expired(); }), buffers.end());
+    if (buffers.empty()) {
+      contents_.erase(it++);
+    } else {
+      ++it;
+    }
+  }
+  absl::erase_if(files_, [](const auto& entry) { return entry.second.expired(); });
+}
+
+SharedModelCache::Handle SharedModelCache::FindContent(size_t hash, const std::string& content) {
+  auto it = contents_.find(hash);
+  if (it == contents_.end()) {
+    return nullptr;
+  }
+  for (const auto& buffer : it->second) {
+    if (auto handle = buffer.lock(); handle && *handle == content) {
+      return handle;
+    }
+  }
+  return nullptr;
+}
+
+void SharedModelCache::RecordHit(const Handle& handle) {
+  ++hits_;
+  shared_bytes_ += static_cast<int64_t>(handle->size());
+}
+
+}  // namespace mp_api
+
+bool mp_SharedModelCache__enabled() { return mp_api::SharedModelCache::GetInstance().enabled(); }
+
+void mp_SharedModelCache__set_enabled__b(bool enabled) { mp_api::SharedModelCache::GetInstance().set_enabled(enabled); }
+
+void mp_SharedModelCache__GetStats(mp_api::SharedModelCacheStats* stats_out) { *stats_out = mp_api::SharedModelCache::GetInstance().GetStats(); }
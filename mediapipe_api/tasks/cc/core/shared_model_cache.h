@@ -0,0 +1,99 @@
+// Copyright (c) 2026 homuler
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+#ifndef MEDIAPIPE_API_TASKS_CC_CORE_SHARED_MODEL_CACHE_H_
+#define MEDIAPIPE_API_TASKS_CC_CORE_SHARED_MODEL_CACHE_H_
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/string_view.h"
+#include "absl/synchronization/mutex.h"
+#include "mediapipe/framework/calculator.pb.h"
+#include "mediapipe_api/common.h"
+
+namespace mp_api {
+
+struct SharedModelCacheStats {
+  // The number of the model assets found in the cache.
+  int64_t hits;
+  // The number of the model assets loaded into the cache.
+  int64_t misses;
+  // The number of the model assets currently in the cache.
+  int64_t entries;
+  // The total size of the model assets currently in the cache.
+  int64_t cached_bytes;
+  // The total size of the model assets served from the cache, i.e. the bytes that would have been loaded again without the cache.
+  int64_t shared_bytes;
+};
+
+// A process-wide cache of the model assets (ExternalFile in the graph options), shared by TaskRunners and CalculatorGraphs.
+// The assets are keyed by their path or content, and reference-counted, so they are released when no graph uses them.
+//
+// It's disabled by default, since the graph config is rewritten to refer to the cached buffers by their addresses (ExternalFile.file_pointer_meta).
+// The config returned by the graph (e.g. TaskRunner::GetGraphConfig) is valid only while the graph is alive, and must not be used to create another graph after that.
+//
+// If an asset bundle or a ResourceLocator is set (see resource_util_custom.h), the files are memory-mapped instead of being copied onto the heap.
+class SharedModelCache {
+ public:
+  // Refers to either a buffer on the heap or a memory-mapped file, and keeps it alive.
+  using Handle = std::shared_ptr<const absl::string_view>;
+
+  static SharedModelCache& GetInstance();
+
+  // Loads the ExternalFile contents in `config` (including the ones in node_options) into the cache,
+  // and replaces them with the pointers to the cached buffers.
+  // Returns the handles that must be kept alive while the graph is alive. If the cache is disabled, `config` is not changed.
+  std::vector<Handle> ShareModelAssets(mediapipe::CalculatorGraphConfig& config);
+
+  Handle AcquireContent(std::string content);
+  absl::StatusOr<Handle> AcquireFile(const std::string& path);
+
+  // Keeps `handles` until Release(owner) is called.
+  void Retain(const void* owner, std::vector<Handle> handles);
+  // Returns the handles retained for `owner`. The caller should destroy them after `owner` is destroyed.
+  std::vector<Handle> Release(const void* owner);
+
+  bool enabled() const;
+  void set_enabled(bool enabled);
+
+  SharedModelCacheStats GetStats();
+
+ private:
+  SharedModelCache() = default;
+
+  Handle FindContent(size_t hash, const std::string& content) ABSL_EXCLUSIVE_LOCKS_REQUIRED(mutex_);
+  // Removes the entries whose buffers are already released.
+  void RemoveExpiredEntries() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mutex_);
+  void RecordHit(const Handle& handle) ABSL_EXCLUSIVE_LOCKS_REQUIRED(mutex_);
+
+  mutable absl::Mutex mutex_;
+  bool enabled_ ABSL_GUARDED_BY(mutex_) = false;
+  absl::flat_hash_map<std::string, std::weak_ptr<const absl::string_view>> files_ ABSL_GUARDED_BY(mutex_);
+  // keyed by the hash of the contents. The collisions are resolved by comparing the contents.
+  absl::flat_hash_map<size_t, std::vector<std::weak_ptr<const absl::string_view>>> contents_ ABSL_GUARDED_BY(mutex_);
+  absl::flat_hash_map<const void*, std::vector<Handle>> owners_ ABSL_GUARDED_BY(mutex_);
+  int64_t hits_ ABSL_GUARDED_BY(mutex_) = 0;
+  int64_t misses_ ABSL_GUARDED_BY(mutex_) = 0;
+  int64_t shared_bytes_ ABSL_GUARDED_BY(mutex_) = 0;
+};
+
+}  // namespace mp_api
+
+extern "C" {
+
+MP_CAPI(bool) mp_SharedModelCache__enabled();
+MP_CAPI(void) mp_SharedModelCache__set_enabled__b(bool enabled);
+MP_CAPI(void) mp_SharedModelCache__GetStats(mp_api::SharedModelCacheStats* stats_out);
+
+}  // extern "C"
+
+#endif  // MEDIAPIPE_API_TASKS_CC_CORE_SHARED_MODEL_CACHE_H_
@@ -1,6 +1,103 @@
 #include "mediapipe_api/tasks/cc/core/task_runner.h"
 
+#include <optional>
+#include <utility>
+
+#include "absl/functional/function_ref.h"
 #include "mediapipe/tasks/cc/core/mediapipe_builtin_op_resolver.h"
+#include "mediapipe_api/tasks/cc/core/shared_model_cache.h"
+
+namespace {
+
+mediapipe::tasks::core::PacketsCallback BuildPacketsCallback(int callback_id, NativePacketsCallback* packets_callback) {
+  if (!packets_callback) {
+    return nullptr;
+  }
+  return [callback_id, packets_callback](absl::StatusOr<PacketMap> status_or_packet_map) -> void {
+    if (!status_or_packet_map.ok()) {
+      auto status = status_or_packet_map.status();
+      packets_callback(callback_id, &status, nullptr);
+      return;
+    }
+    // NOTE: the packets are moved, not copied, since the result is not used after the callback.
+    auto status = absl::OkStatus();
+    auto value = std::move(status_or_packet_map).value();
+    packets_callback(callback_id, &status, &value);
+  };
+}
+
+// Moves the packets in `inputs` to a new map for TaskRunner, which takes the inputs by value.
+// NOTE: the keys are left in `inputs` with empty packets, so that the caller can assign the next packets without inserting the nodes again.
+PacketMap TakePackets(PacketMap* inputs) {
+  PacketMap packets;
+  for (auto& [name, packet] : *inputs) {
+    if (!packet.IsEmpty()) {
+      packets.emplace(name, std::move(packet));
+    }
+  }
+  return packets;
+}
+
+// Returns the startup profile of `task_runner` if it has not processed any inputs yet.
+std::shared_ptr<mp_api::StartupProfile> FindUnprocessedProfile(TaskRunner* task_runner) {
+  auto& profiler = mp_api::StartupProfiler::GetInstance();
+  if (!profiler.enabled()) {
+    return nullptr;
+  }
+  auto profile = profiler.Find(task_runner);
+  return profile != nullptr && profile->MarkProcessed() ? profile : nullptr;
+}
+
+// Records the first TaskRunner::Process from `start` to now, and closes the startup window.
+void RecordFirstProcess(mp_api::StartupProfile* profile, absl::Time start) {
+  profile->Record(mp_api::StartupPhaseType::kFirstProcess, -1, "", start, absl::Now());
+  if (profile->EndTracing()) {
+    profile->PauseTracer();
+  }
+}
+
+// Closes the startup window of `task_runner` if it's been traced for too long, e.g. because no inputs are processed synchronously.
+void EndExpiredTracing(TaskRunner* task_runner) {
+  if (auto profile = mp_api::StartupProfiler::GetInstance().FindExpired(task_runner); profile != nullptr && profile->EndTracing()) {
+    profile->PauseTracer();
+  }
+}
+
+using CreateFunction = absl::FunctionRef<absl::StatusOr<std::unique_ptr<TaskRunner>>(
+    mediapipe::CalculatorGraphConfig, mediapipe::tasks::core::PacketsCallback, std::optional<PacketMap>)>;
+
+// Creates a TaskRunner by `create`, recording its startup and sharing the model assets.
+absl::Status CreateTaskRunner(const char* serialized_config, int size, int callback_id, NativePacketsCallback* packets_callback,
+                              CreateFunction create, TaskRunner** task_runner_out) {
+  mp_api::ScopedStartupProfile startup(mp_api::StartupProfiler::GetInstance().NewProfile());
+  auto start = absl::Now();
+  auto config = ParseFromStringAsProto<mediapipe::CalculatorGraphConfig>(serialized_config, size);
+  startup.Record(mp_api::StartupPhaseType::kConfigParse, start);
+  auto model_assets = mp_api::SharedModelCache::GetInstance().ShareModelAssets(config);
+  PacketMap input_side_packets;
+  startup.EnableTaskTracing(&config, &input_side_packets);
+  auto callback = BuildPacketsCallback(callback_id, packets_callback);
+
+  start = absl::Now();
+  auto status_or_task_runner = create(std::move(config), std::move(callback),
+                                      input_side_packets.empty() ? std::nullopt : std::make_optional(std::move(input_side_packets)));
+  startup.Record(mp_api::StartupPhaseType::kStartRun, start);
+  if (!status_or_task_runner.ok()) {
+    *task_runner_out = nullptr;
+    return status_or_task_runner.status();
+  }
+  // NOTE: TaskRunner cannot be moved, so pass the pointer instead.
+  *task_runner_out = std::move(status_or_task_runner).value().release();
+  mp_api::SharedModelCache::GetInstance().Retain(*task_runner_out, std::move(model_assets));
+  if (startup.profile() != nullptr) {
+    startup.profile()->MarkStarted();
+    // NOTE: the profiler is set by StartupTraceCalculator.
+    startup.Attach(*task_runner_out, nullptr);
+  }
+  return absl::OkStatus();
+}
+
+}  // namespace
 
 #if !MEDIAPIPE_DISABLE_GPU
 MpReturnCode mp_tasks_core_TaskRunner_Create__PKc_i_PF_Pgr(const char* serialized_config, int size,
@@ -8,34 +105,31 @@ MpReturnCode mp_tasks_core_TaskRunner_Create__PKc_i_PF_Pgr(const char* serialize
                                                            std::shared_ptr<mediapipe::GpuResources>* gpu_resources,
                                                            absl::Status** status_out, TaskRunner** task_runner_out) {
   TRY
-    auto config = ParseFromStringAsProto<mediapipe::CalculatorGraphConfig>(serialized_config, size);
-    mediapipe::tasks::core::PacketsCallback callback = nullptr;
-    if (packets_callback) {
-      callback = [callback_id, packets_callback](absl::StatusOr<PacketMap> status_or_packet_map) -> void {
-        auto status = status_or_packet_map.status();
-        if (!status.ok()) {
-          packets_callback(callback_id, &status, nullptr);
-          return;
-        }
-        auto value = status_or_packet_map.value();
-        packets_callback(callback_id, &status, &value);
-      };
-    }
+    *status_out = new absl::Status{CreateTaskRunner(
+        serialized_config, size, callback_id, packets_callback,
+        [gpu_resources](auto config, auto callback, auto input_side_packets) {
+          return TaskRunner::Create(std::move(config), absl::make_unique<mediapipe::tasks::core::MediaPipeBuiltinOpResolver>(), std::move(callback),
+                                    /* default_executor= */ nullptr, std::move(input_side_packets), *gpu_resources);
+        },
+        task_runner_out)};
+    RETURN_CODE(MpReturnCode::Success);
+  CATCH_EXCEPTION
+}
 
-    auto status_or_task_runner = TaskRunner::Create(
-      std::move(config),
-      absl::make_unique<mediapipe::tasks::core::MediaPipeBuiltinOpResolver>(),
-      std::move(callback),
-      /* default_executor= */ nullptr,
-      /* input_side_packes= */ std::nullopt, *gpu_resources);
-
-    *status_out = new absl::Status{status_or_task_runner.status()};
-    if (status_or_task_runner.ok()) {
-      // NOTE: TaskRunner cannot be moved, so pass the pointer instead.
-      *task_runner_out = status_or_task_runner.value().release();
-    } else {
-      *task_runner_out = nullptr;
-    }
+MpReturnCode mp_tasks_core_TaskRunner_Create__PKc_i_PF_Pgr_Pe(const char* serialized_config, int size,
+                                                              int callback_id, NativePacketsCallback* packets_callback,
+                                                              std::shared_ptr<mediapipe::GpuResources>* gpu_resources,
+                                                              std::shared_ptr<mediapipe::Executor>* executor,
+                                                              absl::Status** status_out, TaskRunner** task_runner_out) {
+  TRY
+    *status_out = new absl::Status{CreateTaskRunner(
+        serialized_config, size, callback_id, packets_callback,
+        [gpu_resources, executor](auto config, auto callback, auto input_side_packets) {
+          return TaskRunner::Create(std::move(config), absl::make_unique<mediapipe::tasks::core::MediaPipeBuiltinOpResolver>(), std::move(callback),
+                                    executor == nullptr ? nullptr : *executor, std::move(input_side_packets),
+                                    gpu_resources == nullptr ? nullptr : *gpu_resources);
+        },
+        task_runner_out)};
     RETURN_CODE(MpReturnCode::Success);
   CATCH_EXCEPTION
 }
@@ -45,46 +139,51 @@ MpReturnCode mp_tasks_core_TaskRunner_Create__PKc_i_PF(const char* serialized_co
                                                        int callback_id, NativePacketsCallback* packets_callback,
                                                        absl::Status** status_out, TaskRunner** task_runner_out) {
   TRY
-    auto config = ParseFromStringAsProto<mediapipe::CalculatorGraphConfig>(serialized_config, size);
-    mediapipe::tasks::core::PacketsCallback callback = nullptr;
-    if (packets_callback) {
-      callback = [callback_id, packets_callback](absl::StatusOr<PacketMap> status_or_packet_map) -> void {
-        auto status = status_or_packet_map.status();
-        if (!status.ok()) {
-          packets_callback(callback_id, &status, nullptr);
-          return;
-        }
-        auto value = status_or_packet_map.value();
-        packets_callback(callback_id, &status, &value);
-      };
-    }
-
-    auto status_or_task_runner = TaskRunner::Create(
-      std::move(config),
-      absl::make_unique<mediapipe::tasks::core::MediaPipeBuiltinOpResolver>(),
-      std::move(callback));
+    *status_out = new absl::Status{CreateTaskRunner(
+        serialized_config, size, callback_id, packets_callback,
+        [](auto config, auto callback, auto input_side_packets) {
+          return TaskRunner::Create(std::move(config), absl::make_unique<mediapipe::tasks::core::MediaPipeBuiltinOpResolver>(), std::move(callback),
+                                    /* default_executor= */ nullptr, std::move(input_side_packets));
+        },
+        task_runner_out)};
+    RETURN_CODE(MpReturnCode::Success);
+  CATCH_EXCEPTION
+}
 
-    *status_out = new absl::Status{status_or_task_runner.status()};
-    if (status_or_task_runner.ok()) {
-      // NOTE: TaskRunner cannot be moved, so pass the pointer instead.
-      *task_runner_out = status_or_task_runner.value().release();
-    } else {
-      *task_runner_out = nullptr;
-    }
+MpReturnCode mp_tasks_core_TaskRunner_Create__PKc_i_PF_Pe(const char* serialized_config, int size,
+                                                          int callback_id, NativePacketsCallback* packets_callback,
+                                                          std::shared_ptr<mediapipe::Executor>* executor,
+                                                          absl::Status** status_out, TaskRunner** task_runner_out) {
+  TRY
+    *status_out = new absl::Status{CreateTaskRunner(
+        serialized_config, size, callback_id, packets_callback,
+        [executor](auto config, auto callback, auto input_side_packets) {
+          return TaskRunner::Create(std::move(config), absl::make_unique<mediapipe::tasks::core::MediaPipeBuiltinOpResolver>(), std::move(callback),
+                                    executor == nullptr ? nullptr : *executor, std::move(input_side_packets));
+        },
+        task_runner_out)};
     RETURN_CODE(MpReturnCode::Success);
   CATCH_EXCEPTION
 }
 
 void mp_tasks_core_TaskRunner__delete(TaskRunner* task_runner) {
+  // NOTE: the model assets must outlive the graph.
+  auto model_assets = mp_api::SharedModelCache::GetInstance().Release(task_runner);
+  mp_api::StartupProfiler::GetInstance().Detach(task_runner);
   delete task_runner;
 }
 
 MpReturnCode mp_tasks_core_TaskRunner__Process__Ppm(TaskRunner* task_runner, PacketMap* inputs, absl::Status** status_out, PacketMap** value_out) {
   TRY
+    auto profile = FindUnprocessedProfile(task_runner);
+    const auto start = absl::Now();
     auto status_or_packet_map = task_runner->Process(std::move(*inputs));
+    if (profile != nullptr) {
+      RecordFirstProcess(profile.get(), start);
+    }
     *status_out = new absl::Status{status_or_packet_map.status()};
     if (status_or_packet_map.ok()) {
-      *value_out = new PacketMap{status_or_packet_map.value()};
+      *value_out = new PacketMap{std::move(status_or_packet_map).value()};
     } else {
       *value_out = nullptr;
     }
@@ -92,8 +191,36 @@ MpReturnCode mp_tasks_core_TaskRunner__Process__Ppm(TaskRunner* task_runner, Pac
   CATCH_EXCEPTION
 }
 
+MpReturnCode mp_tasks_core_TaskRunner__Process__Ppm_Ppm_Ps(TaskRunner* task_runner, PacketMap* inputs, PacketMap* outputs, absl::Status* status) {
+  TRY
+    auto profile = FindUnprocessedProfile(task_runner);
+    const auto start = absl::Now();
+    auto status_or_packet_map = task_runner->Process(TakePackets(inputs));
+    if (profile != nullptr) {
+      RecordFirstProcess(profile.get(), start);
+    }
+    if (status_or_packet_map.ok()) {
+      *status = absl::OkStatus();
+      *outputs = std::move(status_or_packet_map).value();
+    } else {
+      *status = std::move(status_or_packet_map).status();
+      outputs->clear();
+    }
+    RETURN_CODE(MpReturnCode::Success);
+  CATCH_EXCEPTION
+}
+
+MpReturnCode mp_tasks_core_TaskRunner__Send__Ppm_Ps(TaskRunner* task_runner, PacketMap* inputs, absl::Status* status) {
+  TRY
+    EndExpiredTracing(task_runner);
+    *status = task_runner->Send(TakePackets(inputs));
+    RETURN_CODE(MpReturnCode::Success);
+  CATCH_EXCEPTION
+}
+
 MpReturnCode mp_tasks_core_TaskRunner__Send__Ppm(TaskRunner* task_runner, PacketMap* inputs, absl::Status** status_out) {
   TRY
+    EndExpiredTracing(task_runner);
     *status_out = new absl::Status{task_runner->Send(std::move(*inputs))};
     RETURN_CODE(MpReturnCode::Success);
   CATCH_EXCEPTION
@@ -113,6 +240,16 @@ MpReturnCode mp_tasks_core_TaskRunner__Restart(TaskRunner* task_runner, absl::St
   CATCH_EXCEPTION
 }
 
+MpReturnCode mp_tasks_core_TaskRunner__GetStartupPhases(TaskRunner* task_runner, mp_api::StructArray<mp_api::StartupPhase>* value_out) {
+  TRY
+    if (auto profile = mp_api::StartupProfiler::GetInstance().Find(task_runner); profile != nullptr && profile->EndTracing()) {
+      profile->PauseTracer();
+    }
+    mp_api::GetStartupPhases(task_runner, value_out);
+    RETURN_CODE(MpReturnCode::Success);
+  CATCH_EXCEPTION
+}
+
 MpReturnCode mp_tasks_core_TaskRunner__GetGraphConfig(TaskRunner* task_runner, mp_api::SerializedProto* value_out) {
   TRY
     SerializeProto(task_runner->GetGraphConfig(), value_out);
@@ -13,6 +13,7 @@
 #include "mediapipe/tasks/cc/core/task_runner.h"
 #include "mediapipe_api/common.h"
 #include "mediapipe_api/external/protobuf.h"
+#include "mediapipe_api/framework/startup_profiler.h"
 
 using TaskRunner = mediapipe::tasks::core::TaskRunner;
 
@@ -26,18 +27,36 @@ MP_CAPI(MpReturnCode) mp_tasks_core_TaskRunner_Create__PKc_i_PF_Pgr(const char*
                                                                     int callback_id, NativePacketsCallback* packets_callback,
                                                                     std::shared_ptr<mediapipe::GpuResources>* gpu_resources,
                                                                     absl::Status** status_out, TaskRunner** task_runner_out);
+
+// `executor` is used as the default executor of the graph. If it's null, the graph creates its own thread pool.
+MP_CAPI(MpReturnCode) mp_tasks_core_TaskRunner_Create__PKc_i_PF_Pgr_Pe(const char* serialized_config, int size,
+                                                                       int callback_id, NativePacketsCallback* packets_callback,
+                                                                       std::shared_ptr<mediapipe::GpuResources>* gpu_resources,
+                                                                       std::shared_ptr<mediapipe::Executor>* executor,
+                                                                       absl::Status** status_out, TaskRunner** task_runner_out);
 #endif  // !MEDIAPIPE_DISABLE_GPU
 
 MP_CAPI(MpReturnCode) mp_tasks_core_TaskRunner_Create__PKc_i_PF(const char* serialized_config, int size,
                                                                 int callback_id, NativePacketsCallback* packets_callback,
                                                                 absl::Status** status_out, TaskRunner** task_runner_out);
+MP_CAPI(MpReturnCode) mp_tasks_core_TaskRunner_Create__PKc_i_PF_Pe(const char* serialized_config, int size,
+                                                                   int callback_id, NativePacketsCallback* packets_callback,
+                                                                   std::shared_ptr<mediapipe::Executor>* executor,
+                                                                   absl::Status** status_out, TaskRunner** task_runner_out);
 
 MP_CAPI(void) mp_tasks_core_TaskRunner__delete(TaskRunner* task_runner);
 
 MP_CAPI(MpReturnCode) mp_tasks_core_TaskRunner__Process__Ppm(TaskRunner* task_runner, PacketMap* inputs, absl::Status** status_out, PacketMap** value_out);
 MP_CAPI(MpReturnCode) mp_tasks_core_TaskRunner__Send__Ppm(TaskRunner* task_runner, PacketMap* inputs, absl::Status** status_out);
+
+// The following variants don't allocate the result map and the status, but overwrite the ones owned by the caller.
+// The packets in `inputs` are moved out, but the keys are kept with empty packets, so that the caller can reuse the nodes for the next frame.
+// NOTE: the empty packets in `inputs` are not sent to the graph.
+MP_CAPI(MpReturnCode) mp_tasks_core_TaskRunner__Process__Ppm_Ppm_Ps(TaskRunner* task_runner, PacketMap* inputs, PacketMap* outputs, absl::Status* status);
+MP_CAPI(MpReturnCode) mp_tasks_core_TaskRunner__Send__Ppm_Ps(TaskRunner* task_runner, PacketMap* inputs, absl::Status* status);
 MP_CAPI(MpReturnCode) mp_tasks_core_TaskRunner__Close(TaskRunner* task_runner, absl::Status** status_out);
 MP_CAPI(MpReturnCode) mp_tasks_core_TaskRunner__Restart(TaskRunner* task_runner, absl::Status** status_out);
+MP_CAPI(MpReturnCode) mp_tasks_core_TaskRunner__GetStartupPhases(TaskRunner* task_runner, mp_api::StructArray<mp_api::StartupPhase>* value_out);
 MP_CAPI(MpReturnCode) mp_tasks_core_TaskRunner__GetGraphConfig(TaskRunner* task_runner, mp_api::SerializedProto* value_out);
 
 }  // extern "C"
@@ -0,0 +1,118 @@
+// Copyright (c) 2026 homuler
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+// Counts the heap allocations per frame in the steady state, to verify what the C API adds to TaskRunner::Process.
+//
+//   bazel test //mediapipe_api/tasks/cc/core:task_runner_allocation_test --define MEDIAPIPE_DISABLE_GPU=1
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <utility>
+
+#include "absl/memory/memory.h"
+#include "gtest/gtest.h"
+#include "mediapipe/framework/calculator_framework.h"
+#include "mediapipe/framework/port/parse_text_proto.h"
+#include "mediapipe/tasks/cc/core/mediapipe_builtin_op_resolver.h"
+#include "mediapipe_api/tasks/cc/core/task_runner.h"
+#include "mediapipe_api/util/allocation_counter.h"
+
+namespace {
+
+constexpr int kWarmupFrames = 16;
+constexpr int kFrames = 64;
+
+// NOTE: the calculators run on the calling thread, so that all the allocations for a frame are made before Process returns.
+std::unique_ptr<TaskRunner> CreatePassThroughTaskRunner() {
+  auto config = mediapipe::ParseTextProtoOrDie<mediapipe::CalculatorGraphConfig>(R"pb(
+    input_stream: "in"
+    output_stream: "out"
+    executor { type: "ApplicationThreadExecutor" }
+    node {
+      calculator: "PassThroughCalculator"
+      input_stream: "in"
+      output_stream: "out"
+    }
+  )pb");
+  auto task_runner = TaskRunner::Create(std::move(config), absl::make_unique<mediapipe::tasks::core::MediaPipeBuiltinOpResolver>());
+  EXPECT_TRUE(task_runner.ok()) << task_runner.status();
+  return std::move(task_runner).value();
+}
+
+// Returns the least number of the allocations made by `process` for a frame after the warmup.
+// NOTE: the minimum is taken, since the graph may allocate occasionally, e.g. when a queue grows.
+template <typename F>
+int64_t CountAllocationsPerFrame(F&& process) {
+  int64_t timestamp = 0;
+  for (auto i = 0; i < kWarmupFrames; ++i) {
+    process(mediapipe::Timestamp(timestamp++));
+  }
+  auto count = std::numeric_limits<int64_t>::max();
+  for (auto i = 0; i < kFrames; ++i) {
+    const auto before = mp_api::GetAllocationStats();
+    process(mediapipe::Timestamp(timestamp++));
+    const auto after = mp_api::GetAllocationStats();
+    count = std::min(count, after.count - before.count);
+  }
+  return count;
+}
+
+int64_t CountProcessAllocations() {
+  auto task_runner = CreatePassThroughTaskRunner();
+  const auto count = CountAllocationsPerFrame([&](mediapipe::Timestamp timestamp) {
+    PacketMap inputs;
+    inputs.emplace("in", mediapipe::MakePacket<int>(0).At(timestamp));
+    auto outputs = task_runner->Process(std::move(inputs));
+    ASSERT_TRUE(outputs.ok()) << outputs.status();
+  });
+  EXPECT_TRUE(task_runner->Close().ok());
+  return count;
+}
+
+TEST(TaskRunnerAllocationTest, ProcessWithOutputs_ShouldNotAllocateMoreThanTaskRunner) {
+  const auto expected = CountProcessAllocations();
+
+  auto task_runner = CreatePassThroughTaskRunner();
+  PacketMap inputs;
+  PacketMap outputs;
+  absl::Status status;
+  const auto count = CountAllocationsPerFrame([&](mediapipe::Timestamp timestamp) {
+    inputs.insert_or_assign("in", mediapipe::MakePacket<int>(0).At(timestamp));
+    ASSERT_EQ(mp_tasks_core_TaskRunner__Process__Ppm_Ppm_Ps(task_runner.get(), &inputs, &outputs, &status), MpReturnCode::Success);
+    ASSERT_TRUE(status.ok()) << status;
+  });
+  EXPECT_TRUE(task_runner->Close().ok());
+
+  EXPECT_EQ(count, expected);
+  EXPECT_EQ(inputs.size(), 1);
+  EXPECT_TRUE(inputs.at("in").IsEmpty());
+  EXPECT_EQ(outputs.at("out").Get<int>(), 0);
+}
+
+TEST(TaskRunnerAllocationTest, Process_ShouldAllocateStatusAndOutputs) {
+  const auto expected = CountProcessAllocations();
+
+  auto task_runner = CreatePassThroughTaskRunner();
+  const auto count = CountAllocationsPerFrame([&](mediapipe::Timestamp timestamp) {
+    auto* inputs = new PacketMap();
+    inputs->emplace("in", mediapipe::MakePacket<int>(0).At(timestamp));
+    absl::Status* status = nullptr;
+    PacketMap* outputs = nullptr;
+    ASSERT_EQ(mp_tasks_core_TaskRunner__Process__Ppm(task_runner.get(), inputs, &status, &outputs), MpReturnCode::Success);
+    EXPECT_TRUE(status->ok()) << *status;
+    delete inputs;
+    delete status;
+    delete outputs;
+  });
+  EXPECT_TRUE(task_runner->Close().ok());
+
+  // NOTE: the input map, the status and the output map.
+  EXPECT_EQ(count, expected + 3);
+}
+
+}  // namespace
@@ -0,0 +1,74 @@
+// Copyright (c) 2026 homuler
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+// Compares the latency of TaskRunner::Process when the calculators run on the graph's thread pool with the latency when they run on the calling thread
+// (i.e. ApplicationThreadExecutor).
+//
+//   bazel run -c opt //mediapipe_api/tasks/cc/core:task_runner_benchmark --define MEDIAPIPE_DISABLE_GPU=1
+
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "absl/memory/memory.h"
+#include "absl/strings/str_cat.h"
+#include "benchmark/benchmark.h"
+#include "mediapipe/framework/calculator_framework.h"
+#include "mediapipe/tasks/cc/core/mediapipe_builtin_op_resolver.h"
+#include "mediapipe/tasks/cc/core/task_runner.h"
+
+namespace {
+
+using ::mediapipe::tasks::core::TaskRunner;
+
+// Builds a graph that passes the input through `num_nodes` PassThroughCalculators.
+mediapipe::CalculatorGraphConfig BuildPassThroughGraph(int num_nodes) {
+  mediapipe::CalculatorGraphConfig config;
+  config.add_input_stream("in");
+  std::string input_stream = "in";
+  for (auto i = 0; i < num_nodes; ++i) {
+    auto output_stream = i == num_nodes - 1 ? std::string("out") : absl::StrCat("s", i);
+    auto* node = config.add_node();
+    node->set_calculator("PassThroughCalculator");
+    node->add_input_stream(input_stream);
+    node->add_output_stream(output_stream);
+    input_stream = std::move(output_stream);
+  }
+  config.add_output_stream("out");
+  return config;
+}
+
+void RunProcess(benchmark::State& state, mediapipe::CalculatorGraphConfig config) {
+  auto task_runner = TaskRunner::Create(std::move(config), absl::make_unique<mediapipe::tasks::core::MediaPipeBuiltinOpResolver>());
+  if (!task_runner.ok()) {
+    state.SkipWithError(task_runner.status().ToString().c_str());
+    return;
+  }
+
+  int64_t timestamp = 0;
+  for (auto _ : state) {
+    auto outputs = (*task_runner)->Process({{"in", mediapipe::MakePacket<int>(0).At(mediapipe::Timestamp(timestamp++))}});
+    if (!outputs.ok()) {
+      state.SkipWithError(outputs.status().ToString().c_str());
+      break;
+    }
+    benchmark::DoNotOptimize(outputs);
+  }
+  (*task_runner)->Close().IgnoreError();
+}
+
+void BM_Process_Threaded(benchmark::State& state) { RunProcess(state, BuildPassThroughGraph(state.range(0))); }
+
+void BM_Process_ApplicationThread(benchmark::State& state) {
+  auto config = BuildPassThroughGraph(state.range(0));
+  config.add_executor()->set_type("ApplicationThreadExecutor");
+  RunProcess(state, std::move(config));
+}
+
+BENCHMARK(BM_Process_Threaded)->Arg(1)->Arg(4)->Arg(16);
+BENCHMARK(BM_Process_ApplicationThread)->Arg(1)->Arg(4)->Arg(16);
+
+}  // namespace
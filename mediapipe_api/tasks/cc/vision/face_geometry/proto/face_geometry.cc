@@ -7,9 +7,11 @@
 #include "mediapipe_api/tasks/cc/vision/face_geometry/proto/face_geometry.h"
 
 MpReturnCode mp_Packet__GetFaceGeometry(mediapipe::Packet* packet, mp_api::SerializedProto* value_out) {
+  MP_CAPI_NAMED_SPAN("mp_Packet__GetFaceGeometry");
   return mp_Packet__GetSerializedProto<mediapipe::tasks::vision::face_geometry::proto::FaceGeometry>(packet, value_out);
 }
 
 MpReturnCode mp_Packet__GetFaceGeometryVector(mediapipe::Packet* packet, mp_api::StructArray<mp_api::SerializedProto>* value_out) {
+  MP_CAPI_NAMED_SPAN("mp_Packet__GetFaceGeometryVector");
   return mp_Packet__GetSerializedProtoVector<mediapipe::tasks::vision::face_geometry::proto::FaceGeometry>(packet, value_out);
 }
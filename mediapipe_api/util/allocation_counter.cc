@@ -0,0 +1,103 @@
+// Copyright (c) 2026 homuler
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+#include "mediapipe_api/util/allocation_counter.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace {
+
+std::atomic<int64_t> allocation_count{0};
+std::atomic<int64_t> allocation_bytes{0};
+
+[[noreturn]] void OnOutOfMemory() {
+#ifdef __cpp_exceptions
+  throw std::bad_alloc();
+#else
+  std::abort();
+#endif
+}
+
+inline void Count(std::size_t size) {
+  allocation_count.fetch_add(1, std::memory_order_relaxed);
+  allocation_bytes.fetch_add(static_cast<int64_t>(size), std::memory_order_relaxed);
+}
+
+inline void* CountedAlloc(std::size_t size) {
+  Count(size);
+  return std::malloc(size == 0 ? 1 : size);
+}
+
+inline void* CountedAlignedAlloc(std::size_t size, std::align_val_t alignment) {
+  Count(size);
+  const auto align = static_cast<std::size_t>(alignment);
+#ifdef _WIN32
+  return _aligned_malloc(size == 0 ? 1 : size, align);
+#else
+  void* ptr = nullptr;
+  return posix_memalign(&ptr, align < sizeof(void*) ? sizeof(void*) : align, size == 0 ? 1 : size) == 0 ? ptr : nullptr;
+#endif
+}
+
+inline void AlignedFree(void* ptr) {
+#ifdef _WIN32
+  _aligned_free(ptr);
+#else
+  std::free(ptr);
+#endif
+}
+
+}  // namespace
+
+namespace mp_api {
+
+AllocationStats GetAllocationStats() {
+  return AllocationStats{allocation_count.load(std::memory_order_relaxed), allocation_bytes.load(std::memory_order_relaxed)};
+}
+
+}  // namespace mp_api
+
+void* operator new(std::size_t size) {
+  if (auto* ptr = CountedAlloc(size)) return ptr;
+  OnOutOfMemory();
+}
+
+void* operator new[](std::size_t size) {
+  if (auto* ptr = CountedAlloc(size)) return ptr;
+  OnOutOfMemory();
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept { return CountedAlloc(size); }
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept { return CountedAlloc(size); }
+
+void* operator new(std::size_t size, std::align_val_t alignment) {
+  if (auto* ptr = CountedAlignedAlloc(size, alignment)) return ptr;
+  OnOutOfMemory();
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment) {
+  if (auto* ptr = CountedAlignedAlloc(size, alignment)) return ptr;
+  OnOutOfMemory();
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept { return CountedAlignedAlloc(size, alignment); }
+void* operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept { return CountedAlignedAlloc(size, alignment); }
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete[](void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, std::size_t) noexcept { std::free(ptr); }
+void operator delete(void* ptr, const std::nothrow_t&) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept { std::free(ptr); }
+
+void operator delete(void* ptr, std::align_val_t) noexcept { AlignedFree(ptr); }
+void operator delete[](void* ptr, std::align_val_t) noexcept { AlignedFree(ptr); }
+void operator delete(void* ptr, std::size_t, std::align_val_t) noexcept { AlignedFree(ptr); }
+void operator delete[](void* ptr, std::size_t, std::align_val_t) noexcept { AlignedFree(ptr); }
+void operator delete(void* ptr, std::align_val_t, const std::nothrow_t&) noexcept { AlignedFree(ptr); }
+void operator delete[](void* ptr, std::align_val_t, const std::nothrow_t&) noexcept { AlignedFree(ptr); }
@@ -0,0 +1,27 @@
+// Copyright (c) 2026 homuler
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+#ifndef MEDIAPIPE_API_UTIL_ALLOCATION_COUNTER_H_
+#define MEDIAPIPE_API_UTIL_ALLOCATION_COUNTER_H_
+
+#include <cstdint>
+
+namespace mp_api {
+
+// The cumulative number of the heap allocations made by the global operator new and the bytes requested by them.
+// To count allocations in a section, take the difference between the values before and after it.
+struct AllocationStats {
+  int64_t count;
+  int64_t bytes;
+};
+
+// NOTE: the global operator new and delete are replaced by the ones that count the allocations when this library is linked.
+// It's only for the native tests and benchmarks, so never link it to the plugin library, where the replacement may not be the one that the process uses.
+AllocationStats GetAllocationStats();
+
+}  // namespace mp_api
+
+#endif  // MEDIAPIPE_API_UTIL_ALLOCATION_COUNTER_H_
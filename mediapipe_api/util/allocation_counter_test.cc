@@ -0,0 +1,97 @@
+// Copyright (c) 2026 homuler
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+#include "mediapipe_api/util/allocation_counter.h"
+
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace mp_api {
+namespace {
+
+// NOTE: the pointers are stored here, so that the compiler cannot elide the pairs of new and delete.
+void* volatile sink = nullptr;
+
+struct alignas(64) OverAligned {
+  char data[64];
+};
+
+TEST(AllocationCounterTest, CountsNew) {
+  const auto before = GetAllocationStats();
+  auto* value = new int64_t(1);
+  sink = value;
+  const auto after = GetAllocationStats();
+  delete value;
+
+  EXPECT_EQ(after.count - before.count, 1);
+  EXPECT_EQ(after.bytes - before.bytes, sizeof(int64_t));
+}
+
+TEST(AllocationCounterTest, CountsArrayNew) {
+  const auto before = GetAllocationStats();
+  auto* values = new int32_t[16];
+  sink = values;
+  const auto after = GetAllocationStats();
+  delete[] values;
+
+  EXPECT_EQ(after.count - before.count, 1);
+  EXPECT_GE(after.bytes - before.bytes, 16 * sizeof(int32_t));
+}
+
+TEST(AllocationCounterTest, CountsNothrowNew) {
+  const auto before = GetAllocationStats();
+  auto* value = new (std::nothrow) int64_t(1);
+  sink = value;
+  const auto after = GetAllocationStats();
+  delete value;
+
+  EXPECT_EQ(after.count - before.count, 1);
+}
+
+TEST(AllocationCounterTest, CountsAlignedNew) {
+  const auto before = GetAllocationStats();
+  auto* value = new OverAligned();
+  sink = value;
+  const auto after = GetAllocationStats();
+
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(value) % alignof(OverAligned), 0);
+  delete value;
+  EXPECT_EQ(after.count - before.count, 1);
+  EXPECT_EQ(after.bytes - before.bytes, sizeof(OverAligned));
+}
+
+TEST(AllocationCounterTest, CountsAllocationsByContainers) {
+  const auto before = GetAllocationStats();
+  auto values = std::make_unique<std::vector<int>>(8);
+  sink = values->data();
+  const auto after = GetAllocationStats();
+
+  EXPECT_EQ(after.count - before.count, 2);
+}
+
+TEST(AllocationCounterTest, DoesNotCountDelete_Or_ReusedStorage) {
+  std::vector<int> values;
+  values.reserve(16);
+  sink = values.data();
+
+  const auto before = GetAllocationStats();
+  for (auto i = 0; i < 16; ++i) {
+    values.push_back(i);
+  }
+  values.clear();
+  values.shrink_to_fit();
+  const auto after = GetAllocationStats();
+
+  EXPECT_EQ(after.count - before.count, 0);
+  EXPECT_EQ(after.bytes - before.bytes, 0);
+}
+
+}  // namespace
+}  // namespace mp_api
@@ -0,0 +1,211 @@
+// Copyright (c) 2026 homuler
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+#include "mediapipe_api/util/asset_bundle.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <utility>
+
+#include "absl/status/status.h"
+#include "absl/strings/str_cat.h"
+#include "mediapipe_api/util/cache_file_util.h"
+#include "zlib.h"
+
+namespace mp_api {
+
+namespace {
+
+// NOTE: the layout must be kept in sync with mediapipe_api/pack_asset_bundle.py.
+constexpr char kMagic[4] = {'M', 'P', 'A', 'B'};
+constexpr uint32_t kVersion = 2;
+constexpr size_t kHeaderSize = 56;
+constexpr size_t kEntrySize = 48;
+
+enum Compression : uint32_t {
+  kNone = 0,
+  kZlib = 1,
+};
+
+// NOTE: the bundle may be mapped at an unaligned address (e.g. in an APK), so the values are read by memcpy.
+template <typename T>
+T Load(const char* data) {
+  T value;
+  std::memcpy(&value, data, sizeof(T));
+  return value;
+}
+
+absl::string_view GetBaseName(absl::string_view path) {
+  const auto pos = path.find_last_of("/\\");
+  return pos == absl::string_view::npos ? path : path.substr(pos + 1);
+}
+
+// Owns the contents referred to by the aliasing std::shared_ptr.
+template <typename T>
+struct Buffer {
+  T owner;
+  absl::string_view view;
+};
+
+// The contents on the heap, which are aligned in the same way as the uncompressed contents in an aligned bundle.
+struct AlignedBuffer {
+  AlignedBuffer(size_t size, size_t alignment)
+      : data(static_cast<char*>(::operator new(std::max<size_t>(size, 1), std::align_val_t(alignment)))), alignment(alignment), view(data, size) {}
+  ~AlignedBuffer() { ::operator delete(data, std::align_val_t(alignment)); }
+  AlignedBuffer(const AlignedBuffer&) = delete;
+  AlignedBuffer& operator=(const AlignedBuffer&) = delete;
+
+  char* const data;
+  const size_t alignment;
+  const absl::string_view view;
+};
+
+}  // namespace
+
+absl::StatusOr<std::shared_ptr<const AssetBundle>> AssetBundle::Open(const std::string& path, int64_t offset, int64_t length) {
+  auto file = MappedFile::Map(path, offset, length);
+  if (!file.ok()) {
+    return file.status();
+  }
+  return Create(std::move(file).value());
+}
+
+absl::StatusOr<std::shared_ptr<const AssetBundle>> AssetBundle::OpenDescriptor(int fd, int64_t offset, int64_t length) {
+  auto file = MappedFile::MapDescriptor(fd, offset, length);
+  if (!file.ok()) {
+    return file.status();
+  }
+  return Create(std::move(file).value());
+}
+
+absl::StatusOr<std::shared_ptr<const AssetBundle>> AssetBundle::Create(std::shared_ptr<const MappedFile> file) {
+  const auto& contents = file->contents();
+  if (contents.size() < kHeaderSize || std::memcmp(contents.data(), kMagic, sizeof(kMagic)) != 0) {
+    return absl::InvalidArgumentError("Not an asset bundle");
+  }
+  if (const auto version = Load<uint32_t>(contents.data() + 4); version != kVersion) {
+    return absl::InvalidArgumentError(absl::StrCat("Unsupported asset bundle version: ", version));
+  }
+
+  auto bundle = std::shared_ptr<AssetBundle>(new AssetBundle());
+  bundle->entry_count_ = Load<uint32_t>(contents.data() + 8);
+  bundle->bucket_count_ = Load<uint32_t>(contents.data() + 12);
+  bundle->alignment_ = Load<uint32_t>(contents.data() + 16);
+  bundle->buckets_offset_ = Load<uint64_t>(contents.data() + 24);
+  bundle->entries_offset_ = Load<uint64_t>(contents.data() + 32);
+  bundle->names_offset_ = Load<uint64_t>(contents.data() + 40);
+  const auto names_size = Load<uint64_t>(contents.data() + 48);
+  if (bundle->alignment_ == 0 || (bundle->alignment_ & (bundle->alignment_ - 1)) != 0) {
+    return absl::DataLossError(absl::StrCat("The asset bundle alignment is not a power of 2: ", bundle->alignment_));
+  }
+
+  // NOTE: validate the index once, so that the lookups don't need to check the bounds.
+  const uint64_t file_size = contents.size();
+  if (bundle->bucket_count_ == 0 || (bundle->bucket_count_ & (bundle->bucket_count_ - 1)) != 0 || bundle->bucket_count_ < bundle->entry_count_ ||
+      bundle->buckets_offset_ + 4ull * bundle->bucket_count_ > file_size || bundle->entries_offset_ + kEntrySize * bundle->entry_count_ > file_size ||
+      bundle->names_offset_ + names_size > file_size) {
+    return absl::DataLossError("The asset bundle index is corrupted");
+  }
+  bundle->file_ = std::move(file);
+  for (uint32_t i = 0; i < bundle->entry_count_; ++i) {
+    const auto entry = bundle->GetEntry(i);
+    if (uint64_t{entry.name_offset} + entry.name_size > names_size || entry.data_offset > file_size || entry.stored_size > file_size - entry.data_offset ||
+        (entry.compression == kNone && entry.stored_size != entry.size) || entry.compression > kZlib) {
+      return absl::DataLossError(absl::StrCat("The asset bundle entry ", i, " is corrupted"));
+    }
+  }
+  for (uint32_t i = 0; i < bundle->bucket_count_; ++i) {
+    if (Load<uint32_t>(bundle->file_->contents().data() + bundle->buckets_offset_ + 4ull * i) > bundle->entry_count_) {
+      return absl::DataLossError(absl::StrCat("The asset bundle bucket ", i, " is corrupted"));
+    }
+  }
+  return bundle;
+}
+
+bool AssetBundle::Contains(absl::string_view path) const { return FindByPath(path) >= 0; }
+
+absl::StatusOr<std::shared_ptr<const absl::string_view>> AssetBundle::Get(absl::string_view path) const {
+  const auto index = FindByPath(path);
+  if (index < 0) {
+    return absl::NotFoundError(absl::StrCat(path, " is not found in the asset bundle"));
+  }
+  const auto entry = GetEntry(static_cast<uint32_t>(index));
+  const auto stored = file_->contents().substr(entry.data_offset, entry.stored_size);
+
+  if (entry.compression == kNone) {
+    if (reinterpret_cast<uintptr_t>(stored.data()) % alignment_ == 0) {
+      auto buffer = std::make_shared<Buffer<std::shared_ptr<const MappedFile>>>();
+      buffer->owner = file_;
+      buffer->view = stored;
+      return std::shared_ptr<const absl::string_view>(buffer, &buffer->view);
+    }
+    // NOTE: the contents are aligned relative to the start of the bundle, so they are not aligned if the bundle is not (see aligned()).
+    // Copy them, since the consumers (e.g. TFLite) may require the alignment.
+    auto buffer = std::make_shared<AlignedBuffer>(stored.size(), alignment_);
+    std::memcpy(buffer->data, stored.data(), stored.size());
+    return std::shared_ptr<const absl::string_view>(buffer, &buffer->view);
+  }
+
+  auto buffer = std::make_shared<AlignedBuffer>(entry.size, alignment_);
+  auto size = static_cast<uLongf>(entry.size);
+  if (uncompress(reinterpret_cast<Bytef*>(buffer->data), &size, reinterpret_cast<const Bytef*>(stored.data()), static_cast<uLong>(stored.size())) != Z_OK ||
+      size != entry.size) {
+    return absl::DataLossError(absl::StrCat("Failed to decompress ", GetName(entry)));
+  }
+  return std::shared_ptr<const absl::string_view>(buffer, &buffer->view);
+}
+
+bool AssetBundle::aligned() const { return reinterpret_cast<uintptr_t>(file_->contents().data()) % alignment_ == 0; }
+
+AssetBundle::Entry AssetBundle::GetEntry(uint32_t index) const {
+  const auto* data = file_->contents().data() + entries_offset_ + kEntrySize * index;
+  Entry entry;
+  entry.hash = Load<uint64_t>(data);
+  entry.name_offset = Load<uint32_t>(data + 8);
+  entry.name_size = Load<uint32_t>(data + 12);
+  entry.data_offset = Load<uint64_t>(data + 16);
+  entry.stored_size = Load<uint64_t>(data + 24);
+  entry.size = Load<uint64_t>(data + 32);
+  entry.compression = Load<uint32_t>(data + 40);
+  entry.reserved = Load<uint32_t>(data + 44);
+  return entry;
+}
+
+absl::string_view AssetBundle::GetName(const Entry& entry) const { return file_->contents().substr(names_offset_ + entry.name_offset, entry.name_size); }
+
+int64_t AssetBundle::Find(absl::string_view name) const {
+  if (entry_count_ == 0) {
+    return -1;
+  }
+  // NOTE: the hash must be the same as the one written by the packer.
+  const auto hash = Fingerprint(name);
+  const auto mask = bucket_count_ - 1;
+  const auto* buckets = file_->contents().data() + buckets_offset_;
+  // NOTE: the table is at most half full, so an empty bucket is always found.
+  for (auto bucket = static_cast<uint32_t>(hash) & mask, probes = 0u; probes < bucket_count_; bucket = (bucket + 1) & mask, ++probes) {
+    const auto value = Load<uint32_t>(buckets + 4ull * bucket);
+    if (value == 0) {
+      return -1;
+    }
+    const auto entry = GetEntry(value - 1);
+    if (entry.hash == hash && GetName(entry) == name) {
+      return value - 1;
+    }
+  }
+  return -1;
+}
+
+int64_t AssetBundle::FindByPath(absl::string_view path) const {
+  if (auto index = Find(path); index >= 0) {
+    return index;
+  }
+  const auto base_name = GetBaseName(path);
+  return base_name.size() == path.size() ? -1 : Find(base_name);
+}
+
+}  // namespace mp_api
@@ -0,0 +1,75 @@
+// Copyright (c) 2026 homuler
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+#ifndef MEDIAPIPE_API_UTIL_ASSET_BUNDLE_H_
+#define MEDIAPIPE_API_UTIL_ASSET_BUNDLE_H_
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "absl/status/statusor.h"
+#include "absl/strings/string_view.h"
+#include "mediapipe_api/util/mapped_file.h"
+
+namespace mp_api {
+
+// A read-only view of the assets packed by pack_asset_bundle.py.
+//
+// The bundle is memory-mapped once, and the assets are looked up in its hash index without any file system calls.
+// The uncompressed assets are returned without being copied if the bundle is aligned (see aligned()).
+class AssetBundle {
+ public:
+  static absl::StatusOr<std::shared_ptr<const AssetBundle>> Open(const std::string& path, int64_t offset = 0, int64_t length = -1);
+  static absl::StatusOr<std::shared_ptr<const AssetBundle>> OpenDescriptor(int fd, int64_t offset = 0, int64_t length = -1);
+
+  // `path` matches an asset if it's the name of the asset or ends with "/" + the name (e.g. "mediapipe/modules/x.tflite" matches "x.tflite").
+  bool Contains(absl::string_view path) const;
+  // Returns the contents of the asset matched by `path`, which keep the bundle mapped while they are alive.
+  absl::StatusOr<std::shared_ptr<const absl::string_view>> Get(absl::string_view path) const;
+
+  int size() const { return static_cast<int>(entry_count_); }
+
+  // Returns false if the bundle is not aligned in the file (e.g. an asset in an APK, which is aligned to 4 bytes),
+  // in which case the uncompressed contents are copied onto the heap to keep their alignment.
+  bool aligned() const;
+
+ private:
+  struct Entry {
+    uint64_t hash;
+    uint32_t name_offset;
+    uint32_t name_size;
+    uint64_t data_offset;
+    uint64_t stored_size;
+    uint64_t size;
+    uint32_t compression;
+    uint32_t reserved;
+  };
+
+  static absl::StatusOr<std::shared_ptr<const AssetBundle>> Create(std::shared_ptr<const MappedFile> file);
+
+  AssetBundle() = default;
+
+  Entry GetEntry(uint32_t index) const;
+  absl::string_view GetName(const Entry& entry) const;
+  // Returns the index of the entry named `name`, or -1 if not found.
+  int64_t Find(absl::string_view name) const;
+  // Tries `path` first, and then its base name.
+  int64_t FindByPath(absl::string_view path) const;
+
+  std::shared_ptr<const MappedFile> file_;
+  uint32_t entry_count_ = 0;
+  uint32_t bucket_count_ = 0;
+  // The alignment of the contents relative to the start of the bundle.
+  uint32_t alignment_ = 1;
+  uint64_t buckets_offset_ = 0;
+  uint64_t entries_offset_ = 0;
+  uint64_t names_offset_ = 0;
+};
+
+}  // namespace mp_api
+
+#endif  // MEDIAPIPE_API_UTIL_ASSET_BUNDLE_H_
@@ -0,0 +1,101 @@
+// Copyright (c) 2026 homuler
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+#include "mediapipe_api/util/asset_bundle.h"
+
+#include <cstdint>
+#include <fstream>
+#include <iterator>
+#include <string>
+
+#include "absl/status/status.h"
+#include "gtest/gtest.h"
+
+namespace mp_api {
+namespace {
+
+// Packed by pack_asset_bundle.py with the default alignment, and labels.txt is compressed.
+constexpr char kBundlePath[] = "mediapipe_api/util/asset_bundle_testdata.bin";
+constexpr uintptr_t kAlignment = 64;
+
+std::string GetExpectedModel() { return std::string(1000, 'm'); }
+
+std::string GetExpectedLabels() {
+  std::string labels;
+  for (auto i = 0; i < 100; ++i) {
+    labels += "label" + std::to_string(i) + "\n";
+  }
+  return labels;
+}
+
+bool IsAligned(const absl::string_view& contents) { return reinterpret_cast<uintptr_t>(contents.data()) % kAlignment == 0; }
+
+TEST(AssetBundleTest, Get_ShouldReturnTheAsset_When_TheNameMatches) {
+  auto bundle = AssetBundle::Open(kBundlePath);
+  ASSERT_TRUE(bundle.ok()) << bundle.status();
+  EXPECT_EQ((*bundle)->size(), 2);
+  EXPECT_TRUE((*bundle)->aligned());
+
+  auto model = (*bundle)->Get("model.tflite");
+  ASSERT_TRUE(model.ok()) << model.status();
+  EXPECT_EQ(**model, GetExpectedModel());
+  EXPECT_TRUE(IsAligned(**model));
+
+  auto labels = (*bundle)->Get("labels.txt");
+  ASSERT_TRUE(labels.ok()) << labels.status();
+  EXPECT_EQ(**labels, GetExpectedLabels());
+  EXPECT_TRUE(IsAligned(**labels));
+}
+
+TEST(AssetBundleTest, Get_ShouldReturnTheAsset_When_ThePathEndsWithTheName) {
+  auto bundle = AssetBundle::Open(kBundlePath);
+  ASSERT_TRUE(bundle.ok()) << bundle.status();
+
+  EXPECT_TRUE((*bundle)->Contains("mediapipe/modules/model.tflite"));
+  auto model = (*bundle)->Get("mediapipe/modules/model.tflite");
+  ASSERT_TRUE(model.ok()) << model.status();
+  EXPECT_EQ(**model, GetExpectedModel());
+
+  auto labels = (*bundle)->Get("C:\\assets\\labels.txt");
+  ASSERT_TRUE(labels.ok()) << labels.status();
+  EXPECT_EQ(**labels, GetExpectedLabels());
+}
+
+TEST(AssetBundleTest, Get_ShouldReturnNotFound_When_TheAssetIsNotInTheBundle) {
+  auto bundle = AssetBundle::Open(kBundlePath);
+  ASSERT_TRUE(bundle.ok()) << bundle.status();
+
+  EXPECT_FALSE((*bundle)->Contains("model.tflite/labels"));
+  EXPECT_FALSE((*bundle)->Contains("odel.tflite"));
+  EXPECT_TRUE(absl::IsNotFound((*bundle)->Get("missing.tflite").status()));
+}
+
+TEST(AssetBundleTest, Get_ShouldReturnTheAlignedCopy_When_TheBundleIsNotAligned) {
+  std::ifstream source(kBundlePath, std::ios::binary);
+  const std::string contents{std::istreambuf_iterator<char>(source), std::istreambuf_iterator<char>()};
+  // NOTE: the bundle starts at an odd offset, as an asset in an APK may.
+  const auto path = ::testing::TempDir() + "/unaligned_asset_bundle.bin";
+  std::ofstream(path, std::ios::binary) << "x" << contents << "trailer";
+
+  auto bundle = AssetBundle::Open(path, 1, static_cast<int64_t>(contents.size()));
+  ASSERT_TRUE(bundle.ok()) << bundle.status();
+  EXPECT_FALSE((*bundle)->aligned());
+
+  auto model = (*bundle)->Get("model.tflite");
+  ASSERT_TRUE(model.ok()) << model.status();
+  EXPECT_EQ(**model, GetExpectedModel());
+  EXPECT_TRUE(IsAligned(**model));
+}
+
+TEST(AssetBundleTest, Open_ShouldFail_When_TheFileIsNotABundle) {
+  const auto path = ::testing::TempDir() + "/not_asset_bundle.bin";
+  std::ofstream(path, std::ios::binary) << std::string(100, 'x');
+
+  EXPECT_TRUE(absl::IsInvalidArgument(AssetBundle::Open(path).status()));
+}
+
+}  // namespace
+}  // namespace mp_api
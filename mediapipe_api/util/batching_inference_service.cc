@@ -0,0 +1,339 @@
+// Copyright (c) 2026 homuler
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+#include "mediapipe_api/util/batching_inference_service.h"
+
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+#include <utility>
+
+#include "absl/strings/str_cat.h"
+#include "absl/synchronization/notification.h"
+#include "mediapipe/framework/port/logging.h"
+#include "mediapipe/framework/port/status_macros.h"
+#include "mediapipe/tasks/cc/core/mediapipe_builtin_op_resolver.h"
+#include "mediapipe_api/framework/startup_profiler.h"
+#include "mediapipe_api/util/xnnpack_weight_cache.h"
+#include "tensorflow/lite/interpreter_builder.h"
+
+namespace mp_api {
+
+namespace {
+
+absl::StatusOr<mediapipe::Tensor::ElementType> ToElementType(TfLiteType type) {
+  switch (type) {
+    case kTfLiteFloat16:
+      return mediapipe::Tensor::ElementType::kFloat16;
+    case kTfLiteFloat32:
+      return mediapipe::Tensor::ElementType::kFloat32;
+    case kTfLiteUInt8:
+      return mediapipe::Tensor::ElementType::kUInt8;
+    case kTfLiteInt8:
+      return mediapipe::Tensor::ElementType::kInt8;
+    case kTfLiteInt32:
+      return mediapipe::Tensor::ElementType::kInt32;
+    case kTfLiteBool:
+      return mediapipe::Tensor::ElementType::kBool;
+    default:
+      return absl::UnimplementedError(absl::StrCat("Unsupported tensor type: ", TfLiteTypeGetName(type)));
+  }
+}
+
+}  // namespace
+
+struct BatchingInferenceService::Model::Request {
+  const std::vector<mediapipe::Tensor>* inputs;
+  absl::Time submitted_at;
+  absl::Status status;
+  std::vector<mediapipe::Tensor> outputs;
+  absl::Notification done;
+};
+
+BatchingInferenceService::Model::Model(BatchingInferenceService* service, SharedModelCache::Handle model_data)
+    : service_(service), model_data_(std::move(model_data)) {}
+
+BatchingInferenceService::Model::~Model() {
+  {
+    absl::MutexLock lock(&mutex_);
+    stopped_ = true;
+  }
+  if (thread_.joinable()) {
+    thread_.join();
+  }
+}
+
+absl::Status BatchingInferenceService::Model::Initialize() {
+  const auto start = absl::Now();
+  model_ = tflite::FlatBufferModel::VerifyAndBuildFromBuffer(model_data_->data(), model_data_->size());
+  if (model_ == nullptr) {
+    return absl::InvalidArgumentError("Failed to load the model");
+  }
+  op_resolver_ = std::make_unique<mediapipe::tasks::core::MediaPipeBuiltinOpResolver>();
+  if (tflite::InterpreterBuilder(*model_, *op_resolver_)(&interpreter_) != kTfLiteOk || interpreter_ == nullptr) {
+    return absl::InternalError("Failed to build the interpreter");
+  }
+  MP_RETURN_IF_ERROR(XnnpackWeightCache::GetInstance().Apply(*model_data_, 1, interpreter_.get()));
+  if (interpreter_->AllocateTensors() != kTfLiteOk) {
+    return absl::InternalError("Failed to allocate the tensors");
+  }
+  StartupProfiler::GetInstance().RecordActive(StartupPhaseType::kDelegateInit, "", start);
+  // NOTE: the requests are stacked along the first dimension, so it must be the batch dimension of size 1.
+  // Otherwise (e.g. the model takes a sequence of frames), the stacked tensors could be run but the results would be wrong.
+  auto has_batch_dimension = [](const TfLiteTensor* tensor) { return tensor->dims->size > 0 && tensor->dims->data[0] == 1; };
+  for (auto index : interpreter_->inputs()) {
+    const auto* tensor = interpreter_->tensor(index);
+    input_dims_.emplace_back(tensor->dims->data, tensor->dims->data + tensor->dims->size);
+    input_bytes_.push_back(tensor->bytes);
+    batching_supported_ &= has_batch_dimension(tensor);
+  }
+  for (auto index : interpreter_->outputs()) {
+    batching_supported_ &= has_batch_dimension(interpreter_->tensor(index));
+  }
+  thread_ = std::thread([this] { RunLoop(); });
+  return absl::OkStatus();
+}
+
+absl::StatusOr<std::vector<mediapipe::Tensor>> BatchingInferenceService::Model::Run(const std::vector<mediapipe::Tensor>& inputs) {
+  if (inputs.size() != input_bytes_.size()) {
+    return absl::InvalidArgumentError(absl::StrCat("The model requires ", input_bytes_.size(), " input tensors, but got ", inputs.size()));
+  }
+  for (size_t i = 0; i < inputs.size(); ++i) {
+    if (inputs[i].bytes() != input_bytes_[i]) {
+      return absl::InvalidArgumentError(absl::StrCat("The size of the input tensor ", i, " must be ", input_bytes_[i], ", but got ", inputs[i].bytes()));
+    }
+  }
+
+  Request request;
+  request.inputs = &inputs;
+  request.submitted_at = absl::Now();
+  {
+    absl::MutexLock lock(&mutex_);
+    queue_.push_back(&request);
+  }
+  request.done.WaitForNotification();
+  service_->RecordLatency(absl::Now() - request.submitted_at);
+
+  MP_RETURN_IF_ERROR(request.status);
+  return std::move(request.outputs);
+}
+
+void BatchingInferenceService::Model::RunLoop() {
+  while (true) {
+    int max_batch_size;
+    absl::Duration max_wait;
+    service_->GetWindow(&max_batch_size, &max_wait);
+
+    std::vector<Request*> batch;
+    {
+      absl::MutexLock lock(&mutex_);
+      auto has_request = [this]() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mutex_) { return stopped_ || !queue_.empty(); };
+      mutex_.Await(absl::Condition(&has_request));
+      if (queue_.empty()) {
+        return;
+      }
+
+      // Wait for the other graphs to submit their requests.
+      auto is_full = [this, max_batch_size]() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mutex_) {
+        return stopped_ || queue_.size() >= static_cast<size_t>(max_batch_size);
+      };
+      mutex_.AwaitWithDeadline(absl::Condition(&is_full), queue_.front()->submitted_at + max_wait);
+
+      while (!queue_.empty() && batch.size() < static_cast<size_t>(max_batch_size)) {
+        batch.push_back(queue_.front());
+        queue_.pop_front();
+      }
+    }
+    RunBatch(batch);
+  }
+}
+
+void BatchingInferenceService::Model::RunBatch(std::vector<Request*>& batch) {
+  service_->RecordBatch(batch.size());
+
+  bool batched = false;
+  if (batch.size() > 1 && batching_supported_) {
+    auto status = Invoke(batch.data(), batch.size());
+    if (absl::IsFailedPrecondition(status)) {
+      LOG(WARNING) << "The model cannot be run in batches, so the requests are run one by one: " << status;
+      batching_supported_ = false;
+    } else {
+      for (auto* request : batch) {
+        request->status = status;
+      }
+      batched = true;
+    }
+  }
+  if (!batched) {
+    for (auto* request : batch) {
+      request->status = Invoke(&request, 1);
+    }
+  }
+  for (auto* request : batch) {
+    request->done.Notify();
+  }
+}
+
+absl::Status BatchingInferenceService::Model::Invoke(Request* const* requests, int batch_size) {
+  MP_RETURN_IF_ERROR(ResizeInputs(batch_size));
+
+  for (size_t i = 0; i < input_bytes_.size(); ++i) {
+    auto* tensor = interpreter_->input_tensor(i);
+    for (auto j = 0; j < batch_size; ++j) {
+      auto view = (*requests[j]->inputs)[i].GetCpuReadView();
+      std::memcpy(tensor->data.raw + j * input_bytes_[i], view.buffer<char>(), input_bytes_[i]);
+    }
+  }
+  if (interpreter_->Invoke() != kTfLiteOk) {
+    return absl::InternalError("Failed to invoke the interpreter");
+  }
+
+  for (auto j = 0; j < batch_size; ++j) {
+    requests[j]->outputs.clear();
+  }
+  for (size_t i = 0; i < interpreter_->outputs().size(); ++i) {
+    const auto* tensor = interpreter_->output_tensor(i);
+    // NOTE: the outputs of a single request, which can be scalars, are returned as they are.
+    if (batch_size > 1 && (tensor->dims->size == 0 || tensor->dims->data[0] != batch_size)) {
+      return absl::FailedPreconditionError(absl::StrCat("The batch dimension of the output tensor ", i, " is not ", batch_size));
+    }
+    MP_ASSIGN_OR_RETURN(auto element_type, ToElementType(tensor->type));
+    std::vector<int> dims(tensor->dims->data, tensor->dims->data + tensor->dims->size);
+    if (batch_size > 1) {
+      dims[0] = 1;
+    }
+    const auto bytes = tensor->bytes / batch_size;
+
+    for (auto j = 0; j < batch_size; ++j) {
+      auto& output = requests[j]->outputs.emplace_back(element_type, mediapipe::Tensor::Shape(dims),
+                                                       mediapipe::Tensor::QuantizationParameters(tensor->params.scale, tensor->params.zero_point));
+      auto view = output.GetCpuWriteView();
+      std::memcpy(view.buffer<char>(), tensor->data.raw + j * bytes, bytes);
+    }
+  }
+  return absl::OkStatus();
+}
+
+absl::Status BatchingInferenceService::Model::ResizeInputs(int batch_size) {
+  if (batch_size == allocated_batch_size_) {
+    return absl::OkStatus();
+  }
+
+  auto resize = [this](int batch_size) {
+    for (size_t i = 0; i < input_dims_.size(); ++i) {
+      auto dims = input_dims_[i];
+      if (!dims.empty()) {
+        dims[0] *= batch_size;
+      }
+      if (interpreter_->ResizeInputTensor(interpreter_->inputs()[i], dims) != kTfLiteOk) {
+        return false;
+      }
+    }
+    return interpreter_->AllocateTensors() == kTfLiteOk;
+  };
+  if (resize(batch_size)) {
+    allocated_batch_size_ = batch_size;
+    return absl::OkStatus();
+  }
+
+  // Restore the original shapes, which must succeed.
+  if (!resize(1)) {
+    allocated_batch_size_ = 0;
+    return absl::InternalError("Failed to restore the input tensors");
+  }
+  allocated_batch_size_ = 1;
+  return absl::FailedPreconditionError(absl::StrCat("Failed to resize the input tensors for batch size ", batch_size));
+}
+
+BatchingInferenceService& BatchingInferenceService::GetInstance() {
+  static auto* instance = new BatchingInferenceService();
+  return *instance;
+}
+
+absl::StatusOr<std::shared_ptr<BatchingInferenceService::Model>> BatchingInferenceService::Acquire(const std::string& model_path) {
+  {
+    absl::MutexLock lock(&mutex_);
+    if (auto it = models_.find(model_path); it != models_.end()) {
+      if (auto model = it->second.lock()) {
+        return model;
+      }
+      models_.erase(it);
+    }
+  }
+
+  // NOTE: the model is loaded without the lock, so that the other models can be loaded and the running ones can fetch the window meanwhile.
+  MP_ASSIGN_OR_RETURN(auto model_data, SharedModelCache::GetInstance().AcquireFile(model_path));
+  auto model = std::shared_ptr<Model>(new Model(this, std::move(model_data)));
+  MP_RETURN_IF_ERROR(model->Initialize());
+
+  absl::MutexLock lock(&mutex_);
+  auto& entry = models_[model_path];
+  if (auto loaded = entry.lock()) {
+    // Another graph has loaded the same model meanwhile, so share it and discard this one.
+    return loaded;
+  }
+  entry = model;
+  return model;
+}
+
+absl::Status BatchingInferenceService::Configure(int max_batch_size, absl::Duration max_wait) {
+  if (max_batch_size <= 0) {
+    return absl::InvalidArgumentError(absl::StrCat("max_batch_size must be positive, but got ", max_batch_size));
+  }
+  if (max_wait < absl::ZeroDuration()) {
+    return absl::InvalidArgumentError(absl::StrCat("max_wait must not be negative, but got ", absl::FormatDuration(max_wait)));
+  }
+  absl::MutexLock lock(&mutex_);
+  max_batch_size_ = max_batch_size;
+  max_wait_ = max_wait;
+  return absl::OkStatus();
+}
+
+BatchingInferenceStats BatchingInferenceService::GetStats() {
+  absl::MutexLock lock(&stats_mutex_);
+  return stats_;
+}
+
+void BatchingInferenceService::ResetStats() {
+  absl::MutexLock lock(&stats_mutex_);
+  stats_ = {};
+}
+
+void BatchingInferenceService::GetWindow(int* max_batch_size, absl::Duration* max_wait) {
+  absl::MutexLock lock(&mutex_);
+  *max_batch_size = max_batch_size_;
+  *max_wait = max_wait_;
+}
+
+void BatchingInferenceService::RecordBatch(int batch_size) {
+  absl::MutexLock lock(&stats_mutex_);
+  ++stats_.batches;
+  ++stats_.batch_size_counts[std::min(batch_size, kBatchSizeHistogramSize) - 1];
+}
+
+void BatchingInferenceService::RecordLatency(absl::Duration latency) {
+  const auto latency_us = absl::ToInt64Microseconds(latency);
+  const auto* bound = std::upper_bound(std::begin(kLatencyHistogramBoundsUs), std::end(kLatencyHistogramBoundsUs), latency_us);
+
+  absl::MutexLock lock(&stats_mutex_);
+  ++stats_.requests;
+  ++stats_.latency_counts[bound - std::begin(kLatencyHistogramBoundsUs)];
+}
+
+}  // namespace mp_api
+
+MpReturnCode mp_BatchingInferenceService__Configure__i_ll(int max_batch_size, int64_t max_wait_us, absl::Status** status_out) {
+  TRY
+    *status_out = new absl::Status{mp_api::BatchingInferenceService::GetInstance().Configure(max_batch_size, absl::Microseconds(max_wait_us))};
+    RETURN_CODE(MpReturnCode::Success);
+  CATCH_EXCEPTION
+}
+
+void mp_BatchingInferenceService__GetStats(mp_api::BatchingInferenceStats* stats_out) {
+  *stats_out = mp_api::BatchingInferenceService::GetInstance().GetStats();
+}
+
+void mp_BatchingInferenceService__ResetStats() { mp_api::BatchingInferenceService::GetInstance().ResetStats(); }
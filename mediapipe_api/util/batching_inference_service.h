@@ -0,0 +1,134 @@
+// Copyright (c) 2026 homuler
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+#ifndef MEDIAPIPE_API_UTIL_BATCHING_INFERENCE_SERVICE_H_
+#define MEDIAPIPE_API_UTIL_BATCHING_INFERENCE_SERVICE_H_
+
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "absl/synchronization/mutex.h"
+#include "absl/time/time.h"
+#include "mediapipe/framework/formats/tensor.h"
+#include "mediapipe_api/common.h"
+#include "mediapipe_api/tasks/cc/core/shared_model_cache.h"
+#include "tensorflow/lite/core/api/op_resolver.h"
+#include "tensorflow/lite/interpreter.h"
+#include "tensorflow/lite/model_builder.h"
+
+namespace mp_api {
+
+// The number of the buckets of the batch size histogram. The last bucket counts the batches of this size or larger.
+constexpr int kBatchSizeHistogramSize = 16;
+// The number of the buckets of the latency histogram.
+constexpr int kLatencyHistogramSize = 12;
+// The upper bounds (exclusive) of the latency histogram buckets except the last one, in microseconds.
+constexpr int64_t kLatencyHistogramBoundsUs[kLatencyHistogramSize - 1] = {100, 200, 500, 1000, 2000, 5000, 10000, 20000, 50000, 100000, 200000};
+
+struct BatchingInferenceStats {
+  int64_t requests;
+  int64_t batches;
+  // batch_size_counts[i] is the number of the batches of size i + 1.
+  int64_t batch_size_counts[kBatchSizeHistogramSize];
+  // The time from when a request is submitted until its result is ready.
+  int64_t latency_counts[kLatencyHistogramSize];
+};
+
+// A process-wide service that runs the requests for the same TFLite model from multiple graphs together.
+//
+// The requests are collected until `max_batch_size` requests arrive or the oldest one has waited for `max_wait`,
+// and then they are stacked along the first dimension and run by one invocation.
+// The first dimension of every input and output tensor must be the batch dimension, whose size is 1 in the model.
+// Otherwise, or if the model cannot be resized to the batch size, the collected requests are run one by one on the same interpreter.
+class BatchingInferenceService {
+ public:
+  // An interpreter of a model, which is shared by the graphs while they use it.
+  class Model {
+   public:
+    ~Model();
+
+    // Submits `inputs` and waits until the batch containing it is run.
+    absl::StatusOr<std::vector<mediapipe::Tensor>> Run(const std::vector<mediapipe::Tensor>& inputs);
+
+   private:
+    friend class BatchingInferenceService;
+
+    struct Request;
+
+    Model(BatchingInferenceService* service, SharedModelCache::Handle model_data);
+
+    absl::Status Initialize();
+    void RunLoop();
+    void RunBatch(std::vector<Request*>& batch);
+    // Runs `requests` by one invocation. Returns kFailedPrecondition if the model cannot be run with that batch size.
+    absl::Status Invoke(Request* const* requests, int batch_size);
+    absl::Status ResizeInputs(int batch_size);
+
+    BatchingInferenceService* service_;
+    // NOTE: the model data must outlive the interpreter.
+    SharedModelCache::Handle model_data_;
+    std::unique_ptr<tflite::FlatBufferModel> model_;
+    // NOTE: the op resolver must outlive the interpreter.
+    std::unique_ptr<tflite::OpResolver> op_resolver_;
+    std::unique_ptr<tflite::Interpreter> interpreter_;
+    // The input shapes and sizes for a single request.
+    std::vector<std::vector<int>> input_dims_;
+    std::vector<size_t> input_bytes_;
+    int allocated_batch_size_ = 1;
+    bool batching_supported_ = true;
+
+    absl::Mutex mutex_;
+    std::deque<Request*> queue_ ABSL_GUARDED_BY(mutex_);
+    bool stopped_ ABSL_GUARDED_BY(mutex_) = false;
+    std::thread thread_;
+  };
+
+  static BatchingInferenceService& GetInstance();
+
+  // Returns the shared interpreter of the model at `model_path`, which is created if no graph uses it.
+  absl::StatusOr<std::shared_ptr<Model>> Acquire(const std::string& model_path);
+
+  // The new values are applied from the next batch.
+  absl::Status Configure(int max_batch_size, absl::Duration max_wait);
+
+  BatchingInferenceStats GetStats();
+  void ResetStats();
+
+ private:
+  BatchingInferenceService() = default;
+
+  void GetWindow(int* max_batch_size, absl::Duration* max_wait);
+  void RecordBatch(int batch_size);
+  void RecordLatency(absl::Duration latency);
+
+  absl::Mutex mutex_;
+  absl::flat_hash_map<std::string, std::weak_ptr<Model>> models_ ABSL_GUARDED_BY(mutex_);
+  int max_batch_size_ ABSL_GUARDED_BY(mutex_) = 8;
+  absl::Duration max_wait_ ABSL_GUARDED_BY(mutex_) = absl::Milliseconds(2);
+
+  absl::Mutex stats_mutex_;
+  BatchingInferenceStats stats_ ABSL_GUARDED_BY(stats_mutex_) = {};
+};
+
+}  // namespace mp_api
+
+extern "C" {
+
+MP_CAPI(MpReturnCode) mp_BatchingInferenceService__Configure__i_ll(int max_batch_size, int64_t max_wait_us, absl::Status** status_out);
+MP_CAPI(void) mp_BatchingInferenceService__GetStats(mp_api::BatchingInferenceStats* stats_out);
+MP_CAPI(void) mp_BatchingInferenceService__ResetStats();
+
+}  // extern "C"
+
+#endif  // MEDIAPIPE_API_UTIL_BATCHING_INFERENCE_SERVICE_H_
@@ -0,0 +1,163 @@
+// Copyright (c) 2026 homuler
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+#include "mediapipe_api/util/batching_inference_service.h"
+
+#include <algorithm>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "absl/strings/str_cat.h"
+#include "absl/time/time.h"
+#include "flatbuffers/flatbuffers.h"
+#include "gtest/gtest.h"
+#include "mediapipe/framework/formats/tensor.h"
+#include "tensorflow/lite/schema/schema_generated.h"
+
+namespace mp_api {
+namespace {
+
+constexpr int kNumRequests = 4;
+
+// Builds a model that takes a float tensor of `input_shape`.
+// If `reduce_axis` is negative, it returns `input + input`. Otherwise, it returns the sum of `input` along `reduce_axis`.
+std::string BuildModel(const std::vector<int32_t>& input_shape, int reduce_axis) {
+  flatbuffers::FlatBufferBuilder builder;
+  std::vector<flatbuffers::Offset<tflite::Buffer>> buffers = {tflite::CreateBuffer(builder)};
+  std::vector<flatbuffers::Offset<tflite::Tensor>> tensors;
+  tensors.push_back(tflite::CreateTensor(builder, builder.CreateVector(input_shape), tflite::TensorType_FLOAT32, 0, builder.CreateString("input")));
+
+  auto output_shape = input_shape;
+  std::vector<int32_t> op_inputs = {0, 0};
+  tflite::BuiltinOperator op = tflite::BuiltinOperator_ADD;
+  auto options_type = tflite::BuiltinOptions_AddOptions;
+  auto options = tflite::CreateAddOptions(builder).Union();
+  if (reduce_axis >= 0) {
+    const int32_t axis = reduce_axis;
+    buffers.push_back(tflite::CreateBuffer(builder, builder.CreateVector(reinterpret_cast<const uint8_t*>(&axis), sizeof(axis))));
+    tensors.push_back(tflite::CreateTensor(builder, builder.CreateVector(std::vector<int32_t>{1}), tflite::TensorType_INT32, 1, builder.CreateString("axis")));
+    output_shape.erase(output_shape.begin() + reduce_axis);
+    op_inputs = {0, 1};
+    op = tflite::BuiltinOperator_SUM;
+    options_type = tflite::BuiltinOptions_ReducerOptions;
+    options = tflite::CreateReducerOptions(builder, /* keep_dims= */ false).Union();
+  }
+  const int32_t output_index = static_cast<int32_t>(tensors.size());
+  tensors.push_back(tflite::CreateTensor(builder, builder.CreateVector(output_shape), tflite::TensorType_FLOAT32, 0, builder.CreateString("output")));
+
+  auto opcodes = std::vector<flatbuffers::Offset<tflite::OperatorCode>>{tflite::CreateOperatorCode(builder, static_cast<int8_t>(op), 0, 1, op)};
+  auto operators = std::vector<flatbuffers::Offset<tflite::Operator>>{
+      tflite::CreateOperator(builder, 0, builder.CreateVector(op_inputs), builder.CreateVector(std::vector<int32_t>{output_index}), options_type, options)};
+  auto subgraphs = std::vector<flatbuffers::Offset<tflite::SubGraph>>{
+      tflite::CreateSubGraph(builder, builder.CreateVector(tensors), builder.CreateVector(std::vector<int32_t>{0}),
+                             builder.CreateVector(std::vector<int32_t>{output_index}), builder.CreateVector(operators))};
+  auto model = tflite::CreateModel(builder, TFLITE_SCHEMA_VERSION, builder.CreateVector(opcodes), builder.CreateVector(subgraphs),
+                                   builder.CreateString("test"), builder.CreateVector(buffers));
+  tflite::FinishModelBuffer(builder, model);
+  return std::string(reinterpret_cast<const char*>(builder.GetBufferPointer()), builder.GetSize());
+}
+
+std::string WriteModel(const std::string& name, const std::string& model) {
+  const auto path = absl::StrCat(testing::TempDir(), "/", name);
+  std::ofstream(path, std::ios::binary) << model;
+  return path;
+}
+
+mediapipe::Tensor CreateTensor(const std::vector<int>& shape, const std::vector<float>& values) {
+  mediapipe::Tensor tensor(mediapipe::Tensor::ElementType::kFloat32, mediapipe::Tensor::Shape(shape));
+  auto view = tensor.GetCpuWriteView();
+  std::copy(values.begin(), values.end(), view.buffer<float>());
+  return tensor;
+}
+
+std::vector<float> ReadValues(const mediapipe::Tensor& tensor) {
+  auto view = tensor.GetCpuReadView();
+  const auto* buffer = view.buffer<float>();
+  return std::vector<float>(buffer, buffer + tensor.shape().num_elements());
+}
+
+// Runs `inputs[i]` on `kNumRequests` threads at the same time, so that they are run in one batch if possible.
+std::vector<absl::StatusOr<std::vector<mediapipe::Tensor>>> RunConcurrently(BatchingInferenceService::Model* model,
+                                                                            const std::vector<std::vector<mediapipe::Tensor>>& inputs) {
+  std::vector<absl::StatusOr<std::vector<mediapipe::Tensor>>> results(inputs.size(), absl::UnknownError("Not run"));
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < inputs.size(); ++i) {
+    threads.emplace_back([model, &inputs, &results, i]() { results[i] = model->Run(inputs[i]); });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  return results;
+}
+
+class BatchingInferenceServiceTest : public testing::Test {
+ protected:
+  void SetUp() override {
+    // NOTE: the requests wait long enough for the others, but the batch is run as soon as all of them arrive.
+    ASSERT_TRUE(BatchingInferenceService::GetInstance().Configure(kNumRequests, absl::Seconds(10)).ok());
+    BatchingInferenceService::GetInstance().ResetStats();
+  }
+};
+
+TEST_F(BatchingInferenceServiceTest, Run_ShouldScatterBatchedResults) {
+  auto model = BatchingInferenceService::GetInstance().Acquire(WriteModel("batched_add.tflite", BuildModel({1, 3}, -1)));
+  ASSERT_TRUE(model.ok()) << model.status();
+
+  std::vector<std::vector<mediapipe::Tensor>> inputs;
+  for (auto i = 0; i < kNumRequests; ++i) {
+    std::vector<mediapipe::Tensor> tensors;
+    tensors.push_back(CreateTensor({1, 3}, {static_cast<float>(i), i + 0.5f, -i * 1.0f}));
+    inputs.push_back(std::move(tensors));
+  }
+  auto results = RunConcurrently(model->get(), inputs);
+
+  for (auto i = 0; i < kNumRequests; ++i) {
+    ASSERT_TRUE(results[i].ok()) << results[i].status();
+    ASSERT_EQ(results[i]->size(), 1);
+    EXPECT_EQ((*results[i])[0].shape().dims, std::vector<int>({1, 3}));
+    EXPECT_EQ(ReadValues((*results[i])[0]), std::vector<float>({2.0f * i, 2 * i + 1.0f, -2.0f * i}));
+  }
+  const auto stats = BatchingInferenceService::GetInstance().GetStats();
+  EXPECT_EQ(stats.requests, kNumRequests);
+  EXPECT_EQ(stats.batches, 1);
+  EXPECT_EQ(stats.batch_size_counts[kNumRequests - 1], 1);
+}
+
+TEST_F(BatchingInferenceServiceTest, Run_ShouldNotStackInputs_When_FirstDimensionIsNotBatch) {
+  // NOTE: stacking [2, 3] inputs along the first dimension would sum the inputs of the different requests.
+  auto model = BatchingInferenceService::GetInstance().Acquire(WriteModel("unbatched_sum.tflite", BuildModel({2, 3}, 0)));
+  ASSERT_TRUE(model.ok()) << model.status();
+
+  std::vector<std::vector<mediapipe::Tensor>> inputs;
+  for (auto i = 0; i < kNumRequests; ++i) {
+    std::vector<mediapipe::Tensor> tensors;
+    tensors.push_back(CreateTensor({2, 3}, {1.0f * i, 2.0f * i, 3.0f * i, 1, 1, 1}));
+    inputs.push_back(std::move(tensors));
+  }
+  auto results = RunConcurrently(model->get(), inputs);
+
+  for (auto i = 0; i < kNumRequests; ++i) {
+    ASSERT_TRUE(results[i].ok()) << results[i].status();
+    ASSERT_EQ(results[i]->size(), 1);
+    EXPECT_EQ((*results[i])[0].shape().dims, std::vector<int>({3}));
+    EXPECT_EQ(ReadValues((*results[i])[0]), std::vector<float>({i + 1.0f, 2.0f * i + 1, 3.0f * i + 1}));
+  }
+}
+
+TEST_F(BatchingInferenceServiceTest, Run_ShouldFail_When_InputSizeIsWrong) {
+  auto model = BatchingInferenceService::GetInstance().Acquire(WriteModel("invalid_input_add.tflite", BuildModel({1, 3}, -1)));
+  ASSERT_TRUE(model.ok()) << model.status();
+
+  std::vector<mediapipe::Tensor> inputs;
+  inputs.push_back(CreateTensor({1, 2}, {1, 2}));
+  auto result = (*model)->Run(inputs);
+  EXPECT_TRUE(absl::IsInvalidArgument(result.status())) << result.status();
+}
+
+}  // namespace
+}  // namespace mp_api
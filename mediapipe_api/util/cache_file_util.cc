@@ -0,0 +1,124 @@
+// Copyright (c) 2026 homuler
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+#include "mediapipe_api/util/cache_file_util.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <dlfcn.h>
+#include <sys/stat.h>
+#endif
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <vector>
+
+#include "absl/strings/str_cat.h"
+#include "mediapipe/framework/calculator_base.h"
+#include "mediapipe/framework/port/logging.h"
+#include "mediapipe/framework/subgraph.h"
+
+namespace mp_api {
+
+namespace {
+
+constexpr uint64_t kFnvOffsetBasis = 14695981039346656037ull;
+constexpr uint64_t kFnvPrime = 1099511628211ull;
+
+template <typename Names>
+void AppendSortedNames(const Names& names, std::string* out) {
+  std::vector<std::string> sorted_names(names.begin(), names.end());
+  std::sort(sorted_names.begin(), sorted_names.end());
+  for (const auto& name : sorted_names) {
+    absl::StrAppend(out, name, "\n");
+  }
+}
+
+// Returns the size and the modification time of the library file, or an empty string if it cannot be found (e.g. in an APK).
+std::string GetLibraryFileInfo() {
+#ifdef _WIN32
+  HMODULE module;
+  if (!GetModuleHandleExW(GET_MODULE_HANDLE_EX_FLAG_FROM_ADDRESS | GET_MODULE_HANDLE_EX_FLAG_UNCHANGED_REFCOUNT,
+                          reinterpret_cast<LPCWSTR>(&GetBuildFingerprint), &module)) {
+    return "";
+  }
+  wchar_t path[MAX_PATH];
+  const auto size = GetModuleFileNameW(module, path, MAX_PATH);
+  WIN32_FILE_ATTRIBUTE_DATA data;
+  if (size == 0 || size == MAX_PATH || !GetFileAttributesExW(path, GetFileExInfoStandard, &data)) {
+    return "";
+  }
+  return absl::StrCat(data.nFileSizeHigh, ":", data.nFileSizeLow, ":", data.ftLastWriteTime.dwHighDateTime, ":", data.ftLastWriteTime.dwLowDateTime);
+#else
+  Dl_info info;
+  struct stat st;
+  if (dladdr(reinterpret_cast<void*>(&GetBuildFingerprint), &info) == 0 || info.dli_fname == nullptr || stat(info.dli_fname, &st) != 0) {
+    return "";
+  }
+  return absl::StrCat(st.st_size, ":", st.st_mtime);
+#endif
+}
+
+}  // namespace
+
+uint64_t Fingerprint(absl::string_view data) {
+  uint64_t hash = kFnvOffsetBasis;
+  for (unsigned char c : data) {
+    hash ^= c;
+    hash *= kFnvPrime;
+  }
+  return hash;
+}
+
+uint64_t FastFingerprint(absl::string_view data) {
+  uint64_t hash = kFnvOffsetBasis;
+  size_t i = 0;
+  for (; i + sizeof(uint64_t) <= data.size(); i += sizeof(uint64_t)) {
+    uint64_t word;
+    std::memcpy(&word, data.data() + i, sizeof(word));
+    hash = (hash ^ word) * kFnvPrime;
+  }
+  for (; i < data.size(); ++i) {
+    hash = (hash ^ static_cast<unsigned char>(data[i])) * kFnvPrime;
+  }
+  return (hash ^ data.size()) * kFnvPrime;
+}
+
+uint64_t GetBuildFingerprint() {
+  // NOTE: the calculators and the subgraphs are registered by the static initializers, so they don't change after the library is loaded.
+  static const uint64_t fingerprint = []() {
+    std::string build;
+    AppendSortedNames(mediapipe::CalculatorBaseRegistry::GetRegisteredNames(), &build);
+    AppendSortedNames(mediapipe::SubgraphRegistry::GetRegisteredNames(), &build);
+    absl::StrAppend(&build, GetLibraryFileInfo());
+    return Fingerprint(build);
+  }();
+  return fingerprint;
+}
+
+bool WriteFileAtomically(const std::string& path, absl::FunctionRef<bool(std::ostream&)> write) {
+  const auto temp_path = absl::StrCat(path, ".tmp");
+  {
+    std::ofstream file(temp_path, std::ios::binary | std::ios::trunc);
+    if (!file || !write(file) || !file.flush()) {
+      LOG(WARNING) << "Failed to write " << temp_path;
+      file.close();
+      std::remove(temp_path.c_str());
+      return false;
+    }
+  }
+  // NOTE: std::rename fails on Windows if `path` exists.
+  if (std::rename(temp_path.c_str(), path.c_str()) != 0 && (std::remove(path.c_str()) != 0 || std::rename(temp_path.c_str(), path.c_str()) != 0)) {
+    std::remove(temp_path.c_str());
+    return false;
+  }
+  return true;
+}
+
+}  // namespace mp_api
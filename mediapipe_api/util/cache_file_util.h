@@ -0,0 +1,39 @@
+// Copyright (c) 2026 homuler
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+#ifndef MEDIAPIPE_API_UTIL_CACHE_FILE_UTIL_H_
+#define MEDIAPIPE_API_UTIL_CACHE_FILE_UTIL_H_
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+
+#include "absl/functional/function_ref.h"
+#include "absl/strings/string_view.h"
+
+namespace mp_api {
+
+// Written in the host byte order, so that the files written on a host of the other endianness can be rejected.
+inline constexpr uint32_t kByteOrderMark = 0x01020304;
+
+// FNV-1a, which is used instead of absl::Hash because the values must be stable across processes.
+uint64_t Fingerprint(absl::string_view data);
+// FNV-1a over 8-byte words, which is much faster than Fingerprint for large data (e.g. models).
+// The value depends on the byte order, so it must not be compared across hosts.
+uint64_t FastFingerprint(absl::string_view data);
+
+// Identifies the build of the library: the registered calculators and subgraphs, and the library file itself if it can be found.
+// The files that depend on the behavior of the library (e.g. expanded configs) must be rejected if it's changed.
+uint64_t GetBuildFingerprint();
+
+// Writes a file to `path` by calling `write`, which returns false if it fails.
+// The file is written to a temporary path and renamed, so that other processes never read a partially written file.
+// Returns false if the file cannot be written, in which case `path` is not changed.
+bool WriteFileAtomically(const std::string& path, absl::FunctionRef<bool(std::ostream&)> write);
+
+}  // namespace mp_api
+
+#endif  // MEDIAPIPE_API_UTIL_CACHE_FILE_UTIL_H_
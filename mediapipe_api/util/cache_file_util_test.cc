@@ -0,0 +1,71 @@
+// Copyright (c) 2026 homuler
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+#include "mediapipe_api/util/cache_file_util.h"
+
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <string>
+
+#include "gtest/gtest.h"
+
+namespace mp_api {
+namespace {
+
+std::string GetTestFilePath(const std::string& name) { return ::testing::TempDir() + "/" + name; }
+
+std::string ReadFile(const std::string& path) {
+  std::ifstream file(path, std::ios::binary);
+  return std::string{std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+}
+
+bool Exists(const std::string& path) { return std::ifstream(path).good(); }
+
+TEST(CacheFileUtilTest, Fingerprint_ShouldReturnFnv1a) {
+  EXPECT_EQ(Fingerprint(""), 14695981039346656037ull);
+  EXPECT_EQ(Fingerprint("a"), 0xaf63dc4c8601ec8cull);
+  EXPECT_EQ(Fingerprint("foobar"), 0x85944171f73967e8ull);
+}
+
+// NOTE: the values are computed on a little-endian host.
+TEST(CacheFileUtilTest, FastFingerprint_ShouldReturnFnv1aOverWords) {
+  EXPECT_EQ(FastFingerprint(""), 0xaf63bd4c8601b7dfull);
+  EXPECT_EQ(FastFingerprint("foobar"), 0x345322a7168b996aull);
+  EXPECT_EQ(FastFingerprint("0123456789abcdef!"), 0x24714d62cbeb1f57ull);
+}
+
+TEST(CacheFileUtilTest, GetBuildFingerprint_ShouldReturnTheSameValue) { EXPECT_EQ(GetBuildFingerprint(), GetBuildFingerprint()); }
+
+TEST(CacheFileUtilTest, WriteFileAtomically_ShouldReplaceTheFile) {
+  const auto path = GetTestFilePath("replace.bin");
+  ASSERT_TRUE(WriteFileAtomically(path, [](std::ostream& file) { return static_cast<bool>(file << "old"); }));
+  ASSERT_TRUE(WriteFileAtomically(path, [](std::ostream& file) { return static_cast<bool>(file << "new"); }));
+
+  EXPECT_EQ(ReadFile(path), "new");
+  EXPECT_FALSE(Exists(path + ".tmp"));
+  std::remove(path.c_str());
+}
+
+TEST(CacheFileUtilTest, WriteFileAtomically_ShouldKeepTheFile_When_WriteFails) {
+  const auto path = GetTestFilePath("keep.bin");
+  ASSERT_TRUE(WriteFileAtomically(path, [](std::ostream& file) { return static_cast<bool>(file << "old"); }));
+
+  EXPECT_FALSE(WriteFileAtomically(path, [](std::ostream& file) {
+    file << "partial";
+    return false;
+  }));
+  EXPECT_EQ(ReadFile(path), "old");
+  EXPECT_FALSE(Exists(path + ".tmp"));
+  std::remove(path.c_str());
+}
+
+TEST(CacheFileUtilTest, WriteFileAtomically_ShouldFail_When_DirectoryDoesNotExist) {
+  EXPECT_FALSE(WriteFileAtomically(GetTestFilePath("missing/file.bin"), [](std::ostream& file) { return true; }));
+}
+
+}  // namespace
+}  // namespace mp_api
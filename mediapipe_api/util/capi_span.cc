@@ -0,0 +1,164 @@
+// Copyright (c) 2026 homuler
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+#include "mediapipe_api/util/capi_span.h"
+
+#include <algorithm>
+#include <deque>
+#include <memory>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/strings/string_view.h"
+#include "absl/synchronization/mutex.h"
+
+namespace mp_api {
+
+namespace {
+
+// The number of the events kept while tracing.
+constexpr int kTraceCapacity = 1 << 16;
+
+struct TraceSlot {
+  std::atomic<const CapiFunctionStats*> function = nullptr;
+  std::atomic<int32_t> thread_id = 0;
+  std::atomic<int64_t> start_ns = 0;
+  std::atomic<int64_t> duration_ns = 0;
+};
+
+struct CapiRegistry {
+  absl::Mutex mutex;
+  // NOTE: std::deque does not move the elements, so the stats can be referred to by the call sites.
+  std::deque<CapiFunctionStats> functions ABSL_GUARDED_BY(mutex);
+  std::atomic<bool> tracing = false;
+  std::atomic<TraceSlot*> trace = nullptr;
+  std::atomic<uint64_t> next_event = 0;
+  std::atomic<int32_t> next_thread_id = 1;
+};
+
+CapiRegistry& GetRegistry() {
+  static auto* registry = new CapiRegistry();
+  return *registry;
+}
+
+int32_t GetThreadId() {
+  thread_local const int32_t thread_id = GetRegistry().next_thread_id.fetch_add(1, std::memory_order_relaxed);
+  return thread_id;
+}
+
+// Extracts the function name and the template arguments from the signature, e.g.
+//   "MpReturnCode Foo(const T*) [with T = int]" -> "Foo [with T = int]".
+std::string GetFunctionName(absl::string_view signature) {
+  const auto params_begin = signature.find('(');
+  if (params_begin == absl::string_view::npos) {
+    return std::string(signature);
+  }
+  // NOTE: MSVC puts the template arguments, which can contain spaces, after the name.
+  size_t name_begin = params_begin;
+  int depth = 0;
+  while (name_begin > 0) {
+    const auto c = signature[name_begin - 1];
+    if (c == '>') {
+      ++depth;
+    } else if (c == '<') {
+      --depth;
+    } else if (c == ' ' && depth == 0) {
+      break;
+    }
+    --name_begin;
+  }
+  std::string name(signature.substr(name_begin, params_begin - name_begin));
+  if (const auto args_begin = signature.rfind(" ["); args_begin != absl::string_view::npos && args_begin > signature.rfind(')')) {
+    const auto args = signature.substr(args_begin);
+    name.append(args.data(), args.size());
+  }
+  return name;
+}
+
+}  // namespace
+
+CapiFunctionStats* RegisterCapiFunction(const char* signature) {
+  auto& registry = GetRegistry();
+  absl::MutexLock lock(&registry.mutex);
+  auto& stats = registry.functions.emplace_back();
+  stats.name = GetFunctionName(signature);
+  return &stats;
+}
+
+CapiFunctionStats* RegisterNamedCapiFunction(const char* name) {
+  auto& registry = GetRegistry();
+  absl::MutexLock lock(&registry.mutex);
+  auto& stats = registry.functions.emplace_back();
+  stats.name = name;
+  return &stats;
+}
+
+void EndCapiSpan(CapiFunctionStats* stats, int64_t start_ns) {
+  const auto duration_ns = absl::GetCurrentTimeNanos() - start_ns;
+  stats->calls.fetch_add(1, std::memory_order_relaxed);
+  stats->total_ns.fetch_add(duration_ns, std::memory_order_relaxed);
+
+  auto& registry = GetRegistry();
+  if (!registry.tracing.load(std::memory_order_relaxed)) {
+    return;
+  }
+  auto* trace = registry.trace.load(std::memory_order_acquire);
+  auto& slot = trace[registry.next_event.fetch_add(1, std::memory_order_relaxed) % kTraceCapacity];
+  slot.function.store(nullptr, std::memory_order_relaxed);
+  slot.thread_id.store(GetThreadId(), std::memory_order_relaxed);
+  slot.start_ns.store(start_ns, std::memory_order_relaxed);
+  slot.duration_ns.store(duration_ns, std::memory_order_relaxed);
+  slot.function.store(stats, std::memory_order_release);
+}
+
+std::vector<CapiFunctionStats*> GetCapiFunctions() {
+  auto& registry = GetRegistry();
+  absl::MutexLock lock(&registry.mutex);
+  std::vector<CapiFunctionStats*> functions;
+  functions.reserve(registry.functions.size());
+  for (auto& stats : registry.functions) {
+    functions.push_back(&stats);
+  }
+  return functions;
+}
+
+bool IsCapiTracing() { return GetRegistry().tracing.load(std::memory_order_relaxed); }
+
+void SetCapiTracing(bool tracing) {
+  auto& registry = GetRegistry();
+  if (tracing && registry.trace.load(std::memory_order_acquire) == nullptr) {
+    // NOTE: the buffer is allocated only once, and never freed since the spans can be writing to it.
+    absl::MutexLock lock(&registry.mutex);
+    if (registry.trace.load(std::memory_order_relaxed) == nullptr) {
+      registry.trace.store(new TraceSlot[kTraceCapacity], std::memory_order_release);
+    }
+  }
+  registry.tracing.store(tracing, std::memory_order_release);
+}
+
+std::vector<CapiTraceEvent> GetCapiTraceEvents() {
+  auto& registry = GetRegistry();
+  auto* trace = registry.trace.load(std::memory_order_acquire);
+  if (trace == nullptr) {
+    return {};
+  }
+  const auto end = registry.next_event.load(std::memory_order_relaxed);
+  const auto begin = end > kTraceCapacity ? end - kTraceCapacity : 0;
+  std::vector<CapiTraceEvent> events;
+  events.reserve(end - begin);
+  for (auto i = begin; i < end; ++i) {
+    const auto& slot = trace[i % kTraceCapacity];
+    // NOTE: the slot may be being overwritten, which only makes the event a little inaccurate.
+    const auto* function = slot.function.load(std::memory_order_acquire);
+    if (function == nullptr) {
+      continue;
+    }
+    events.push_back(CapiTraceEvent{function, slot.thread_id.load(std::memory_order_relaxed), slot.start_ns.load(std::memory_order_relaxed),
+                                    slot.duration_ns.load(std::memory_order_relaxed)});
+  }
+  return events;
+}
+
+}  // namespace mp_api
@@ -0,0 +1,89 @@
+// Copyright (c) 2026 homuler
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+#ifndef MEDIAPIPE_API_UTIL_CAPI_SPAN_H_
+#define MEDIAPIPE_API_UTIL_CAPI_SPAN_H_
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "absl/time/clock.h"
+
+// NOTE: this header must not depend on mediapipe_api/common.h, which includes it.
+
+namespace mp_api {
+
+// The cumulative stats of a C API function.
+struct CapiFunctionStats {
+  std::string name;
+  std::atomic<int64_t> calls = 0;
+  std::atomic<int64_t> total_ns = 0;
+};
+
+// Registers the function whose signature is `signature` (i.e. __PRETTY_FUNCTION__ or __FUNCSIG__).
+// The stats are never freed, so they can be referred to by a static variable.
+CapiFunctionStats* RegisterCapiFunction(const char* signature);
+// Registers the function whose name is `name` as it is.
+CapiFunctionStats* RegisterNamedCapiFunction(const char* name);
+void EndCapiSpan(CapiFunctionStats* stats, int64_t start_ns);
+
+// Returns the registered functions.
+std::vector<CapiFunctionStats*> GetCapiFunctions();
+
+// While tracing, the spans are also recorded to a ring buffer, which can be exported as a Chrome trace.
+bool IsCapiTracing();
+void SetCapiTracing(bool tracing);
+
+struct CapiTraceEvent {
+  const CapiFunctionStats* function;
+  int32_t thread_id;
+  int64_t start_ns;
+  int64_t duration_ns;
+};
+
+// Returns the events in the ring buffer in the order they ended.
+std::vector<CapiTraceEvent> GetCapiTraceEvents();
+
+// Measures the time from the construction to the destruction.
+class ScopedCapiSpan {
+ public:
+  explicit ScopedCapiSpan(CapiFunctionStats* stats) : stats_(stats), start_ns_(absl::GetCurrentTimeNanos()) {}
+  ~ScopedCapiSpan() { EndCapiSpan(stats_, start_ns_); }
+
+  ScopedCapiSpan(const ScopedCapiSpan&) = delete;
+  ScopedCapiSpan& operator=(const ScopedCapiSpan&) = delete;
+
+ private:
+  CapiFunctionStats* const stats_;
+  const int64_t start_ns_;
+};
+
+}  // namespace mp_api
+
+#ifdef _MSC_VER
+#define MP_CAPI_FUNCTION_SIGNATURE __FUNCSIG__
+#else
+#define MP_CAPI_FUNCTION_SIGNATURE __PRETTY_FUNCTION__
+#endif  // _MSC_VER
+
+// Measures the enclosing C API function if the library is built with `--//mediapipe_api:trace_capi`.
+// NOTE: the signature is used instead of __func__ to tell the overloads apart.
+// MP_CAPI_NAMED_SPAN measures it as `name`, which is used by the exported functions that call the function templates, e.g. mp_Packet__Get.
+#if MEDIAPIPE_API_TRACE_CAPI
+#define MP_CAPI_SPAN()                                                                          \
+  static auto* const _mp_capi_stats = mp_api::RegisterCapiFunction(MP_CAPI_FUNCTION_SIGNATURE); \
+  mp_api::ScopedCapiSpan _mp_capi_span(_mp_capi_stats);
+#define MP_CAPI_NAMED_SPAN(name)                                               \
+  static auto* const _mp_capi_stats = mp_api::RegisterNamedCapiFunction(name); \
+  mp_api::ScopedCapiSpan _mp_capi_span(_mp_capi_stats)
+#else
+#define MP_CAPI_SPAN()
+#define MP_CAPI_NAMED_SPAN(name)
+#endif  // MEDIAPIPE_API_TRACE_CAPI
+
+#endif  // MEDIAPIPE_API_UTIL_CAPI_SPAN_H_
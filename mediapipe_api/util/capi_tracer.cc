@@ -0,0 +1,85 @@
+// Copyright (c) 2026 homuler
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+#include "mediapipe_api/util/capi_tracer.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "absl/strings/str_cat.h"
+#include "absl/strings/str_format.h"
+#include "mediapipe/framework/port/file_helpers.h"
+#include "mediapipe_api/util/capi_span.h"
+
+namespace mp_api {
+
+bool IsCapiTracerEnabled() {
+#if MEDIAPIPE_API_TRACE_CAPI
+  return true;
+#else
+  return false;
+#endif  // MEDIAPIPE_API_TRACE_CAPI
+}
+
+void GetCapiCallStats(StructArray<CapiCallStats>* value_out) {
+  std::vector<CapiCallStats> stats;
+  for (const auto* function : GetCapiFunctions()) {
+    const auto calls = function->calls.load(std::memory_order_relaxed);
+    if (calls == 0) {
+      continue;
+    }
+    stats.push_back(CapiCallStats{function->name.c_str(), calls, function->total_ns.load(std::memory_order_relaxed)});
+  }
+  auto data = new CapiCallStats[stats.size()];
+  std::copy(stats.begin(), stats.end(), data);
+  value_out->data = data;
+  value_out->size = static_cast<int>(stats.size());
+}
+
+void ResetCapiCallStats() {
+  for (auto* function : GetCapiFunctions()) {
+    function->calls.store(0, std::memory_order_relaxed);
+    function->total_ns.store(0, std::memory_order_relaxed);
+  }
+}
+
+absl::Status WriteCapiTrace(const std::string& path) {
+  const auto events = GetCapiTraceEvents();
+  int64_t base_ns = 0;
+  if (!events.empty()) {
+    base_ns = std::min_element(events.begin(), events.end(), [](const auto& a, const auto& b) { return a.start_ns < b.start_ns; })->start_ns;
+  }
+
+  std::string json = R"({"displayTimeUnit":"ns","traceEvents":[{"name":"process_name","ph":"M","pid":1,"args":{"name":"MediaPipe C API"}})";
+  for (const auto& event : events) {
+    // NOTE: the names are the C++ function names, which contain no character to be escaped.
+    absl::StrAppend(&json, R"(,{"name":")", event.function->name, R"(","cat":"capi","ph":"X","ts":)", absl::StrFormat("%.3f", (event.start_ns - base_ns) / 1e3),
+                    ",\"dur\":", absl::StrFormat("%.3f", event.duration_ns / 1e3), ",\"pid\":1,\"tid\":", event.thread_id, "}");
+  }
+  json.append("]}");
+  return mediapipe::file::SetContents(path, json);
+}
+
+}  // namespace mp_api
+
+bool mp_CapiTracer__IsEnabled() { return mp_api::IsCapiTracerEnabled(); }
+
+bool mp_CapiTracer__tracing() { return mp_api::IsCapiTracing(); }
+
+void mp_CapiTracer__set_tracing__b(bool tracing) { mp_api::SetCapiTracing(tracing && mp_api::IsCapiTracerEnabled()); }
+
+void mp_CapiTracer__GetStats(mp_api::StructArray<mp_api::CapiCallStats>* value_out) { mp_api::GetCapiCallStats(value_out); }
+
+void mp_CapiTracer__ResetStats() { mp_api::ResetCapiCallStats(); }
+
+MpReturnCode mp_CapiTracer__WriteTrace__PKc(const char* path, absl::Status** status_out) {
+  TRY
+    *status_out = new absl::Status{mp_api::WriteCapiTrace(path)};
+    RETURN_CODE(MpReturnCode::Success);
+  CATCH_EXCEPTION
+}
+
+void mp_api_CapiCallStatsArray__delete(mp_api::StructArray<mp_api::CapiCallStats> array) { delete[] array.data; }
@@ -0,0 +1,52 @@
+// Copyright (c) 2026 homuler
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+#ifndef MEDIAPIPE_API_UTIL_CAPI_TRACER_H_
+#define MEDIAPIPE_API_UTIL_CAPI_TRACER_H_
+
+#include <cstdint>
+#include <string>
+
+#include "absl/status/status.h"
+#include "mediapipe_api/common.h"
+
+namespace mp_api {
+
+struct CapiCallStats {
+  // The name of the C API function. It's valid during the process.
+  const char* name;
+  int64_t calls;
+  int64_t total_ns;
+};
+
+// Returns true if the library is built with `--//mediapipe_api:trace_capi`.
+// Otherwise, the C API functions are not measured, and the stats are always empty.
+bool IsCapiTracerEnabled();
+
+// Copies the stats of the C API functions that have been called since the last reset to a new array,
+// which must be deleted by mp_api_CapiCallStatsArray__delete.
+void GetCapiCallStats(StructArray<CapiCallStats>* value_out);
+void ResetCapiCallStats();
+
+// Writes the spans recorded while tracing to `path` in the Chrome trace event format, which can be opened by Perfetto.
+absl::Status WriteCapiTrace(const std::string& path);
+
+}  // namespace mp_api
+
+extern "C" {
+
+MP_CAPI(bool) mp_CapiTracer__IsEnabled();
+MP_CAPI(bool) mp_CapiTracer__tracing();
+MP_CAPI(void) mp_CapiTracer__set_tracing__b(bool tracing);
+MP_CAPI(void) mp_CapiTracer__GetStats(mp_api::StructArray<mp_api::CapiCallStats>* value_out);
+MP_CAPI(void) mp_CapiTracer__ResetStats();
+MP_CAPI(MpReturnCode) mp_CapiTracer__WriteTrace__PKc(const char* path, absl::Status** status_out);
+
+MP_CAPI(void) mp_api_CapiCallStatsArray__delete(mp_api::StructArray<mp_api::CapiCallStats> array);
+
+}  // extern "C"
+
+#endif  // MEDIAPIPE_API_UTIL_CAPI_TRACER_H_
@@ -0,0 +1,139 @@
+// Copyright (c) 2026 homuler
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+// NOTE: MEDIAPIPE_API_TRACE_CAPI is defined for this test, so the spans are measured even if the library is built without `--//mediapipe_api:trace_capi`.
+
+#include "mediapipe_api/util/capi_tracer.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "absl/strings/match.h"
+#include "gtest/gtest.h"
+#include "mediapipe_api/util/capi_span.h"
+
+// NOTE: they are defined in the global namespace as the C API functions are.
+void mp_Test__Call() { MP_CAPI_SPAN(); }
+
+template <typename T>
+void mp_Test__CallTemplate() {
+  MP_CAPI_SPAN();
+}
+
+void mp_Test__CallNamed() { MP_CAPI_NAMED_SPAN("mp_Test__Named"); }
+
+namespace mp_api {
+namespace {
+
+// Returns the stats of `name`, or nullptr if it's not called.
+const CapiCallStats* FindStats(const StructArray<CapiCallStats>& stats, const std::string& name) {
+  for (auto i = 0; i < stats.size; ++i) {
+    if (stats.data[i].name == name) {
+      return &stats.data[i];
+    }
+  }
+  return nullptr;
+}
+
+class CapiTracerTest : public ::testing::Test {
+ protected:
+  void SetUp() override { ResetCapiCallStats(); }
+
+  void TearDown() override {
+    SetCapiTracing(false);
+    ResetCapiCallStats();
+  }
+};
+
+TEST_F(CapiTracerTest, GetCapiCallStats_ShouldCountCalls) {
+  for (auto i = 0; i < 3; ++i) {
+    mp_Test__Call();
+  }
+
+  StructArray<CapiCallStats> stats;
+  GetCapiCallStats(&stats);
+  const auto* function_stats = FindStats(stats, "mp_Test__Call");
+  ASSERT_NE(function_stats, nullptr);
+  EXPECT_EQ(function_stats->calls, 3);
+  EXPECT_GE(function_stats->total_ns, 0);
+  delete[] stats.data;
+}
+
+// NOTE: how the template arguments are written depends on the compiler.
+TEST_F(CapiTracerTest, GetCapiCallStats_ShouldTellTheInstantiationsApart) {
+  mp_Test__CallTemplate<int>();
+  mp_Test__CallTemplate<float>();
+  mp_Test__CallTemplate<float>();
+
+  StructArray<CapiCallStats> stats;
+  GetCapiCallStats(&stats);
+  std::vector<int64_t> calls;
+  for (auto i = 0; i < stats.size; ++i) {
+    if (absl::StartsWith(stats.data[i].name, "mp_Test__CallTemplate")) {
+      calls.push_back(stats.data[i].calls);
+    }
+  }
+  std::sort(calls.begin(), calls.end());
+  EXPECT_EQ(calls, (std::vector<int64_t>{1, 2}));
+  delete[] stats.data;
+}
+
+TEST_F(CapiTracerTest, GetCapiCallStats_ShouldUseTheName_When_TheSpanIsNamed) {
+  mp_Test__CallNamed();
+
+  StructArray<CapiCallStats> stats;
+  GetCapiCallStats(&stats);
+  const auto* function_stats = FindStats(stats, "mp_Test__Named");
+  ASSERT_NE(function_stats, nullptr);
+  EXPECT_EQ(function_stats->calls, 1);
+  delete[] stats.data;
+}
+
+TEST_F(CapiTracerTest, ResetCapiCallStats_ShouldClearTheStats) {
+  mp_Test__Call();
+  ResetCapiCallStats();
+
+  StructArray<CapiCallStats> stats;
+  GetCapiCallStats(&stats);
+  EXPECT_EQ(stats.size, 0);
+  delete[] stats.data;
+}
+
+TEST_F(CapiTracerTest, GetCapiTraceEvents_ShouldRecordTheSpans_When_Tracing) {
+  const auto begin = GetCapiTraceEvents().size();
+  mp_Test__Call();
+  SetCapiTracing(true);
+  mp_Test__CallNamed();
+  SetCapiTracing(false);
+  mp_Test__Call();
+
+  const auto events = GetCapiTraceEvents();
+  ASSERT_EQ(events.size(), begin + 1);
+  EXPECT_EQ(events.back().function->name, "mp_Test__Named");
+  EXPECT_GE(events.back().duration_ns, 0);
+}
+
+TEST_F(CapiTracerTest, WriteCapiTrace_ShouldWriteChromeTrace) {
+  const auto path = ::testing::TempDir() + "/capi_trace.json";
+  SetCapiTracing(true);
+  mp_Test__CallNamed();
+  SetCapiTracing(false);
+
+  ASSERT_TRUE(WriteCapiTrace(path).ok());
+  std::ifstream file(path);
+  const std::string trace{std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+  EXPECT_TRUE(absl::StartsWith(trace, R"({"displayTimeUnit":"ns","traceEvents":[)")) << trace;
+  EXPECT_TRUE(absl::StrContains(trace, R"({"name":"mp_Test__Named","cat":"capi","ph":"X",)")) << trace;
+  std::remove(path.c_str());
+}
+
+}  // namespace
+}  // namespace mp_api
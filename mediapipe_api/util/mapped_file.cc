@@ -0,0 +1,189 @@
+// Copyright (c) 2026 homuler
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+#include "mediapipe_api/util/mapped_file.h"
+
+#include <cerrno>
+#include <string>
+
+#ifdef _WIN32
+#include <io.h>
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
+#include "absl/status/status.h"
+#include "absl/strings/str_cat.h"
+#include "absl/synchronization/mutex.h"
+
+namespace mp_api {
+
+namespace {
+
+// The mappings alive, keyed by the file identity and the range.
+struct Registry {
+  absl::Mutex mutex;
+  absl::flat_hash_map<std::string, std::weak_ptr<const MappedFile>> files ABSL_GUARDED_BY(mutex);
+};
+
+Registry& GetRegistry() {
+  static auto* registry = new Registry();
+  return *registry;
+}
+
+struct FileInfo {
+  // Identifies the file regardless of its path or descriptor.
+  std::string id;
+  int64_t size;
+};
+
+#ifdef _WIN32
+absl::StatusOr<FileInfo> GetFileInfo(HANDLE handle) {
+  BY_HANDLE_FILE_INFORMATION info;
+  if (!GetFileInformationByHandle(handle, &info)) {
+    return absl::InternalError(absl::StrCat("GetFileInformationByHandle failed: ", GetLastError()));
+  }
+  return FileInfo{absl::StrCat(info.dwVolumeSerialNumber, ":", info.nFileIndexHigh, ":", info.nFileIndexLow),
+                  static_cast<int64_t>((static_cast<uint64_t>(info.nFileSizeHigh) << 32) | info.nFileSizeLow)};
+}
+
+int64_t GetAllocationGranularity() {
+  SYSTEM_INFO info;
+  GetSystemInfo(&info);
+  return info.dwAllocationGranularity;
+}
+#else
+absl::StatusOr<FileInfo> GetFileInfo(int fd) {
+  struct stat st;
+  if (fstat(fd, &st) != 0) {
+    return absl::ErrnoToStatus(errno, "fstat failed");
+  }
+  return FileInfo{absl::StrCat(st.st_dev, ":", st.st_ino), static_cast<int64_t>(st.st_size)};
+}
+
+int64_t GetAllocationGranularity() { return sysconf(_SC_PAGESIZE); }
+#endif
+
+}  // namespace
+
+absl::StatusOr<std::shared_ptr<const MappedFile>> MappedFile::Map(const std::string& path, int64_t offset, int64_t length) {
+#ifdef _WIN32
+  // NOTE: `path` is encoded in UTF-8, which CreateFileA doesn't accept.
+  const auto wide_path_size = MultiByteToWideChar(CP_UTF8, MB_ERR_INVALID_CHARS, path.c_str(), -1, nullptr, 0);
+  if (wide_path_size == 0) {
+    return absl::InvalidArgumentError(absl::StrCat(path, " is not a valid UTF-8 string"));
+  }
+  std::wstring wide_path(wide_path_size, L'\0');
+  MultiByteToWideChar(CP_UTF8, MB_ERR_INVALID_CHARS, path.c_str(), -1, wide_path.data(), wide_path_size);
+  auto handle = CreateFileW(wide_path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+  if (handle == INVALID_HANDLE_VALUE) {
+    const auto error = GetLastError();
+    auto message = absl::StrCat("Failed to open ", path, ": ", error);
+    return error == ERROR_FILE_NOT_FOUND || error == ERROR_PATH_NOT_FOUND ? absl::NotFoundError(message) : absl::UnavailableError(message);
+  }
+  auto mapped_file = MapHandle(reinterpret_cast<intptr_t>(handle), offset, length);
+  CloseHandle(handle);
+#else
+  const auto fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    return absl::ErrnoToStatus(errno, absl::StrCat("Failed to open ", path));
+  }
+  // NOTE: the mapping is valid after the file is closed.
+  auto mapped_file = MapHandle(fd, offset, length);
+  close(fd);
+#endif
+  return mapped_file;
+}
+
+absl::StatusOr<std::shared_ptr<const MappedFile>> MappedFile::MapDescriptor(int fd, int64_t offset, int64_t length) {
+  if (fd < 0) {
+    return absl::InvalidArgumentError(absl::StrCat("Invalid file descriptor: ", fd));
+  }
+#ifdef _WIN32
+  return MapHandle(_get_osfhandle(fd), offset, length);
+#else
+  return MapHandle(fd, offset, length);
+#endif
+}
+
+absl::StatusOr<std::shared_ptr<const MappedFile>> MappedFile::MapHandle(intptr_t handle, int64_t offset, int64_t length) {
+#ifdef _WIN32
+  auto file_info = GetFileInfo(reinterpret_cast<HANDLE>(handle));
+#else
+  auto file_info = GetFileInfo(static_cast<int>(handle));
+#endif
+  if (!file_info.ok()) {
+    return file_info.status();
+  }
+  if (offset < 0 || offset > file_info->size) {
+    return absl::InvalidArgumentError(absl::StrCat("offset must be in [0, ", file_info->size, "], but got ", offset));
+  }
+  if (length < 0) {
+    length = file_info->size - offset;
+  } else if (length > file_info->size - offset) {
+    return absl::OutOfRangeError(absl::StrCat("The range [", offset, ", ", offset + length, ") exceeds the file size ", file_info->size));
+  }
+
+  auto& registry = GetRegistry();
+  const auto key = absl::StrCat(file_info->id, ":", offset, ":", length);
+  absl::MutexLock lock(&registry.mutex);
+  if (auto it = registry.files.find(key); it != registry.files.end()) {
+    if (auto mapped_file = it->second.lock()) {
+      return mapped_file;
+    }
+  }
+
+  auto mapped_file = std::shared_ptr<MappedFile>(new MappedFile());
+  if (length > 0) {
+    // NOTE: the offset of a mapping must be a multiple of the page size (or the allocation granularity on Windows).
+    const auto granularity = GetAllocationGranularity();
+    const auto aligned_offset = offset - offset % granularity;
+    const auto mapped_size = static_cast<size_t>(length + offset - aligned_offset);
+#ifdef _WIN32
+    auto mapping = CreateFileMappingA(reinterpret_cast<HANDLE>(handle), nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (mapping == nullptr) {
+      return absl::InternalError(absl::StrCat("CreateFileMapping failed: ", GetLastError()));
+    }
+    auto* base = MapViewOfFile(mapping, FILE_MAP_READ, static_cast<DWORD>(aligned_offset >> 32), static_cast<DWORD>(aligned_offset & 0xFFFFFFFF), mapped_size);
+    // NOTE: the view keeps the mapping object alive.
+    CloseHandle(mapping);
+    if (base == nullptr) {
+      return absl::InternalError(absl::StrCat("MapViewOfFile failed: ", GetLastError()));
+    }
+#else
+    auto* base = mmap(nullptr, mapped_size, PROT_READ, MAP_SHARED, static_cast<int>(handle), aligned_offset);
+    if (base == MAP_FAILED) {
+      return absl::ErrnoToStatus(errno, "mmap failed");
+    }
+#endif
+    mapped_file->base_ = base;
+    mapped_file->mapped_size_ = mapped_size;
+    mapped_file->contents_ = absl::string_view(static_cast<const char*>(base) + (offset - aligned_offset), static_cast<size_t>(length));
+  }
+  // NOTE: the registry doesn't know when the mappings are destroyed, so the expired entries are removed when a new entry is added.
+  absl::erase_if(registry.files, [](const auto& entry) { return entry.second.expired(); });
+  registry.files[key] = mapped_file;
+  return mapped_file;
+}
+
+MappedFile::~MappedFile() {
+  if (base_ == nullptr) {
+    return;
+  }
+#ifdef _WIN32
+  UnmapViewOfFile(base_);
+#else
+  munmap(base_, mapped_size_);
+#endif
+}
+
+}  // namespace mp_api
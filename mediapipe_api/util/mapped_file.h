@@ -0,0 +1,51 @@
+// Copyright (c) 2026 homuler
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+#ifndef MEDIAPIPE_API_UTIL_MAPPED_FILE_H_
+#define MEDIAPIPE_API_UTIL_MAPPED_FILE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "absl/status/statusor.h"
+#include "absl/strings/string_view.h"
+
+namespace mp_api {
+
+// A read-only memory mapping of a range of a file.
+//
+// The mappings of the same range of the same file are shared while they are alive, so the pages are loaded only once
+// and can be reclaimed by the OS when the memory is low, unlike the buffers on the heap.
+class MappedFile {
+ public:
+  // Maps `length` bytes from `offset` of the file at `path`. If `length` is negative, the rest of the file is mapped.
+  static absl::StatusOr<std::shared_ptr<const MappedFile>> Map(const std::string& path, int64_t offset = 0, int64_t length = -1);
+  // Same as Map, but the file is specified by `fd`, which is not closed (e.g. a file descriptor of an asset in an Android APK).
+  static absl::StatusOr<std::shared_ptr<const MappedFile>> MapDescriptor(int fd, int64_t offset = 0, int64_t length = -1);
+
+  ~MappedFile();
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+
+  // NOTE: it returns a reference so that the callers can create an aliasing std::shared_ptr of it.
+  const absl::string_view& contents() const { return contents_; }
+
+ private:
+  MappedFile() = default;
+
+  // `handle` is a file descriptor, or a HANDLE on Windows.
+  static absl::StatusOr<std::shared_ptr<const MappedFile>> MapHandle(intptr_t handle, int64_t offset, int64_t length);
+
+  void* base_ = nullptr;
+  size_t mapped_size_ = 0;
+  absl::string_view contents_;
+};
+
+}  // namespace mp_api
+
+#endif  // MEDIAPIPE_API_UTIL_MAPPED_FILE_H_
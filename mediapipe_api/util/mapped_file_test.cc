@@ -0,0 +1,144 @@
+// Copyright (c) 2026 homuler
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+#include "mediapipe_api/util/mapped_file.h"
+
+#include <fcntl.h>
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+#include "absl/status/status.h"
+#include "gtest/gtest.h"
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace mp_api {
+namespace {
+
+// Larger than a page, so that the ranges starting in the middle of the file are mapped from an unaligned offset.
+std::string CreateContents() {
+  std::string contents;
+  for (auto i = 0; i < 3 * 4096 + 123; ++i) {
+    contents.push_back(static_cast<char>('a' + i % 26));
+  }
+  return contents;
+}
+
+std::string WriteFile(const std::string& name, const std::string& contents) {
+  const auto path = ::testing::TempDir() + "/" + name;
+  std::ofstream(path, std::ios::binary) << contents;
+  return path;
+}
+
+TEST(MappedFileTest, Map_ShouldMapTheWholeFile) {
+  const auto contents = CreateContents();
+  auto mapped_file = MappedFile::Map(WriteFile("whole.bin", contents));
+  ASSERT_TRUE(mapped_file.ok()) << mapped_file.status();
+
+  EXPECT_EQ((*mapped_file)->contents(), contents);
+}
+
+TEST(MappedFileTest, Map_ShouldMapTheRange_When_OffsetIsNotAligned) {
+  const auto contents = CreateContents();
+  auto mapped_file = MappedFile::Map(WriteFile("range.bin", contents), 4099, 5000);
+  ASSERT_TRUE(mapped_file.ok()) << mapped_file.status();
+
+  EXPECT_EQ((*mapped_file)->contents(), contents.substr(4099, 5000));
+}
+
+TEST(MappedFileTest, Map_ShouldMapTheRest_When_LengthIsNegative) {
+  const auto contents = CreateContents();
+  auto mapped_file = MappedFile::Map(WriteFile("rest.bin", contents), 100, -1);
+  ASSERT_TRUE(mapped_file.ok()) << mapped_file.status();
+
+  EXPECT_EQ((*mapped_file)->contents(), contents.substr(100));
+}
+
+TEST(MappedFileTest, Map_ShouldReturnEmptyContents_When_TheFileIsEmpty) {
+  auto mapped_file = MappedFile::Map(WriteFile("empty.bin", ""));
+  ASSERT_TRUE(mapped_file.ok()) << mapped_file.status();
+
+  EXPECT_TRUE((*mapped_file)->contents().empty());
+}
+
+TEST(MappedFileTest, Map_ShouldShareTheMapping_When_TheSameRangeIsMapped) {
+  const auto path = WriteFile("shared.bin", CreateContents());
+  auto mapped_file1 = MappedFile::Map(path, 10, 20);
+  auto mapped_file2 = MappedFile::Map(path, 10, 20);
+  auto mapped_file3 = MappedFile::Map(path, 10, 21);
+  ASSERT_TRUE(mapped_file1.ok() && mapped_file2.ok() && mapped_file3.ok());
+
+  EXPECT_EQ(*mapped_file1, *mapped_file2);
+  EXPECT_NE(*mapped_file1, *mapped_file3);
+}
+
+TEST(MappedFileTest, Map_ShouldMapAgain_After_TheMappingIsReleased) {
+  const auto contents = CreateContents();
+  const auto path = WriteFile("remap.bin", contents);
+  for (auto i = 0; i < 3; ++i) {
+    auto mapped_file = MappedFile::Map(path, i, 100);
+    ASSERT_TRUE(mapped_file.ok()) << mapped_file.status();
+    EXPECT_EQ((*mapped_file)->contents(), contents.substr(i, 100));
+  }
+  auto mapped_file = MappedFile::Map(path, 0, 100);
+  ASSERT_TRUE(mapped_file.ok()) << mapped_file.status();
+  EXPECT_EQ((*mapped_file)->contents(), contents.substr(0, 100));
+}
+
+TEST(MappedFileTest, Map_ShouldMapTheFile_When_ThePathIsNotAscii) {
+  const auto contents = CreateContents();
+  auto mapped_file = MappedFile::Map(WriteFile("\xE3\x83\xA2\xE3\x83\x87\xE3\x83\xAB.bin", contents));
+  ASSERT_TRUE(mapped_file.ok()) << mapped_file.status();
+
+  EXPECT_EQ((*mapped_file)->contents(), contents);
+}
+
+TEST(MappedFileTest, Map_ShouldReturnNotFound_When_TheFileDoesNotExist) {
+  auto mapped_file = MappedFile::Map(::testing::TempDir() + "/missing.bin");
+
+  EXPECT_TRUE(absl::IsNotFound(mapped_file.status())) << mapped_file.status();
+}
+
+TEST(MappedFileTest, Map_ShouldFail_When_TheRangeExceedsTheFile) {
+  const auto path = WriteFile("small.bin", "abc");
+
+  EXPECT_TRUE(absl::IsInvalidArgument(MappedFile::Map(path, 4, 0).status()));
+  EXPECT_TRUE(absl::IsOutOfRange(MappedFile::Map(path, 1, 3).status()));
+}
+
+TEST(MappedFileTest, MapDescriptor_ShouldMapTheRange) {
+  const auto contents = CreateContents();
+  const auto path = WriteFile("descriptor.bin", contents);
+#ifdef _WIN32
+  const auto fd = _open(path.c_str(), _O_RDONLY | _O_BINARY);
+#else
+  const auto fd = open(path.c_str(), O_RDONLY);
+#endif
+  ASSERT_GE(fd, 0);
+
+  auto mapped_file = MappedFile::MapDescriptor(fd, 5000, 10);
+#ifdef _WIN32
+  _close(fd);
+#else
+  close(fd);
+#endif
+  // NOTE: the mapping is valid after the descriptor is closed.
+  ASSERT_TRUE(mapped_file.ok()) << mapped_file.status();
+  EXPECT_EQ((*mapped_file)->contents(), contents.substr(5000, 10));
+}
+
+TEST(MappedFileTest, MapDescriptor_ShouldFail_When_TheDescriptorIsInvalid) {
+  EXPECT_TRUE(absl::IsInvalidArgument(MappedFile::MapDescriptor(-1).status()));
+}
+
+}  // namespace
+}  // namespace mp_api
@@ -0,0 +1,420 @@
+// Copyright (c) 2026 homuler
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+#include "mediapipe_api/util/mask_codec.h"
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+#include "absl/strings/str_cat.h"
+#include "mediapipe/framework/formats/image.h"
+
+namespace mp_api {
+
+namespace {
+
+constexpr uint8_t kMagic[4] = {'M', 'P', 'M', 'K'};
+constexpr uint8_t kVersion = 1;
+constexpr uint8_t kConfidenceFlag = 1;
+
+bool IsValidBits(int bits) { return bits == 1 || bits == 2 || bits == 4 || bits == 8; }
+
+bool IsValidEncoding(int encoding) {
+  return encoding == static_cast<int>(MaskEncoding::kBitPacked) || encoding == static_cast<int>(MaskEncoding::kRunLength);
+}
+
+inline void WriteUint32(uint32_t value, uint8_t* dst) {
+  dst[0] = value & 0xff;
+  dst[1] = (value >> 8) & 0xff;
+  dst[2] = (value >> 16) & 0xff;
+  dst[3] = (value >> 24) & 0xff;
+}
+
+inline uint32_t ReadUint32(const uint8_t* src) {
+  return static_cast<uint32_t>(src[0]) | (static_cast<uint32_t>(src[1]) << 8) | (static_cast<uint32_t>(src[2]) << 16) |
+         (static_cast<uint32_t>(src[3]) << 24);
+}
+
+// Confidences are quantized uniformly in [0, 1] (VEC32F1) or [0, 255] (GRAY8), and categories are clamped to `max_level`.
+void QuantizeRow(const MaskView& src, int y, int max_level, bool is_category, uint8_t* dst) {
+  const auto* row = src.data + y * src.width_step;
+  if (src.is_float) {
+    const auto* values = reinterpret_cast<const float*>(row);
+    const float scale = is_category ? 1.0f : static_cast<float>(max_level);
+    const float max = static_cast<float>(max_level);
+    for (auto x = 0; x < src.width; ++x) {
+      const float v = std::min(std::max(values[x] * scale + 0.5f, 0.0f), max);
+      dst[x] = static_cast<uint8_t>(v);
+    }
+  } else if (is_category) {
+    const auto max = static_cast<uint8_t>(max_level);
+    for (auto x = 0; x < src.width; ++x) {
+      dst[x] = std::min(row[x], max);
+    }
+  } else {
+    for (auto x = 0; x < src.width; ++x) {
+      dst[x] = static_cast<uint8_t>((row[x] * max_level + 127) / 255);
+    }
+  }
+}
+
+class BitWriter {
+ public:
+  BitWriter(int bits, uint8_t* dst) : bits_(bits), dst_(dst) {}
+
+  void Write(const uint8_t* levels, int n) {
+    if (bits_ == 8) {
+      std::memcpy(dst_, levels, n);
+      dst_ += n;
+      return;
+    }
+    for (auto i = 0; i < n; ++i) {
+      acc_ |= levels[i] << filled_;
+      filled_ += bits_;
+      if (filled_ == 8) {
+        *dst_++ = static_cast<uint8_t>(acc_);
+        acc_ = 0;
+        filled_ = 0;
+      }
+    }
+  }
+
+  uint8_t* Flush() {
+    if (filled_ > 0) {
+      *dst_++ = static_cast<uint8_t>(acc_);
+      acc_ = 0;
+      filled_ = 0;
+    }
+    return dst_;
+  }
+
+ private:
+  const int bits_;
+  uint8_t* dst_;
+  uint32_t acc_ = 0;
+  int filled_ = 0;
+};
+
+class RunLengthWriter {
+ public:
+  explicit RunLengthWriter(uint8_t* dst) : dst_(dst) {}
+
+  void Write(const uint8_t* levels, int n) {
+    auto i = 0;
+    if (length_ == 0 && n > 0) {
+      value_ = levels[0];
+    }
+    while (i < n) {
+      if (levels[i] != value_) {
+        Emit();
+        value_ = levels[i];
+      }
+      // count the rest of the run in the row
+      auto j = i + 1;
+      while (j < n && levels[j] == value_) {
+        ++j;
+      }
+      length_ += j - i;
+      i = j;
+    }
+  }
+
+  uint8_t* Flush() {
+    if (length_ > 0) {
+      Emit();
+    }
+    return dst_;
+  }
+
+ private:
+  void Emit() {
+    *dst_++ = value_;
+    uint32_t v = length_ - 1;
+    while (v >= 0x80) {
+      *dst_++ = static_cast<uint8_t>(v | 0x80);
+      v >>= 7;
+    }
+    *dst_++ = static_cast<uint8_t>(v);
+    length_ = 0;
+  }
+
+  uint8_t* dst_;
+  uint8_t value_ = 0;
+  uint32_t length_ = 0;
+};
+
+template <typename Writer>
+uint8_t* EncodeRows(const MaskView& src, int max_level, bool is_category, Writer writer) {
+  // NOTE: the row buffer is reused to avoid allocating memory every frame.
+  thread_local std::vector<uint8_t> levels;
+  levels.resize(src.width);
+
+  for (auto y = 0; y < src.height; ++y) {
+    QuantizeRow(src, y, max_level, is_category, levels.data());
+    writer.Write(levels.data(), src.width);
+  }
+  return writer.Flush();
+}
+
+// Maps each level to the decoded value.
+void BuildLevelTable(const MaskHeader& header, uint8_t table[256]) {
+  const int max_level = (1 << header.bits) - 1;
+  for (auto level = 0; level < 256; ++level) {
+    if (!header.is_confidence) {
+      table[level] = static_cast<uint8_t>(level);
+    } else {
+      table[level] = static_cast<uint8_t>((std::min(level, max_level) * 255 + max_level / 2) / max_level);
+    }
+  }
+}
+
+absl::Status DecodeBitPacked(const MaskHeader& header, const uint8_t* payload, uint8_t* dst) {
+  const int64_t pixel_count = static_cast<int64_t>(header.width) * header.height;
+  if (static_cast<int64_t>(header.payload_size) * 8 < pixel_count * header.bits) {
+    return absl::DataLossError("The payload is truncated");
+  }
+
+  uint8_t level_table[256];
+  BuildLevelTable(header, level_table);
+
+  if (header.bits == 8) {
+    for (int64_t i = 0; i < pixel_count; ++i) {
+      dst[i] = level_table[payload[i]];
+    }
+    return absl::OkStatus();
+  }
+
+  // Expands every possible byte at once, so that each input byte costs a single lookup.
+  const int pixels_per_byte = 8 / header.bits;
+  const int mask = (1 << header.bits) - 1;
+  uint8_t byte_table[256][8];
+  for (auto byte = 0; byte < 256; ++byte) {
+    for (auto k = 0; k < pixels_per_byte; ++k) {
+      byte_table[byte][k] = level_table[(byte >> (k * header.bits)) & mask];
+    }
+  }
+
+  const int64_t full_bytes = pixel_count / pixels_per_byte;
+  for (int64_t i = 0; i < full_bytes; ++i) {
+    std::memcpy(dst + i * pixels_per_byte, byte_table[payload[i]], pixels_per_byte);
+  }
+  const int rest = static_cast<int>(pixel_count - full_bytes * pixels_per_byte);
+  if (rest > 0) {
+    std::memcpy(dst + full_bytes * pixels_per_byte, byte_table[payload[full_bytes]], rest);
+  }
+  return absl::OkStatus();
+}
+
+absl::Status DecodeRunLength(const MaskHeader& header, const uint8_t* payload, uint8_t* dst) {
+  const int64_t pixel_count = static_cast<int64_t>(header.width) * header.height;
+  uint8_t level_table[256];
+  BuildLevelTable(header, level_table);
+
+  const auto* p = payload;
+  const auto* end = payload + header.payload_size;
+  int64_t pos = 0;
+  while (p < end) {
+    const uint8_t value = level_table[*p++];
+    uint64_t length = 0;
+    int shift = 0;
+    while (true) {
+      if (p >= end || shift > 28) {
+        return absl::DataLossError("Invalid run length");
+      }
+      const uint8_t b = *p++;
+      length |= static_cast<uint64_t>(b & 0x7f) << shift;
+      if ((b & 0x80) == 0) {
+        break;
+      }
+      shift += 7;
+    }
+    length += 1;
+    if (pos + static_cast<int64_t>(length) > pixel_count) {
+      return absl::DataLossError("The runs exceed the mask size");
+    }
+    std::memset(dst + pos, value, length);
+    pos += length;
+  }
+  if (pos != pixel_count) {
+    return absl::DataLossError(absl::StrCat("The runs cover ", pos, " pixels, but ", pixel_count, " pixels are expected"));
+  }
+  return absl::OkStatus();
+}
+
+}  // namespace
+
+int GetMaxEncodedMaskSize(int width, int height, MaskEncoding encoding, int bits) {
+  if (width <= 0 || height <= 0 || !IsValidBits(bits) || !IsValidEncoding(static_cast<int>(encoding))) {
+    return -1;
+  }
+  const int64_t pixel_count = static_cast<int64_t>(width) * height;
+  // Every run costs at most 2 bytes per pixel.
+  const int64_t payload_size = encoding == MaskEncoding::kBitPacked ? (pixel_count * bits + 7) / 8 : 2 * pixel_count;
+  const int64_t size = kMaskHeaderSize + payload_size;
+  return size > INT32_MAX ? -1 : static_cast<int>(size);
+}
+
+namespace {
+
+absl::StatusOr<int> EncodeQuantizedMask(const MaskView& src, MaskEncoding encoding, int bits, bool is_category, uint8_t* dst, int dst_size) {
+  if (src.data == nullptr || src.width <= 0 || src.height <= 0) {
+    return absl::InvalidArgumentError("The mask is empty");
+  }
+  const auto max_size = GetMaxEncodedMaskSize(src.width, src.height, encoding, bits);
+  if (max_size < 0) {
+    return absl::InvalidArgumentError(absl::StrCat("Invalid encoding (", static_cast<int>(encoding), ") or bits (", bits, ")"));
+  }
+  if (dst == nullptr || dst_size < max_size) {
+    return absl::InvalidArgumentError(absl::StrCat("Insufficient buffer size: ", max_size, " bytes are required, but got ", dst_size));
+  }
+
+  const int max_level = (1 << bits) - 1;
+  auto* payload = dst + kMaskHeaderSize;
+  auto* payload_end = encoding == MaskEncoding::kBitPacked ? EncodeRows(src, max_level, is_category, BitWriter(bits, payload))
+                                                           : EncodeRows(src, max_level, is_category, RunLengthWriter(payload));
+  const auto payload_size = static_cast<uint32_t>(payload_end - payload);
+
+  std::memcpy(dst, kMagic, sizeof(kMagic));
+  dst[4] = kVersion;
+  dst[5] = static_cast<uint8_t>(encoding);
+  dst[6] = static_cast<uint8_t>(bits);
+  dst[7] = is_category ? 0 : kConfidenceFlag;
+  WriteUint32(src.width, dst + 8);
+  WriteUint32(src.height, dst + 12);
+  WriteUint32(payload_size, dst + 16);
+
+  return kMaskHeaderSize + static_cast<int>(payload_size);
+}
+
+}  // namespace
+
+absl::StatusOr<int> EncodeMask(const MaskView& src, MaskEncoding encoding, int bits, uint8_t* dst, int dst_size) {
+  return EncodeQuantizedMask(src, encoding, bits, false, dst, dst_size);
+}
+
+absl::StatusOr<int> EncodeCategoryMask(const MaskView& src, MaskEncoding encoding, int bits, uint8_t* dst, int dst_size) {
+  return EncodeQuantizedMask(src, encoding, bits, true, dst, dst_size);
+}
+
+absl::StatusOr<MaskHeader> ReadMaskHeader(const uint8_t* data, int size) {
+  if (data == nullptr || size < kMaskHeaderSize || std::memcmp(data, kMagic, sizeof(kMagic)) != 0) {
+    return absl::InvalidArgumentError("The data is not an encoded mask");
+  }
+  if (data[4] != kVersion) {
+    return absl::UnimplementedError(absl::StrCat("Unsupported version: ", data[4]));
+  }
+
+  MaskHeader header;
+  header.encoding = data[5];
+  header.bits = data[6];
+  header.is_confidence = (data[7] & kConfidenceFlag) != 0;
+  header.width = static_cast<int>(ReadUint32(data + 8));
+  header.height = static_cast<int>(ReadUint32(data + 12));
+  header.payload_size = static_cast<int>(ReadUint32(data + 16));
+
+  if (!IsValidEncoding(header.encoding) || !IsValidBits(header.bits) || header.width <= 0 || header.height <= 0 || header.payload_size < 0) {
+    return absl::DataLossError("The header is corrupted");
+  }
+  if (header.payload_size > size - kMaskHeaderSize) {
+    return absl::DataLossError(absl::StrCat("The payload is truncated: ", header.payload_size, " bytes are expected, but got ", size - kMaskHeaderSize));
+  }
+  return header;
+}
+
+absl::Status DecodeMask(const uint8_t* data, int size, uint8_t* dst, int dst_size) {
+  auto header = ReadMaskHeader(data, size);
+  if (!header.ok()) {
+    return header.status();
+  }
+  if (dst == nullptr || static_cast<int64_t>(header->width) * header->height > dst_size) {
+    return absl::InvalidArgumentError(
+        absl::StrCat("Insufficient buffer size: ", header->width, "x", header->height, " bytes are required, but got ", dst_size));
+  }
+
+  const auto* payload = data + kMaskHeaderSize;
+  if (header->encoding == static_cast<int>(MaskEncoding::kBitPacked)) {
+    return DecodeBitPacked(*header, payload, dst);
+  }
+  return DecodeRunLength(*header, payload, dst);
+}
+
+absl::StatusOr<std::shared_ptr<const mediapipe::ImageFrame>> GetMaskImageFrame(const mediapipe::Packet& packet) {
+  if (packet.ValidateAsType<mediapipe::ImageFrame>().ok()) {
+    // The packet owns the ImageFrame.
+    return std::shared_ptr<const mediapipe::ImageFrame>(std::shared_ptr<void>(), &packet.Get<mediapipe::ImageFrame>());
+  }
+  if (packet.ValidateAsType<mediapipe::Image>().ok()) {
+    const auto& image = packet.Get<mediapipe::Image>();
+    if (image.UsesGpu()) {
+      return absl::FailedPreconditionError("The image is on GPU");
+    }
+    return image.GetImageFrameSharedPtr();
+  }
+  return absl::InvalidArgumentError(absl::StrCat("The packet must contain ImageFrame or Image, but got ", packet.DebugTypeName()));
+}
+
+}  // namespace mp_api
+
+namespace {
+
+absl::StatusOr<int> EncodeMaskPacket(const mediapipe::Packet& packet, mp_api::MaskEncoding encoding, int bits, bool is_category, uint8_t* buffer,
+                                     int buffer_size) {
+  auto image_frame = mp_api::GetMaskImageFrame(packet);
+  if (!image_frame.ok()) {
+    return image_frame.status();
+  }
+  auto mask_view = mp_api::GetMaskView(**image_frame);
+  if (!mask_view.ok()) {
+    return mask_view.status();
+  }
+  return is_category ? mp_api::EncodeCategoryMask(*mask_view, encoding, bits, buffer, buffer_size)
+                     : mp_api::EncodeMask(*mask_view, encoding, bits, buffer, buffer_size);
+}
+
+}  // namespace
+
+int mp__GetMaxEncodedMaskSize__i_i_i_i(int width, int height, int encoding, int bits) {
+  return mp_api::GetMaxEncodedMaskSize(width, height, static_cast<mp_api::MaskEncoding>(encoding), bits);
+}
+
+MpReturnCode mp_Packet__EncodeMask__i_i_Pui8_i(mediapipe::Packet* packet, int encoding, int bits, uint8_t* buffer, int buffer_size, absl::Status** status_out,
+                                               int* size_out) {
+  TRY_ALL
+    auto size = EncodeMaskPacket(*packet, static_cast<mp_api::MaskEncoding>(encoding), bits, false, buffer, buffer_size);
+    *size_out = size.ok() ? *size : 0;
+    *status_out = new absl::Status{size.status()};
+    RETURN_CODE(MpReturnCode::Success);
+  CATCH_ALL
+}
+
+MpReturnCode mp_Packet__EncodeCategoryMask__i_i_Pui8_i(mediapipe::Packet* packet, int encoding, int bits, uint8_t* buffer, int buffer_size,
+                                                       absl::Status** status_out, int* size_out) {
+  TRY_ALL
+    auto size = EncodeMaskPacket(*packet, static_cast<mp_api::MaskEncoding>(encoding), bits, true, buffer, buffer_size);
+    *size_out = size.ok() ? *size : 0;
+    *status_out = new absl::Status{size.status()};
+    RETURN_CODE(MpReturnCode::Success);
+  CATCH_ALL
+}
+
+MpReturnCode mp__ReadMaskHeader__Pui8_i(const uint8_t* data, int size, absl::Status** status_out, mp_api::MaskHeader* header_out) {
+  TRY_ALL
+    auto header = mp_api::ReadMaskHeader(data, size);
+    if (header.ok()) {
+      *header_out = *header;
+    }
+    *status_out = new absl::Status{header.status()};
+    RETURN_CODE(MpReturnCode::Success);
+  CATCH_ALL
+}
+
+MpReturnCode mp__DecodeMask__Pui8_i_Pui8_i(const uint8_t* data, int size, uint8_t* buffer, int buffer_size, absl::Status** status_out) {
+  TRY_ALL
+    *status_out = new absl::Status{mp_api::DecodeMask(data, size, buffer, buffer_size)};
+    RETURN_CODE(MpReturnCode::Success);
+  CATCH_ALL
+}
@@ -0,0 +1,79 @@
+// Copyright (c) 2026 homuler
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+#ifndef MEDIAPIPE_API_UTIL_MASK_CODEC_H_
+#define MEDIAPIPE_API_UTIL_MASK_CODEC_H_
+
+#include <cstdint>
+#include <memory>
+
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "mediapipe/framework/formats/image_frame.h"
+#include "mediapipe/framework/packet.h"
+#include "mediapipe_api/common.h"
+#include "mediapipe_api/util/segmentation_mask_util.h"
+
+namespace mp_api {
+
+enum class MaskEncoding : int {
+  // Each pixel is quantized to `bits` bits and packed LSB first, without row padding.
+  kBitPacked = 0,
+  // Each run of the quantized pixels is stored as (value: uint8, length - 1: LEB128).
+  kRunLength = 1,
+};
+
+// Every encoded mask starts with a 20 byte header:
+//   magic ("MPMK"), version (uint8), encoding (uint8), bits (uint8), flags (uint8), width (uint32), height (uint32), payload size (uint32).
+// All the integers are little endian.
+constexpr int kMaskHeaderSize = 20;
+
+struct MaskHeader {
+  int width;
+  int height;
+  int encoding;
+  int bits;
+  // If true, the source was a confidence mask and the decoded values are scaled back to [0, 255].
+  // Otherwise, the decoded values are the categories themselves.
+  bool is_confidence;
+  int payload_size;
+};
+
+// Returns the upper bound of the encoded size (including the header), or -1 if the arguments are invalid.
+int GetMaxEncodedMaskSize(int width, int height, MaskEncoding encoding, int bits);
+
+// Quantizes the confidence mask to `bits` (1, 2, 4, or 8) bits and encodes it into `dst`.
+// As in ResizeMaskToUint8, the confidences are in [0, 1] if the mask is VEC32F1, and in [0, 255] if it's GRAY8.
+// Returns the number of bytes written.
+absl::StatusOr<int> EncodeMask(const MaskView& src, MaskEncoding encoding, int bits, uint8_t* dst, int dst_size);
+// Same as EncodeMask, but each pixel of the mask is a category, which is clamped to the maximum level.
+// As in ResizeCategoryMaskToRgba, the categories in a VEC32F1 mask are rounded to the nearest integer.
+absl::StatusOr<int> EncodeCategoryMask(const MaskView& src, MaskEncoding encoding, int bits, uint8_t* dst, int dst_size);
+
+absl::StatusOr<MaskHeader> ReadMaskHeader(const uint8_t* data, int size);
+
+// Decodes the mask into `dst`, which must have at least width * height bytes.
+absl::Status DecodeMask(const uint8_t* data, int size, uint8_t* dst, int dst_size);
+
+// Returns the ImageFrame that the packet holds (either ImageFrame or Image on CPU).
+// The returned pointer is valid as long as `packet` is alive.
+absl::StatusOr<std::shared_ptr<const mediapipe::ImageFrame>> GetMaskImageFrame(const mediapipe::Packet& packet);
+
+}  // namespace mp_api
+
+extern "C" {
+
+MP_CAPI(int) mp__GetMaxEncodedMaskSize__i_i_i_i(int width, int height, int encoding, int bits);
+MP_CAPI(MpReturnCode) mp_Packet__EncodeMask__i_i_Pui8_i(mediapipe::Packet* packet, int encoding, int bits, uint8_t* buffer, int buffer_size,
+                                                        absl::Status** status_out, int* size_out);
+MP_CAPI(MpReturnCode) mp_Packet__EncodeCategoryMask__i_i_Pui8_i(mediapipe::Packet* packet, int encoding, int bits, uint8_t* buffer, int buffer_size,
+                                                                absl::Status** status_out, int* size_out);
+MP_CAPI(MpReturnCode) mp__ReadMaskHeader__Pui8_i(const uint8_t* data, int size, absl::Status** status_out, mp_api::MaskHeader* header_out);
+MP_CAPI(MpReturnCode) mp__DecodeMask__Pui8_i_Pui8_i(const uint8_t* data, int size, uint8_t* buffer, int buffer_size, absl::Status** status_out);
+
+}  // extern "C"
+
+#endif  // MEDIAPIPE_API_UTIL_MASK_CODEC_H_
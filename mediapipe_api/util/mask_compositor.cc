@@ -0,0 +1,256 @@
+// Copyright (c) 2026 homuler
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+#include "mediapipe_api/util/mask_compositor.h"
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+#include "absl/strings/str_cat.h"
+#include "mediapipe_api/util/mask_codec.h"
+#include "mediapipe_api/util/segmentation_mask_util.h"
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define MP_API_COMPOSITOR_USE_SSE2 1
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define MP_API_COMPOSITOR_USE_NEON 1
+#endif
+
+namespace mp_api {
+
+namespace {
+
+// round(x / 255) for x in [0, 255 * 255]
+inline uint8_t Div255(uint32_t x) {
+  x += 128;
+  return static_cast<uint8_t>((x + (x >> 8)) >> 8);
+}
+
+// dst[i] = round((fg[i] * alpha[i] + bg[i] * (255 - alpha[i])) / 255)
+void BlendRow(const uint8_t* fg, const uint8_t* bg, const uint8_t* alpha, int n, uint8_t* dst) {
+  int i = 0;
+#if defined(MP_API_COMPOSITOR_USE_SSE2)
+  const __m128i zero = _mm_setzero_si128();
+  const __m128i k255 = _mm_set1_epi16(255);
+  const __m128i k128 = _mm_set1_epi16(128);
+  auto blend_half = [&](__m128i f, __m128i b, __m128i a) {
+    __m128i x = _mm_add_epi16(_mm_mullo_epi16(f, a), _mm_mullo_epi16(b, _mm_sub_epi16(k255, a)));
+    x = _mm_add_epi16(x, k128);
+    return _mm_srli_epi16(_mm_add_epi16(x, _mm_srli_epi16(x, 8)), 8);
+  };
+  for (; i + 16 <= n; i += 16) {
+    const __m128i f = _mm_loadu_si128(reinterpret_cast<const __m128i*>(fg + i));
+    const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bg + i));
+    const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(alpha + i));
+    const __m128i lo = blend_half(_mm_unpacklo_epi8(f, zero), _mm_unpacklo_epi8(b, zero), _mm_unpacklo_epi8(a, zero));
+    const __m128i hi = blend_half(_mm_unpackhi_epi8(f, zero), _mm_unpackhi_epi8(b, zero), _mm_unpackhi_epi8(a, zero));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_packus_epi16(lo, hi));
+  }
+#elif defined(MP_API_COMPOSITOR_USE_NEON)
+  for (; i + 16 <= n; i += 16) {
+    const uint8x16_t f = vld1q_u8(fg + i);
+    const uint8x16_t b = vld1q_u8(bg + i);
+    const uint8x16_t a = vld1q_u8(alpha + i);
+    const uint8x16_t ia = vmvnq_u8(a);
+    uint16x8_t lo = vmlal_u8(vmull_u8(vget_low_u8(f), vget_low_u8(a)), vget_low_u8(b), vget_low_u8(ia));
+    uint16x8_t hi = vmlal_u8(vmull_u8(vget_high_u8(f), vget_high_u8(a)), vget_high_u8(b), vget_high_u8(ia));
+    // (x + ((x + 128) >> 8) + 128) >> 8
+    lo = vrsraq_n_u16(lo, lo, 8);
+    hi = vrsraq_n_u16(hi, hi, 8);
+    vst1q_u8(dst + i, vcombine_u8(vrshrn_n_u16(lo, 8), vrshrn_n_u16(hi, 8)));
+  }
+#endif
+  for (; i < n; ++i) {
+    dst[i] = Div255(fg[i] * alpha[i] + bg[i] * (255 - alpha[i]));
+  }
+}
+
+// Repeats each alpha value `channels` times, so that it can be blended with interleaved pixels.
+void ExpandAlpha(const uint8_t* alpha, int width, int channels, uint8_t* dst) {
+  int x = 0;
+  if (channels == 4) {
+#if defined(MP_API_COMPOSITOR_USE_SSE2)
+    for (; x + 16 <= width; x += 16) {
+      const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(alpha + x));
+      const __m128i a2_lo = _mm_unpacklo_epi8(a, a);
+      const __m128i a2_hi = _mm_unpackhi_epi8(a, a);
+      auto* out = reinterpret_cast<__m128i*>(dst + 4 * x);
+      _mm_storeu_si128(out, _mm_unpacklo_epi16(a2_lo, a2_lo));
+      _mm_storeu_si128(out + 1, _mm_unpackhi_epi16(a2_lo, a2_lo));
+      _mm_storeu_si128(out + 2, _mm_unpacklo_epi16(a2_hi, a2_hi));
+      _mm_storeu_si128(out + 3, _mm_unpackhi_epi16(a2_hi, a2_hi));
+    }
+#elif defined(MP_API_COMPOSITOR_USE_NEON)
+    for (; x + 16 <= width; x += 16) {
+      const uint8x16_t a = vld1q_u8(alpha + x);
+      vst4q_u8(dst + 4 * x, (uint8x16x4_t{{a, a, a, a}}));
+    }
+#endif
+  }
+#if defined(MP_API_COMPOSITOR_USE_NEON)
+  if (channels == 3) {
+    for (; x + 16 <= width; x += 16) {
+      const uint8x16_t a = vld1q_u8(alpha + x);
+      vst3q_u8(dst + 3 * x, (uint8x16x3_t{{a, a, a}}));
+    }
+  }
+#endif
+  for (; x < width; ++x) {
+    std::memset(dst + channels * x, alpha[x], channels);
+  }
+}
+
+// Applies the box filter of the given radius to the alpha plane in place, replicating the border pixels.
+void FeatherAlpha(int width, int height, int radius, uint8_t* alpha) {
+  const int window = 2 * radius + 1;
+  const float inv_window = 1.0f / window;
+
+  // horizontal pass
+  thread_local std::vector<uint8_t> line;
+  line.resize(width);
+  for (auto y = 0; y < height; ++y) {
+    auto* row = alpha + y * width;
+    std::memcpy(line.data(), row, width);
+
+    int sum = line[0] * (radius + 1);
+    for (auto k = 1; k <= radius; ++k) {
+      sum += line[std::min(k, width - 1)];
+    }
+    for (auto x = 0; x < width; ++x) {
+      row[x] = static_cast<uint8_t>(sum * inv_window + 0.5f);
+      sum += line[std::min(x + radius + 1, width - 1)] - line[std::max(x - radius, 0)];
+    }
+  }
+
+  // vertical pass, which keeps the column sums so that the rows are accessed sequentially.
+  thread_local std::vector<uint8_t> source;
+  thread_local std::vector<int> sums;
+  source.assign(alpha, alpha + width * height);
+  sums.assign(width, 0);
+  auto source_row = [&](int y) { return source.data() + std::min(std::max(y, 0), height - 1) * width; };
+
+  for (auto k = -radius; k <= radius; ++k) {
+    const auto* row = source_row(k);
+    for (auto x = 0; x < width; ++x) {
+      sums[x] += row[x];
+    }
+  }
+  for (auto y = 0; y < height; ++y) {
+    auto* dst = alpha + y * width;
+    const auto* added = source_row(y + radius + 1);
+    const auto* removed = source_row(y - radius);
+    for (auto x = 0; x < width; ++x) {
+      dst[x] = static_cast<uint8_t>(sums[x] * inv_window + 0.5f);
+      sums[x] += added[x] - removed[x];
+    }
+  }
+}
+
+int GetChannels(mediapipe::ImageFormat::Format format) {
+  switch (format) {
+    case mediapipe::ImageFormat::SRGB:
+      return 3;
+    case mediapipe::ImageFormat::SRGBA:
+      return 4;
+    default:
+      return 0;
+  }
+}
+
+}  // namespace
+
+absl::Status CompositeMask(const mediapipe::ImageFrame& foreground, const mediapipe::ImageFrame* background, const mediapipe::ImageFrame& mask,
+                           const MaskCompositeOptions& options, uint8_t* dst, int dst_width_step) {
+  const int channels = GetChannels(foreground.Format());
+  if (channels == 0 || foreground.IsEmpty()) {
+    return absl::InvalidArgumentError(absl::StrCat("Unsupported foreground format: ", static_cast<int>(foreground.Format())));
+  }
+  const int width = foreground.Width();
+  const int height = foreground.Height();
+  if (background != nullptr &&
+      (background->Format() != foreground.Format() || background->Width() != width || background->Height() != height || background->IsEmpty())) {
+    return absl::InvalidArgumentError("The background must have the same format and size as the foreground");
+  }
+  if (dst == nullptr || dst_width_step < width * channels) {
+    return absl::InvalidArgumentError(absl::StrCat("Invalid destination: width_step = ", dst_width_step));
+  }
+  if (options.feather_radius < 0) {
+    return absl::InvalidArgumentError(absl::StrCat("Invalid feather radius: ", options.feather_radius));
+  }
+  auto mask_view = GetMaskView(mask);
+  if (!mask_view.ok()) {
+    return mask_view.status();
+  }
+
+  // NOTE: the scratch buffers are reused to avoid allocating memory every frame.
+  thread_local std::vector<uint8_t> alpha;
+  thread_local std::vector<uint8_t> alpha_row;
+  thread_local std::vector<uint8_t> color_row;
+  alpha.resize(width * height);
+  alpha_row.resize(width * channels);
+
+  if (auto status = ResizeMaskToUint8(*mask_view, width, height, -1.0f, alpha.data(), width); !status.ok()) {
+    return status;
+  }
+  if (options.feather_radius > 0) {
+    FeatherAlpha(width, height, options.feather_radius, alpha.data());
+  }
+  if (background == nullptr) {
+    color_row.resize(width * channels);
+    for (auto x = 0; x < width; ++x) {
+      std::memcpy(color_row.data() + channels * x, options.background_color, channels);
+    }
+  }
+
+  for (auto y = 0; y < height; ++y) {
+    const auto* fg_row = foreground.PixelData() + y * foreground.WidthStep();
+    const auto* bg_row = background == nullptr ? color_row.data() : background->PixelData() + y * background->WidthStep();
+    if (options.invert) {
+      std::swap(fg_row, bg_row);
+    }
+    ExpandAlpha(alpha.data() + y * width, width, channels, alpha_row.data());
+    BlendRow(fg_row, bg_row, alpha_row.data(), width * channels, dst + y * dst_width_step);
+  }
+  return absl::OkStatus();
+}
+
+}  // namespace mp_api
+
+namespace {
+
+absl::Status CompositeMaskPacket(const mediapipe::ImageFrame& foreground, const mediapipe::ImageFrame* background, const mediapipe::Packet& mask_packet,
+                                 uint32_t background_color, int feather_radius, bool invert, uint8_t* buffer, int buffer_size) {
+  const int width_step = foreground.Width() * foreground.NumberOfChannels();
+  if (static_cast<int64_t>(width_step) * foreground.Height() > buffer_size) {
+    return absl::InvalidArgumentError(
+        absl::StrCat("Insufficient buffer size: ", width_step * foreground.Height(), " bytes are required, but got ", buffer_size));
+  }
+  auto mask = mp_api::GetMaskImageFrame(mask_packet);
+  if (!mask.ok()) {
+    return mask.status();
+  }
+
+  mp_api::MaskCompositeOptions options;
+  std::memcpy(options.background_color, &background_color, sizeof(options.background_color));
+  options.feather_radius = feather_radius;
+  options.invert = invert;
+  return mp_api::CompositeMask(foreground, background, **mask, options, buffer, width_step);
+}
+
+}  // namespace
+
+MpReturnCode mp__CompositeMask__Pif_Pif_Ppacket_ui_i_b_Pui8_i(mediapipe::ImageFrame* foreground, mediapipe::ImageFrame* background,
+                                                              mediapipe::Packet* mask_packet, uint32_t background_color, int feather_radius, bool invert,
+                                                              uint8_t* buffer, int buffer_size, absl::Status** status_out) {
+  TRY_ALL
+    *status_out = new absl::Status{CompositeMaskPacket(*foreground, background, *mask_packet, background_color, feather_radius, invert, buffer, buffer_size)};
+    RETURN_CODE(MpReturnCode::Success);
+  CATCH_ALL
+}
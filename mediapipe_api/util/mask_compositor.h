@@ -0,0 +1,45 @@
+// Copyright (c) 2026 homuler
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+#ifndef MEDIAPIPE_API_UTIL_MASK_COMPOSITOR_H_
+#define MEDIAPIPE_API_UTIL_MASK_COMPOSITOR_H_
+
+#include <cstdint>
+
+#include "absl/status/status.h"
+#include "mediapipe/framework/formats/image_frame.h"
+#include "mediapipe/framework/packet.h"
+#include "mediapipe_api/common.h"
+
+namespace mp_api {
+
+struct MaskCompositeOptions {
+  // If `background` is null, the background is filled with this color (RGBA, in memory order).
+  uint8_t background_color[4];
+  // The radius of the box filter applied to the mask edge. 0 disables feathering.
+  int feather_radius;
+  // If true, the background is drawn where the mask is set.
+  bool invert;
+};
+
+// Blends `foreground` over `background` using `mask` as alpha, and writes the result to `dst`.
+// `foreground` and `background` must be SRGB or SRGBA with the same size and format, and `mask` must be VEC32F1 or GRAY8.
+// The mask is resized to the size of `foreground` if necessary.
+// `dst` must have at least `dst_width_step` * height bytes, and the result has the same format as `foreground`.
+absl::Status CompositeMask(const mediapipe::ImageFrame& foreground, const mediapipe::ImageFrame* background, const mediapipe::ImageFrame& mask,
+                           const MaskCompositeOptions& options, uint8_t* dst, int dst_width_step);
+
+}  // namespace mp_api
+
+extern "C" {
+
+MP_CAPI(MpReturnCode) mp__CompositeMask__Pif_Pif_Ppacket_ui_i_b_Pui8_i(mediapipe::ImageFrame* foreground, mediapipe::ImageFrame* background,
+                                                                       mediapipe::Packet* mask_packet, uint32_t background_color, int feather_radius,
+                                                                       bool invert, uint8_t* buffer, int buffer_size, absl::Status** status_out);
+
+}  // extern "C"
+
+#endif  // MEDIAPIPE_API_UTIL_MASK_COMPOSITOR_H_
@@ -0,0 +1,237 @@
+// Copyright (c) 2026 homuler
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+#include "mediapipe_api/util/resource_cache.h"
+
+#include <utility>
+
+#include "absl/strings/str_cat.h"
+#include "mediapipe/framework/port/logging.h"
+
+namespace mp_api {
+
+ResourceCache& ResourceCache::GetInstance() {
+  static auto* cache = new ResourceCache();
+  return *cache;
+}
+
+void ResourceCache::SetCallbacks(Resolver resolver, Loader loader) {
+  absl::MutexLock lock(&mutex_);
+  resolver_ = std::move(resolver);
+  loader_ = std::move(loader);
+}
+
+int64_t ResourceCache::capacity() const {
+  absl::MutexLock lock(&mutex_);
+  return capacity_;
+}
+
+void ResourceCache::set_capacity(int64_t capacity) {
+  if (capacity <= 0) {
+    {
+      absl::MutexLock lock(&mutex_);
+      capacity_ = 0;
+    }
+    Clear();
+    return;
+  }
+  absl::MutexLock lock(&mutex_);
+  capacity_ = capacity;
+  Evict();
+}
+
+absl::Status ResourceCache::Prefetch(const std::vector<std::string>& paths) {
+  Resolver resolver;
+  {
+    absl::MutexLock lock(&mutex_);
+    if (capacity_ == 0) {
+      return absl::FailedPreconditionError("ResourceCache is disabled");
+    }
+    if (!loader_) {
+      return absl::FailedPreconditionError("The custom resource provider is not set");
+    }
+    resolver = resolver_;
+  }
+
+  // NOTE: the PathResolver is called outside the lock, because it can call back into the managed code.
+  std::vector<std::string> keys;
+  keys.reserve(paths.size());
+  for (const auto& path : paths) {
+    auto status_or_key = resolver ? resolver(path) : absl::StatusOr<std::string>(path);
+    if (!status_or_key.ok()) {
+      return status_or_key.status();
+    }
+    if (status_or_key->empty()) {
+      return absl::NotFoundError(absl::StrCat("Failed to resolve ", path));
+    }
+    keys.push_back(std::move(status_or_key).value());
+  }
+
+  absl::MutexLock lock(&mutex_);
+  for (auto& key : keys) {
+    if (entries_.contains(key)) {
+      continue;
+    }
+    entries_[key] = Entry{};
+    GetThreadPool().Schedule([this, key = std::move(key)]() { Load(key); });
+  }
+  return absl::OkStatus();
+}
+
+std::shared_ptr<const std::string> ResourceCache::Get(const std::string& path) {
+  absl::MutexLock lock(&mutex_);
+  if (capacity_ == 0) {
+    return nullptr;
+  }
+  auto key = path;
+  auto it = entries_.find(key);
+  if (it == entries_.end()) {
+    // NOTE: the resources are cached by their resolved paths, but they can also be requested by the original paths.
+    if (auto resolved = resolved_paths_.find(path); resolved != resolved_paths_.end()) {
+      key = resolved->second;
+      it = entries_.find(key);
+    }
+  }
+  if (it != entries_.end() && it->second.contents == nullptr) {
+    auto is_loaded = [this, &key]() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mutex_) {
+      auto it = entries_.find(key);
+      return it == entries_.end() || it->second.contents != nullptr;
+    };
+    mutex_.Await(absl::Condition(&is_loaded));
+    // NOTE: the entry is removed if it fails to be read, or it's cleared.
+    it = entries_.find(key);
+  }
+  if (it == entries_.end()) {
+    ++misses_;
+    return nullptr;
+  }
+  lru_.splice(lru_.begin(), lru_, it->second.lru_position);
+  ++hits_;
+  return it->second.contents;
+}
+
+std::optional<std::string> ResourceCache::GetResolvedPath(const std::string& path) {
+  absl::MutexLock lock(&mutex_);
+  if (capacity_ == 0) {
+    return std::nullopt;
+  }
+  auto it = resolved_paths_.find(path);
+  if (it == resolved_paths_.end()) {
+    return std::nullopt;
+  }
+  ++resolved_path_hits_;
+  return it->second;
+}
+
+void ResourceCache::PutResolvedPath(const std::string& path, const std::string& resolved_path) {
+  absl::MutexLock lock(&mutex_);
+  if (capacity_ > 0) {
+    resolved_paths_[path] = resolved_path;
+  }
+}
+
+void ResourceCache::Clear() {
+  absl::MutexLock lock(&mutex_);
+  entries_.clear();
+  lru_.clear();
+  bytes_ = 0;
+  resolved_paths_.clear();
+}
+
+void ResourceCache::ClearResolvedPaths() {
+  absl::MutexLock lock(&mutex_);
+  resolved_paths_.clear();
+}
+
+ResourceCacheStats ResourceCache::GetStats() {
+  absl::MutexLock lock(&mutex_);
+  return ResourceCacheStats{hits_, misses_, prefetched_, evictions_, resolved_path_hits_, static_cast<int64_t>(lru_.size()), bytes_};
+}
+
+void ResourceCache::Load(const std::string& key) {
+  Loader loader;
+  {
+    absl::MutexLock lock(&mutex_);
+    loader = loader_;
+  }
+  std::string contents;
+  const auto status = loader(key, &contents);
+
+  absl::MutexLock lock(&mutex_);
+  ++prefetched_;
+  auto it = entries_.find(key);
+  if (it == entries_.end() || it->second.contents != nullptr) {
+    // cleared in the meantime
+    return;
+  }
+  if (!status.ok()) {
+    LOG(WARNING) << "Failed to prefetch " << key << ": " << status;
+    entries_.erase(it);
+    return;
+  }
+  Insert(key, std::make_shared<const std::string>(std::move(contents)));
+}
+
+void ResourceCache::Insert(const std::string& key, std::shared_ptr<const std::string> contents) {
+  const auto size = static_cast<int64_t>(contents->size());
+  if (size > capacity_) {
+    // NOTE: remove the pending entry, so that the waiting readers fall back to the resource provider.
+    if (auto it = entries_.find(key); it != entries_.end() && it->second.contents == nullptr) {
+      entries_.erase(it);
+    }
+    return;
+  }
+
+  auto& entry = entries_[key];
+  if (entry.contents != nullptr) {
+    bytes_ -= static_cast<int64_t>(entry.contents->size());
+    lru_.erase(entry.lru_position);
+  }
+  entry.contents = std::move(contents);
+  lru_.push_front(key);
+  entry.lru_position = lru_.begin();
+  bytes_ += size;
+  Evict();
+}
+
+void ResourceCache::Evict() {
+  // NOTE: the entries being prefetched are not in `lru_`, so they are never evicted.
+  while (bytes_ > capacity_ && !lru_.empty()) {
+    auto it = entries_.find(lru_.back());
+    bytes_ -= static_cast<int64_t>(it->second.contents->size());
+    entries_.erase(it);
+    lru_.pop_back();
+    ++evictions_;
+  }
+}
+
+mediapipe::ThreadPool& ResourceCache::GetThreadPool() {
+  if (thread_pool_ == nullptr) {
+    thread_pool_ = std::make_unique<mediapipe::ThreadPool>("mp_resource", kNumThreads);
+    thread_pool_->StartWorkers();
+  }
+  return *thread_pool_;
+}
+
+}  // namespace mp_api
+
+int64_t mp_ResourceCache__capacity() { return mp_api::ResourceCache::GetInstance().capacity(); }
+
+void mp_ResourceCache__set_capacity__ll(int64_t capacity) { mp_api::ResourceCache::GetInstance().set_capacity(capacity); }
+
+MpReturnCode mp_ResourceCache__Prefetch__PPKc_i(const char** paths, int size, absl::Status** status_out) {
+  TRY_ALL
+    std::vector<std::string> path_vec(paths, paths + size);
+    *status_out = new absl::Status{mp_api::ResourceCache::GetInstance().Prefetch(path_vec)};
+    RETURN_CODE(MpReturnCode::Success);
+  CATCH_ALL
+}
+
+void mp_ResourceCache__Clear() { mp_api::ResourceCache::GetInstance().Clear(); }
+
+void mp_ResourceCache__ClearResolvedPaths() { mp_api::ResourceCache::GetInstance().ClearResolvedPaths(); }
+
+void mp_ResourceCache__GetStats(mp_api::ResourceCacheStats* stats_out) { *stats_out = mp_api::ResourceCache::GetInstance().GetStats(); }
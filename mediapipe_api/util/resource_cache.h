@@ -0,0 +1,134 @@
+// Copyright (c) 2026 homuler
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+#ifndef MEDIAPIPE_API_UTIL_RESOURCE_CACHE_H_
+#define MEDIAPIPE_API_UTIL_RESOURCE_CACHE_H_
+
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "absl/synchronization/mutex.h"
+#include "mediapipe/framework/port/threadpool.h"
+#include "mediapipe_api/common.h"
+#include "mediapipe_api/external/absl/status.h"
+
+namespace mp_api {
+
+struct ResourceCacheStats {
+  // The number of the resources found in the cache (including the ones waited for while they were prefetched).
+  int64_t hits;
+  // The number of the resources read synchronously because they were not prefetched.
+  int64_t misses;
+  // The number of the resources read by Prefetch.
+  int64_t prefetched;
+  // The number of the resources evicted to keep the cache within the capacity.
+  int64_t evictions;
+  // The number of the path resolutions answered without calling the PathResolver.
+  int64_t resolved_path_hits;
+  // The number of the resources currently in the cache, and their total size in bytes.
+  int64_t entries;
+  int64_t bytes;
+};
+
+// A process-wide LRU cache of the resource contents prefetched by the ResourceProvider, and of the paths resolved by the PathResolver.
+//
+// The resources can be prefetched on background threads before the graphs are initialized, so that the calculators don't have to wait for
+// the managed I/O (e.g. the extraction of the Android assets) on the thread that initializes the graph.
+// The resources read synchronously are not cached, since their copies would double the peak memory usage while the models are loaded.
+// The cache is disabled until its capacity is set.
+class ResourceCache {
+ public:
+  // Resolves the path of a resource, which is the key of the cache.
+  using Resolver = std::function<absl::StatusOr<std::string>(const std::string& path)>;
+  // Reads a resource without using the cache.
+  using Loader = std::function<absl::Status(const std::string& path, std::string* output)>;
+
+  static constexpr int kNumThreads = 4;
+
+  static ResourceCache& GetInstance();
+
+  // Called when the custom resource provider is installed.
+  void SetCallbacks(Resolver resolver, Loader loader);
+
+  int64_t capacity() const;
+  // Sets the maximum total size of the cached resources in bytes. If it's 0, the cache is disabled and cleared.
+  void set_capacity(int64_t capacity);
+
+  // Starts reading the resources on background threads, and returns immediately.
+  // `paths` are resolved on the calling thread, so that the PathResolver is called in the same way as the graphs do.
+  // Returns FailedPreconditionError if the cache is disabled or the resource provider is not installed.
+  absl::Status Prefetch(const std::vector<std::string>& paths);
+
+  // Returns the cached contents of `path`, waiting for them if they are being prefetched.
+  // Returns nullptr if they are not cached.
+  std::shared_ptr<const std::string> Get(const std::string& path);
+
+  // Returns the path resolved for `path` before, if any.
+  std::optional<std::string> GetResolvedPath(const std::string& path);
+  void PutResolvedPath(const std::string& path, const std::string& resolved_path);
+
+  // Removes the cached contents and the resolved paths. The resources being prefetched are discarded when they are read.
+  void Clear();
+  // Removes only the resolved paths, which should be called when the asset paths are changed.
+  void ClearResolvedPaths();
+
+  ResourceCacheStats GetStats();
+
+ private:
+  struct Entry {
+    // nullptr while it's being prefetched.
+    std::shared_ptr<const std::string> contents;
+    std::list<std::string>::iterator lru_position;
+  };
+
+  ResourceCache() = default;
+
+  void Load(const std::string& key);
+  void Insert(const std::string& key, std::shared_ptr<const std::string> contents) ABSL_EXCLUSIVE_LOCKS_REQUIRED(mutex_);
+  void Evict() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mutex_);
+  mediapipe::ThreadPool& GetThreadPool() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mutex_);
+
+  mutable absl::Mutex mutex_;
+  Resolver resolver_ ABSL_GUARDED_BY(mutex_);
+  Loader loader_ ABSL_GUARDED_BY(mutex_);
+  int64_t capacity_ ABSL_GUARDED_BY(mutex_) = 0;
+  int64_t bytes_ ABSL_GUARDED_BY(mutex_) = 0;
+  absl::flat_hash_map<std::string, Entry> entries_ ABSL_GUARDED_BY(mutex_);
+  // The keys of the loaded entries, most recently used first.
+  std::list<std::string> lru_ ABSL_GUARDED_BY(mutex_);
+  absl::flat_hash_map<std::string, std::string> resolved_paths_ ABSL_GUARDED_BY(mutex_);
+  std::unique_ptr<mediapipe::ThreadPool> thread_pool_ ABSL_GUARDED_BY(mutex_);
+
+  int64_t hits_ ABSL_GUARDED_BY(mutex_) = 0;
+  int64_t misses_ ABSL_GUARDED_BY(mutex_) = 0;
+  int64_t prefetched_ ABSL_GUARDED_BY(mutex_) = 0;
+  int64_t evictions_ ABSL_GUARDED_BY(mutex_) = 0;
+  int64_t resolved_path_hits_ ABSL_GUARDED_BY(mutex_) = 0;
+};
+
+}  // namespace mp_api
+
+extern "C" {
+
+MP_CAPI(int64_t) mp_ResourceCache__capacity();
+MP_CAPI(void) mp_ResourceCache__set_capacity__ll(int64_t capacity);
+MP_CAPI(MpReturnCode) mp_ResourceCache__Prefetch__PPKc_i(const char** paths, int size, absl::Status** status_out);
+MP_CAPI(void) mp_ResourceCache__Clear();
+MP_CAPI(void) mp_ResourceCache__ClearResolvedPaths();
+MP_CAPI(void) mp_ResourceCache__GetStats(mp_api::ResourceCacheStats* stats_out);
+
+}  // extern "C"
+
+#endif  // MEDIAPIPE_API_UTIL_RESOURCE_CACHE_H_
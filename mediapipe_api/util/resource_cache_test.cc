@@ -0,0 +1,157 @@
+// Copyright (c) 2026 homuler
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+#include "mediapipe_api/util/resource_cache.h"
+
+#include <atomic>
+#include <string>
+
+#include "absl/status/status.h"
+#include "absl/strings/str_cat.h"
+#include "gtest/gtest.h"
+
+namespace mp_api {
+namespace {
+
+constexpr char kResolvedPrefix[] = "resolved/";
+
+// The contents of each resource are 10 bytes.
+std::string GetContents(const std::string& key) { return absl::StrCat(key.substr(key.size() - 1), "123456789"); }
+
+class ResourceCacheTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    cache().set_capacity(0);
+    cache().SetCallbacks([](const std::string& path) -> absl::StatusOr<std::string> { return absl::StrCat(kResolvedPrefix, path); },
+                         [this](const std::string& path, std::string* output) {
+                           ++load_count_;
+                           if (path == absl::StrCat(kResolvedPrefix, "broken")) {
+                             return absl::UnavailableError("broken");
+                           }
+                           *output = GetContents(path);
+                           return absl::OkStatus();
+                         });
+    initial_stats_ = cache().GetStats();
+  }
+
+  void TearDown() override {
+    cache().set_capacity(0);
+    cache().SetCallbacks(nullptr, nullptr);
+  }
+
+  static ResourceCache& cache() { return ResourceCache::GetInstance(); }
+
+  // Prefetches `path` and waits for it to be cached.
+  void PrefetchAndWait(const std::string& path) {
+    ASSERT_TRUE(cache().Prefetch({path}).ok());
+    ASSERT_NE(cache().Get(absl::StrCat(kResolvedPrefix, path)), nullptr);
+  }
+
+  std::atomic<int> load_count_ = 0;
+  ResourceCacheStats initial_stats_;
+};
+
+TEST_F(ResourceCacheTest, Prefetch_ShouldFail_When_TheCacheIsDisabled) {
+  EXPECT_TRUE(absl::IsFailedPrecondition(cache().Prefetch({"a"})));
+  EXPECT_EQ(load_count_, 0);
+}
+
+TEST_F(ResourceCacheTest, Get_ShouldReturnThePrefetchedContents) {
+  cache().set_capacity(1024);
+  ASSERT_TRUE(cache().Prefetch({"a", "b"}).ok());
+
+  auto contents = cache().Get("resolved/a");
+  ASSERT_NE(contents, nullptr);
+  EXPECT_EQ(*contents, GetContents("a"));
+  contents = cache().Get("resolved/b");
+  ASSERT_NE(contents, nullptr);
+  EXPECT_EQ(*contents, GetContents("b"));
+  // NOTE: the resources being prefetched or cached are not read again.
+  ASSERT_TRUE(cache().Prefetch({"a"}).ok());
+  EXPECT_NE(cache().Get("resolved/a"), nullptr);
+  EXPECT_EQ(load_count_, 2);
+
+  const auto stats = cache().GetStats();
+  EXPECT_EQ(stats.hits - initial_stats_.hits, 3);
+  EXPECT_EQ(stats.prefetched - initial_stats_.prefetched, 2);
+  EXPECT_EQ(stats.entries, 2);
+  EXPECT_EQ(stats.bytes, 20);
+}
+
+TEST_F(ResourceCacheTest, Get_ShouldReturnNull_When_TheResourceIsNotPrefetched) {
+  cache().set_capacity(1024);
+
+  EXPECT_EQ(cache().Get("resolved/a"), nullptr);
+  EXPECT_EQ(cache().GetStats().misses - initial_stats_.misses, 1);
+  EXPECT_EQ(cache().GetStats().entries, 0);
+}
+
+TEST_F(ResourceCacheTest, Get_ShouldReturnNull_When_ThePrefetchFails) {
+  cache().set_capacity(1024);
+  ASSERT_TRUE(cache().Prefetch({"broken"}).ok());
+
+  EXPECT_EQ(cache().Get("resolved/broken"), nullptr);
+  EXPECT_EQ(cache().GetStats().entries, 0);
+}
+
+TEST_F(ResourceCacheTest, Prefetch_ShouldEvictTheLeastRecentlyUsedResources) {
+  cache().set_capacity(25);
+  PrefetchAndWait("a");
+  PrefetchAndWait("b");
+  // NOTE: "a" is used more recently than "b".
+  ASSERT_NE(cache().Get("resolved/a"), nullptr);
+  PrefetchAndWait("c");
+
+  EXPECT_NE(cache().Get("resolved/a"), nullptr);
+  EXPECT_EQ(cache().Get("resolved/b"), nullptr);
+  EXPECT_NE(cache().Get("resolved/c"), nullptr);
+  const auto stats = cache().GetStats();
+  EXPECT_EQ(stats.evictions - initial_stats_.evictions, 1);
+  EXPECT_EQ(stats.entries, 2);
+  EXPECT_EQ(stats.bytes, 20);
+}
+
+TEST_F(ResourceCacheTest, SetCapacity_ShouldEvictTheResources_When_ItIsDecreased) {
+  cache().set_capacity(1024);
+  PrefetchAndWait("a");
+  PrefetchAndWait("b");
+
+  cache().set_capacity(15);
+  EXPECT_EQ(cache().Get("resolved/a"), nullptr);
+  EXPECT_NE(cache().Get("resolved/b"), nullptr);
+  EXPECT_EQ(cache().GetStats().bytes, 10);
+}
+
+TEST_F(ResourceCacheTest, GetResolvedPath_ShouldReturnTheMemoizedPath) {
+  cache().set_capacity(1024);
+  EXPECT_EQ(cache().GetResolvedPath("a"), std::nullopt);
+
+  cache().PutResolvedPath("a", "resolved/a");
+  EXPECT_EQ(cache().GetResolvedPath("a"), "resolved/a");
+  EXPECT_EQ(cache().GetStats().resolved_path_hits - initial_stats_.resolved_path_hits, 1);
+
+  cache().ClearResolvedPaths();
+  EXPECT_EQ(cache().GetResolvedPath("a"), std::nullopt);
+}
+
+TEST_F(ResourceCacheTest, GetResolvedPath_ShouldReturnNothing_When_TheCacheIsDisabled) {
+  cache().PutResolvedPath("a", "resolved/a");
+
+  EXPECT_EQ(cache().GetResolvedPath("a"), std::nullopt);
+}
+
+TEST_F(ResourceCacheTest, Get_ShouldReturnThePrefetchedContents_When_TheOriginalPathIsRequested) {
+  cache().set_capacity(1024);
+  PrefetchAndWait("a");
+  cache().PutResolvedPath("a", "resolved/a");
+
+  auto contents = cache().Get("a");
+  ASSERT_NE(contents, nullptr);
+  EXPECT_EQ(*contents, GetContents("a"));
+}
+
+}  // namespace
+}  // namespace mp_api
@@ -6,23 +6,253 @@
 
 #include "mediapipe_api/util/resource_util_custom.h"
 
+#include <atomic>
+#include <cstdio>
+#include <filesystem>
+#include <system_error>
+#include <utility>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
+#include "absl/strings/str_format.h"
 #include "absl/strings/str_cat.h"
+#include "absl/synchronization/mutex.h"
+#include "absl/time/time.h"
+#include "mediapipe/framework/port/file_helpers.h"
+#include "mediapipe/framework/port/logging.h"
 #include "mediapipe/framework/port/ret_check.h"
+#include "mediapipe/framework/port/status_macros.h"
+#include "mediapipe_api/framework/startup_profiler.h"
+#include "mediapipe_api/util/cache_file_util.h"
+#include "mediapipe_api/util/resource_cache.h"
 
-void mp__SetCustomGlobalResourceProvider__P(ResourceProvider* resource_provider) {
-  mediapipe::SetCustomGlobalResourceProvider([resource_provider](const std::string& path, std::string* output) -> ::absl::Status {
-    if (resource_provider(path.c_str(), output)) {
-      return absl::OkStatus();
+namespace {
+
+std::atomic<ResourceProvider*> custom_resource_provider = nullptr;
+std::atomic<PathResolver*> custom_path_resolver = nullptr;
+std::atomic<ResourceLocator*> custom_resource_locator = nullptr;
+
+absl::Mutex asset_bundle_mutex;
+std::shared_ptr<const mp_api::AssetBundle> asset_bundle ABSL_GUARDED_BY(asset_bundle_mutex);
+// The files extracted from `asset_bundle` (see ExtractBundledAsset), keyed by the requested paths.
+absl::flat_hash_map<std::string, std::string> extracted_asset_paths ABSL_GUARDED_BY(asset_bundle_mutex);
+std::string asset_extraction_directory ABSL_GUARDED_BY(asset_bundle_mutex);
+// Held while an asset is extracted, so that the same file is not written concurrently.
+absl::Mutex asset_extraction_mutex ABSL_ACQUIRED_BEFORE(asset_bundle_mutex);
+
+std::shared_ptr<const mp_api::AssetBundle> GetAssetBundle() {
+  absl::MutexLock lock(&asset_bundle_mutex);
+  return asset_bundle;
+}
+
+void ResetAssetBundle(std::shared_ptr<const mp_api::AssetBundle> bundle) {
+  absl::MutexLock lock(&asset_bundle_mutex);
+  asset_bundle = std::move(bundle);
+  extracted_asset_paths.clear();
+}
+
+// Writes the asset in the bundle to a file, since some callers open the resolved path directly instead of reading it by GetResourceContents.
+// The file name contains the fingerprint of the contents, so the file extracted by a previous run is reused unless the asset is changed.
+absl::StatusOr<std::string> ExtractBundledAsset(const std::shared_ptr<const mp_api::AssetBundle>& bundle, const std::string& path)
+    ABSL_LOCKS_EXCLUDED(asset_extraction_mutex, asset_bundle_mutex) {
+  absl::MutexLock extraction_lock(&asset_extraction_mutex);
+  std::string directory;
+  {
+    absl::MutexLock lock(&asset_bundle_mutex);
+    if (bundle == asset_bundle) {
+      if (auto it = extracted_asset_paths.find(path); it != extracted_asset_paths.end()) {
+        return it->second;
+      }
+    }
+    directory = asset_extraction_directory;
+  }
+  if (directory.empty()) {
+    std::error_code error;
+    directory = std::filesystem::temp_directory_path(error).string();
+    if (error || directory.empty()) {
+      return absl::FailedPreconditionError(
+          absl::StrCat("Failed to extract ", path, " from the asset bundle, since the extraction directory is not set and the temporary directory is not found"));
+    }
+  }
+
+  MP_ASSIGN_OR_RETURN(auto contents, bundle->Get(path));
+  const auto base_name = path.substr(path.find_last_of("/\\") + 1);
+  const auto file_path = absl::StrFormat("%s/%016x_%s", directory, mp_api::Fingerprint(*contents), base_name);
+  std::error_code error;
+  if (std::filesystem::file_size(file_path, error) != contents->size() || error) {
+    if (!mp_api::WriteFileAtomically(file_path, [&contents](std::ostream& file) { return static_cast<bool>(file.write(contents->data(), contents->size())); })) {
+      return absl::UnavailableError(absl::StrCat("Failed to extract ", path, " from the asset bundle to ", file_path));
+    }
+  }
+
+  absl::MutexLock lock(&asset_bundle_mutex);
+  // NOTE: don't memoize the path if the bundle has been replaced while extracting the asset.
+  if (bundle == asset_bundle) {
+    extracted_asset_paths[path] = file_path;
+  }
+  return file_path;
+}
+
+// Reads the resource by the managed ResourceProvider, which can be slow (e.g. the extraction of the Android assets).
+absl::Status ReadResourceContents(const std::string& path, std::string* output) {
+  auto* resource_provider = custom_resource_provider.load();
+  if (resource_provider == nullptr) {
+    // NOTE: the provider is set only to read the asset bundle or the mapped files, so read the other files as MediaPipe does by default.
+    return mediapipe::file::GetContents(path, output, true);
+  }
+  if (resource_provider(path.c_str(), output)) {
+    return absl::OkStatus();
+  }
+  return absl::FailedPreconditionError(absl::StrCat("Failed to read ", path));
+}
+
+absl::Status ReadCachedResourceContents(const std::string& path, std::string* output) {
+  auto status_or_buffer = mp_api::GetResourceBuffer(path);
+  if (status_or_buffer.ok()) {
+    // NOTE: the legacy calculators need a std::string, but the contents are copied without going through the managed memory.
+    const auto& contents = *status_or_buffer.value();
+    output->assign(contents.data(), contents.size());
+    return absl::OkStatus();
+  }
+  if (!absl::IsNotFound(status_or_buffer.status())) {
+    return status_or_buffer.status();
+  }
+
+  auto& cache = mp_api::ResourceCache::GetInstance();
+  if (auto contents = cache.Get(path); contents != nullptr) {
+    *output = *contents;
+    return absl::OkStatus();
+  }
+  // NOTE: only the prefetched resources are cached, so that the resource is not copied while it's loaded.
+  return ReadResourceContents(path, output);
+}
+
+absl::Status GetResourceContents(const std::string& path, std::string* output) {
+  const auto start = absl::Now();
+  MP_RETURN_IF_ERROR(ReadCachedResourceContents(path, output));
+  mp_api::StartupProfiler::GetInstance().RecordActive(mp_api::StartupPhaseType::kModelLoad, path, start);
+  return absl::OkStatus();
+}
+
+absl::StatusOr<std::string> PathToResourceAsFile(const std::string& path) {
+  if (auto bundle = GetAssetBundle(); bundle != nullptr && bundle->Contains(path)) {
+    return ExtractBundledAsset(bundle, path);
+  }
+  auto* path_resolver = custom_path_resolver.load();
+  if (path_resolver == nullptr) {
+    return path;
+  }
+  auto& cache = mp_api::ResourceCache::GetInstance();
+  if (auto resolved_path = cache.GetResolvedPath(path)) {
+    return *std::move(resolved_path);
+  }
+  auto resolved_path = path_resolver(path.c_str());
+
+  RET_CHECK_NE(resolved_path, nullptr);
+  std::string result(resolved_path);
+  // NOTE: an empty path means that the resolver failed, which may succeed after the asset is registered.
+  if (!result.empty()) {
+    cache.PutResolvedPath(path, result);
+  }
+  return result;
+}
+
+void InstallResourceProvider() {
+  mediapipe::SetCustomGlobalResourceProvider(GetResourceContents);
+  mp_api::ResourceCache::GetInstance().SetCallbacks(PathToResourceAsFile, ReadResourceContents);
+}
+
+void SetAssetBundle(std::shared_ptr<const mp_api::AssetBundle> bundle) {
+  if (!bundle->aligned()) {
+    LOG(WARNING) << "The asset bundle is not aligned in the file, so the uncompressed assets are copied onto the heap when they are read";
+  }
+  ResetAssetBundle(std::move(bundle));
+  InstallResourceProvider();
+  mediapipe::SetCustomGlobalPathResolver(PathToResourceAsFile);
+}
+
+}  // namespace
+
+namespace mp_api {
+
+absl::StatusOr<std::shared_ptr<const MappedFile>> MapResource(const std::string& path) {
+  auto* resource_locator = custom_resource_locator.load();
+  if (resource_locator == nullptr) {
+    return absl::NotFoundError("ResourceLocator is not set");
+  }
+  ResourceLocation location{nullptr, -1, 0, -1};
+  if (!resource_locator(path.c_str(), &location)) {
+    return absl::NotFoundError(absl::StrCat("Failed to locate ", path));
+  }
+  if (location.path == nullptr) {
+    return MappedFile::MapDescriptor(location.fd, location.offset, location.length);
+  }
+  const std::string file_path(location.path);
+  freeHGlobal(location.path);
+  return MappedFile::Map(file_path, location.offset, location.length);
+}
+
+absl::StatusOr<std::shared_ptr<const absl::string_view>> GetResourceBuffer(const std::string& path) {
+  if (auto bundle = GetAssetBundle(); bundle != nullptr && bundle->Contains(path)) {
+    return bundle->Get(path);
+  }
+  auto status_or_mapped_file = MapResource(path);
+  if (!status_or_mapped_file.ok()) {
+    if (absl::IsNotFound(status_or_mapped_file.status())) {
+      return status_or_mapped_file.status();
     }
-    return absl::FailedPreconditionError(absl::StrCat("Failed to read ", path));
-  });
+    // NOTE: the located file may not be mappable (e.g. it cannot be opened due to the permission), but ResourceProvider may still read it.
+    LOG(WARNING) << "Failed to map " << path << ", so it's read by ResourceProvider: " << status_or_mapped_file.status();
+    return absl::NotFoundError(absl::StrCat("Failed to map ", path, ": ", status_or_mapped_file.status().message()));
+  }
+  auto mapped_file = std::move(status_or_mapped_file).value();
+  return std::shared_ptr<const absl::string_view>(mapped_file, &mapped_file->contents());
+}
+
+}  // namespace mp_api
+
+void mp__SetCustomGlobalResourceProvider__P(ResourceProvider* resource_provider) {
+  custom_resource_provider = resource_provider;
+  InstallResourceProvider();
 }
 
 void mp__SetCustomGlobalPathResolver__P(PathResolver* path_resolver) {
-  mediapipe::SetCustomGlobalPathResolver([path_resolver](const std::string& path) -> ::absl::StatusOr<std::string> {
-    auto resolved_path = path_resolver(path.c_str());
+  custom_path_resolver = path_resolver;
+  mp_api::ResourceCache::GetInstance().ClearResolvedPaths();
+  mediapipe::SetCustomGlobalPathResolver(PathToResourceAsFile);
+}
+
+void mp__SetCustomGlobalResourceLocator__P(ResourceLocator* resource_locator) {
+  custom_resource_locator = resource_locator;
+  InstallResourceProvider();
+}
+
+MpReturnCode mp__SetCustomGlobalAssetBundle__PKc_ll_ll(const char* path, int64_t offset, int64_t length, absl::Status** status_out) {
+  TRY_ALL
+    auto status_or_bundle = mp_api::AssetBundle::Open(path, offset, length);
+    if (status_or_bundle.ok()) {
+      SetAssetBundle(std::move(status_or_bundle).value());
+    }
+    *status_out = new absl::Status{status_or_bundle.status()};
+    RETURN_CODE(MpReturnCode::Success);
+  CATCH_ALL
+}
+
+MpReturnCode mp__SetCustomGlobalAssetBundle__i_ll_ll(int fd, int64_t offset, int64_t length, absl::Status** status_out) {
+  TRY_ALL
+    auto status_or_bundle = mp_api::AssetBundle::OpenDescriptor(fd, offset, length);
+    if (status_or_bundle.ok()) {
+      SetAssetBundle(std::move(status_or_bundle).value());
+    }
+    *status_out = new absl::Status{status_or_bundle.status()};
+    RETURN_CODE(MpReturnCode::Success);
+  CATCH_ALL
+}
+
+void mp__ClearCustomGlobalAssetBundle() { ResetAssetBundle(nullptr); }
 
-    RET_CHECK_NE(resolved_path, nullptr);
-    return std::string(resolved_path);
-  });
+void mp__SetAssetBundleExtractionDirectory__PKc(const char* directory) {
+  absl::MutexLock lock(&asset_bundle_mutex);
+  asset_extraction_directory = directory;
+  extracted_asset_paths.clear();
 }
@@ -7,19 +7,62 @@
 #ifndef MEDIAPIPE_API_UTIL_RESOURCE_UTIL_CUSTOM_H_
 #define MEDIAPIPE_API_UTIL_RESOURCE_UTIL_CUSTOM_H_
 
+#include <cstdint>
+#include <memory>
 #include <string>
 
+#include "absl/status/statusor.h"
+#include "absl/strings/string_view.h"
 #include "mediapipe/util/resource_util_custom.h"
 #include "mediapipe_api/common.h"
+#include "mediapipe_api/external/absl/status.h"
+#include "mediapipe_api/util/asset_bundle.h"
+#include "mediapipe_api/util/mapped_file.h"
 
 extern "C" {
 
+// The location of a resource, which is a range of a file specified by either `path` or `fd`.
+typedef struct {
+  // A UTF-8 string allocated by the caller, and freed by `mp_api::freeHGlobal`. If it's null, `fd` is used.
+  char* path;
+  int fd;
+  int64_t offset;
+  // If it's negative, the resource spans to the end of the file.
+  int64_t length;
+} ResourceLocation;
+
 typedef bool ResourceProvider(const char* path, std::string* output);
 typedef const char* PathResolver(const char* path);
+typedef bool ResourceLocator(const char* path, ResourceLocation* location_out);
 
 MP_CAPI(void) mp__SetCustomGlobalResourceProvider__P(ResourceProvider* resource_provider);
 MP_CAPI(void) mp__SetCustomGlobalPathResolver__P(PathResolver* path_resolver);
+// If the locator is set, the resources are memory-mapped instead of being read by the ResourceProvider.
+// When the locator returns false or the located file cannot be mapped, the ResourceProvider is used as before.
+MP_CAPI(void) mp__SetCustomGlobalResourceLocator__P(ResourceLocator* resource_locator);
+
+// Serves the assets in the bundle (see pack_asset_bundle.py) before the ones located by the other callbacks.
+// The bundle can be a range of a file (e.g. an uncompressed asset in an APK). It replaces the bundle set before.
+MP_CAPI(MpReturnCode) mp__SetCustomGlobalAssetBundle__PKc_ll_ll(const char* path, int64_t offset, int64_t length, absl::Status** status_out);
+MP_CAPI(MpReturnCode) mp__SetCustomGlobalAssetBundle__i_ll_ll(int fd, int64_t offset, int64_t length, absl::Status** status_out);
+MP_CAPI(void) mp__ClearCustomGlobalAssetBundle();
+// Sets the UTF-8 path of the directory to which the bundled assets are extracted when their file paths are required.
+// By default, they are extracted to the temporary directory, which may not exist (e.g. on Android).
+MP_CAPI(void) mp__SetAssetBundleExtractionDirectory__PKc(const char* directory);
 
 }  // extern "C"
 
+namespace mp_api {
+
+// Maps the resource located by the ResourceLocator.
+// Returns NotFoundError if the locator is not set or cannot locate `path`.
+absl::StatusOr<std::shared_ptr<const MappedFile>> MapResource(const std::string& path);
+
+// Returns the resource in the asset bundle, or the one mapped by MapResource, without copying it onto the heap unless it's compressed.
+// Returns NotFoundError if neither has the resource, or if the located resource cannot be mapped (e.g. due to the permission),
+// so that the callers fall back to the ResourceProvider.
+absl::StatusOr<std::shared_ptr<const absl::string_view>> GetResourceBuffer(const std::string& path);
+
+}  // namespace mp_api
+
 #endif  // MEDIAPIPE_API_UTIL_RESOURCE_UTIL_CUSTOM_H_
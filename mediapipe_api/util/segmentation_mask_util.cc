@@ -0,0 +1,301 @@
+// Copyright (c) 2026 homuler
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+#include "mediapipe_api/util/segmentation_mask_util.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+#include "absl/strings/str_cat.h"
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define MP_API_MASK_USE_SSE2 1
+#elif defined(__aarch64__)
+#include <arm_neon.h>
+#define MP_API_MASK_USE_NEON 1
+#endif
+
+namespace mp_api {
+
+namespace {
+
+struct LinearTap {
+  int i0;
+  int i1;
+  float w;
+};
+
+// Maps the destination pixel centers to the source pixel centers in the same way as cv::INTER_LINEAR.
+inline LinearTap ComputeLinearTap(int dst_index, float scale, int src_size) {
+  float s = (dst_index + 0.5f) * scale - 0.5f;
+  if (s <= 0.0f) {
+    return {0, 0, 0.0f};
+  }
+  auto i0 = static_cast<int>(s);
+  if (i0 >= src_size - 1) {
+    return {src_size - 1, src_size - 1, 0.0f};
+  }
+  return {i0, i0 + 1, s - i0};
+}
+
+void ComputeLinearTaps(int src_size, int dst_size, std::vector<LinearTap>* taps) {
+  taps->resize(dst_size);
+  const float scale = static_cast<float>(src_size) / dst_size;
+  for (auto i = 0; i < dst_size; ++i) {
+    (*taps)[i] = ComputeLinearTap(i, scale, src_size);
+  }
+}
+
+template <typename T>
+void ResampleRow(const T* src, const LinearTap* taps, int dst_width, float value_scale, float* dst) {
+  for (auto x = 0; x < dst_width; ++x) {
+    const auto& tap = taps[x];
+    const float a = src[tap.i0] * value_scale;
+    const float b = src[tap.i1] * value_scale;
+    dst[x] = a + (b - a) * tap.w;
+  }
+}
+
+inline uint8_t QuantizeScalar(float v) {
+  v = std::min(std::max(v * 255.0f, 0.0f), 255.0f);
+  return static_cast<uint8_t>(std::nearbyint(v));
+}
+
+// dst[i] = round(255 * (r0[i] + (r1[i] - r0[i]) * w))
+void BlendRowsToUint8(const float* r0, const float* r1, float w, int n, uint8_t* dst) {
+  int i = 0;
+#if defined(MP_API_MASK_USE_SSE2)
+  const __m128 wv = _mm_set1_ps(w);
+  const __m128 k255 = _mm_set1_ps(255.0f);
+  const __m128 zero = _mm_setzero_ps();
+  for (; i + 16 <= n; i += 16) {
+    __m128i q[4];
+    for (auto k = 0; k < 4; ++k) {
+      const __m128 a = _mm_loadu_ps(r0 + i + 4 * k);
+      const __m128 b = _mm_loadu_ps(r1 + i + 4 * k);
+      __m128 v = _mm_add_ps(a, _mm_mul_ps(_mm_sub_ps(b, a), wv));
+      v = _mm_min_ps(_mm_max_ps(_mm_mul_ps(v, k255), zero), k255);
+      q[k] = _mm_cvtps_epi32(v);
+    }
+    const __m128i lo = _mm_packs_epi32(q[0], q[1]);
+    const __m128i hi = _mm_packs_epi32(q[2], q[3]);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_packus_epi16(lo, hi));
+  }
+#elif defined(MP_API_MASK_USE_NEON)
+  const float32x4_t wv = vdupq_n_f32(w);
+  const float32x4_t k255 = vdupq_n_f32(255.0f);
+  const float32x4_t zero = vdupq_n_f32(0.0f);
+  for (; i + 16 <= n; i += 16) {
+    uint16x4_t q[4];
+    for (auto k = 0; k < 4; ++k) {
+      const float32x4_t a = vld1q_f32(r0 + i + 4 * k);
+      const float32x4_t b = vld1q_f32(r1 + i + 4 * k);
+      float32x4_t v = vmlaq_f32(a, vsubq_f32(b, a), wv);
+      v = vminq_f32(vmaxq_f32(vmulq_f32(v, k255), zero), k255);
+      q[k] = vmovn_u32(vcvtnq_u32_f32(v));
+    }
+    const uint8x8_t lo = vqmovn_u16(vcombine_u16(q[0], q[1]));
+    const uint8x8_t hi = vqmovn_u16(vcombine_u16(q[2], q[3]));
+    vst1q_u8(dst + i, vcombine_u8(lo, hi));
+  }
+#endif
+  for (; i < n; ++i) {
+    dst[i] = QuantizeScalar(r0[i] + (r1[i] - r0[i]) * w);
+  }
+}
+
+// dst[i] = (r0[i] + (r1[i] - r0[i]) * w) >= threshold ? 255 : 0
+void BlendRowsToBinary(const float* r0, const float* r1, float w, float threshold, int n, uint8_t* dst) {
+  int i = 0;
+#if defined(MP_API_MASK_USE_SSE2)
+  const __m128 wv = _mm_set1_ps(w);
+  const __m128 tv = _mm_set1_ps(threshold);
+  for (; i + 16 <= n; i += 16) {
+    __m128i q[4];
+    for (auto k = 0; k < 4; ++k) {
+      const __m128 a = _mm_loadu_ps(r0 + i + 4 * k);
+      const __m128 b = _mm_loadu_ps(r1 + i + 4 * k);
+      const __m128 v = _mm_add_ps(a, _mm_mul_ps(_mm_sub_ps(b, a), wv));
+      q[k] = _mm_castps_si128(_mm_cmpge_ps(v, tv));
+    }
+    const __m128i lo = _mm_packs_epi32(q[0], q[1]);
+    const __m128i hi = _mm_packs_epi32(q[2], q[3]);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_packs_epi16(lo, hi));
+  }
+#elif defined(MP_API_MASK_USE_NEON)
+  const float32x4_t wv = vdupq_n_f32(w);
+  const float32x4_t tv = vdupq_n_f32(threshold);
+  for (; i + 16 <= n; i += 16) {
+    uint16x4_t q[4];
+    for (auto k = 0; k < 4; ++k) {
+      const float32x4_t a = vld1q_f32(r0 + i + 4 * k);
+      const float32x4_t b = vld1q_f32(r1 + i + 4 * k);
+      const float32x4_t v = vmlaq_f32(a, vsubq_f32(b, a), wv);
+      q[k] = vmovn_u32(vcgeq_f32(v, tv));
+    }
+    const uint8x8_t lo = vmovn_u16(vcombine_u16(q[0], q[1]));
+    const uint8x8_t hi = vmovn_u16(vcombine_u16(q[2], q[3]));
+    vst1q_u8(dst + i, vcombine_u8(lo, hi));
+  }
+#endif
+  for (; i < n; ++i) {
+    dst[i] = (r0[i] + (r1[i] - r0[i]) * w) >= threshold ? 255 : 0;
+  }
+}
+
+// Keeps the last two horizontally resampled source rows.
+// Since the destination rows are processed from top to bottom, each source row is resampled at most once.
+class RowCache {
+ public:
+  RowCache(const MaskView& src, const LinearTap* x_taps, int dst_width, float* buffer)
+      : src_(src), x_taps_(x_taps), dst_width_(dst_width), rows_{buffer, buffer + dst_width} {}
+
+  const float* Get(int y) {
+    if (src_.is_float && src_.width == dst_width_) {
+      return reinterpret_cast<const float*>(src_.data + y * src_.width_step);
+    }
+    for (auto k = 0; k < 2; ++k) {
+      if (indices_[k] == y) {
+        return rows_[k];
+      }
+    }
+    // evict the upper row, which will never be used again.
+    const int slot = indices_[0] < indices_[1] ? 0 : 1;
+    const auto* row = src_.data + y * src_.width_step;
+    if (src_.is_float) {
+      ResampleRow(reinterpret_cast<const float*>(row), x_taps_, dst_width_, 1.0f, rows_[slot]);
+    } else {
+      ResampleRow(row, x_taps_, dst_width_, 1.0f / 255.0f, rows_[slot]);
+    }
+    indices_[slot] = y;
+    return rows_[slot];
+  }
+
+ private:
+  const MaskView& src_;
+  const LinearTap* x_taps_;
+  const int dst_width_;
+  float* rows_[2];
+  int indices_[2] = {-1, -1};
+};
+
+absl::Status ValidateMaskView(const MaskView& src) {
+  if (src.data == nullptr || src.width <= 0 || src.height <= 0) {
+    return absl::InvalidArgumentError("The mask is empty");
+  }
+  return absl::OkStatus();
+}
+
+}  // namespace
+
+absl::StatusOr<MaskView> GetMaskView(const mediapipe::ImageFrame& image_frame) {
+  if (image_frame.IsEmpty()) {
+    return absl::InvalidArgumentError("The mask is empty");
+  }
+
+  switch (image_frame.Format()) {
+    case mediapipe::ImageFormat::VEC32F1:
+      return MaskView{image_frame.PixelData(), image_frame.Width(), image_frame.Height(), image_frame.WidthStep(), true};
+    case mediapipe::ImageFormat::GRAY8:
+      return MaskView{image_frame.PixelData(), image_frame.Width(), image_frame.Height(), image_frame.WidthStep(), false};
+    default:
+      return absl::InvalidArgumentError(absl::StrCat("Unsupported mask format: ", static_cast<int>(image_frame.Format())));
+  }
+}
+
+absl::Status ResizeMaskToUint8(const MaskView& src, int dst_width, int dst_height, float threshold, uint8_t* dst, int dst_width_step) {
+  if (auto status = ValidateMaskView(src); !status.ok()) {
+    return status;
+  }
+  if (dst == nullptr || dst_width <= 0 || dst_height <= 0 || dst_width_step < dst_width) {
+    return absl::InvalidArgumentError(absl::StrCat("Invalid destination: ", dst_width, "x", dst_height, ", width_step = ", dst_width_step));
+  }
+
+  // NOTE: the scratch buffers are reused to avoid allocating memory every frame.
+  thread_local std::vector<LinearTap> x_taps;
+  thread_local std::vector<float> rows;
+  ComputeLinearTaps(src.width, dst_width, &x_taps);
+  rows.resize(2 * dst_width);
+
+  RowCache row_cache(src, x_taps.data(), dst_width, rows.data());
+  const float y_scale = static_cast<float>(src.height) / dst_height;
+  const bool binarize = threshold >= 0.0f;
+
+  for (auto y = 0; y < dst_height; ++y) {
+    const auto tap = ComputeLinearTap(y, y_scale, src.height);
+    const auto* r0 = row_cache.Get(tap.i0);
+    const auto* r1 = row_cache.Get(tap.i1);
+    auto* dst_row = dst + y * dst_width_step;
+
+    if (binarize) {
+      BlendRowsToBinary(r0, r1, tap.w, threshold, dst_width, dst_row);
+    } else {
+      BlendRowsToUint8(r0, r1, tap.w, dst_width, dst_row);
+    }
+  }
+  return absl::OkStatus();
+}
+
+absl::Status ResizeCategoryMaskToRgba(const MaskView& src, int dst_width, int dst_height, const uint32_t* colors, int colors_size, uint8_t* dst) {
+  if (auto status = ValidateMaskView(src); !status.ok()) {
+    return status;
+  }
+  if (dst == nullptr || dst_width <= 0 || dst_height <= 0) {
+    return absl::InvalidArgumentError(absl::StrCat("Invalid destination: ", dst_width, "x", dst_height));
+  }
+  if (colors == nullptr && colors_size > 0) {
+    return absl::InvalidArgumentError("colors is null");
+  }
+
+  thread_local std::vector<int> x_indices;
+  x_indices.resize(dst_width);
+  const float x_scale = static_cast<float>(src.width) / dst_width;
+  for (auto x = 0; x < dst_width; ++x) {
+    x_indices[x] = std::min(static_cast<int>((x + 0.5f) * x_scale), src.width - 1);
+  }
+
+  const float y_scale = static_cast<float>(src.height) / dst_height;
+  for (auto y = 0; y < dst_height; ++y) {
+    const auto sy = std::min(static_cast<int>((y + 0.5f) * y_scale), src.height - 1);
+    const auto* src_row = src.data + sy * src.width_step;
+    auto* dst_row = dst + 4 * y * dst_width;
+
+    for (auto x = 0; x < dst_width; ++x) {
+      const int category = src.is_float ? static_cast<int>(reinterpret_cast<const float*>(src_row)[x_indices[x]] + 0.5f) : src_row[x_indices[x]];
+      const uint32_t color = category >= 0 && category < colors_size ? colors[category] : 0;
+      std::memcpy(dst_row + 4 * x, &color, sizeof(color));
+    }
+  }
+  return absl::OkStatus();
+}
+
+absl::Status ExportMask(const mediapipe::ImageFrame& image_frame, int width, int height, float threshold, uint8_t* buffer, int buffer_size) {
+  if (static_cast<int64_t>(width) * height > buffer_size) {
+    return absl::InvalidArgumentError(absl::StrCat("Insufficient buffer size: ", width, "x", height, " bytes are required, but got ", buffer_size));
+  }
+  auto mask_view = GetMaskView(image_frame);
+  if (!mask_view.ok()) {
+    return mask_view.status();
+  }
+  return ResizeMaskToUint8(*mask_view, width, height, threshold, buffer, width);
+}
+
+absl::Status ExportCategoryMask(const mediapipe::ImageFrame& image_frame, int width, int height, const uint32_t* colors, int colors_size, uint8_t* buffer,
+                                int buffer_size) {
+  if (4 * static_cast<int64_t>(width) * height > buffer_size) {
+    return absl::InvalidArgumentError(absl::StrCat("Insufficient buffer size: 4x", width, "x", height, " bytes are required, but got ", buffer_size));
+  }
+  auto mask_view = GetMaskView(image_frame);
+  if (!mask_view.ok()) {
+    return mask_view.status();
+  }
+  return ResizeCategoryMaskToRgba(*mask_view, width, height, colors, colors_size, buffer);
+}
+
+}  // namespace mp_api
@@ -0,0 +1,48 @@
+// Copyright (c) 2026 homuler
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+#ifndef MEDIAPIPE_API_UTIL_SEGMENTATION_MASK_UTIL_H_
+#define MEDIAPIPE_API_UTIL_SEGMENTATION_MASK_UTIL_H_
+
+#include <cstdint>
+
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "mediapipe/framework/formats/image_frame.h"
+
+namespace mp_api {
+
+// A read-only view of a single channel mask.
+// Confidence masks are usually VEC32F1, and category masks are usually GRAY8.
+struct MaskView {
+  const uint8_t* data;
+  int width;
+  int height;
+  int width_step;
+  bool is_float;
+};
+
+absl::StatusOr<MaskView> GetMaskView(const mediapipe::ImageFrame& image_frame);
+
+// Resizes the confidence mask to `dst_width` x `dst_height` with bilinear filtering and quantizes it to uint8 in one pass.
+// If `threshold` is negative, the confidence is scaled to [0, 255]. Otherwise, each pixel becomes 255 if its confidence is greater than or equal to
+// `threshold`, and 0 if not.
+// `dst` must have at least `dst_width_step` * `dst_height` bytes.
+absl::Status ResizeMaskToUint8(const MaskView& src, int dst_width, int dst_height, float threshold, uint8_t* dst, int dst_width_step);
+
+// Resizes the category mask to `dst_width` x `dst_height` with nearest-neighbor sampling and maps each category to a RGBA32 color.
+// Categories that are out of the range of `colors` are mapped to 0 (transparent black).
+// `dst` must have at least 4 * `dst_width` * `dst_height` bytes.
+absl::Status ResizeCategoryMaskToRgba(const MaskView& src, int dst_width, int dst_height, const uint32_t* colors, int colors_size, uint8_t* dst);
+
+// Same as the above functions, but the destination is a tightly packed buffer of `buffer_size` bytes.
+absl::Status ExportMask(const mediapipe::ImageFrame& image_frame, int width, int height, float threshold, uint8_t* buffer, int buffer_size);
+absl::Status ExportCategoryMask(const mediapipe::ImageFrame& image_frame, int width, int height, const uint32_t* colors, int colors_size, uint8_t* buffer,
+                                int buffer_size);
+
+}  // namespace mp_api
+
+#endif  // MEDIAPIPE_API_UTIL_SEGMENTATION_MASK_UTIL_H_
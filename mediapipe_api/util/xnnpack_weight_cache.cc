@@ -0,0 +1,149 @@
+// Copyright (c) 2026 homuler
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+#include "mediapipe_api/util/xnnpack_weight_cache.h"
+
+#include <sys/stat.h>
+
+#include <fstream>
+#include <utility>
+
+#include "absl/strings/str_cat.h"
+#include "cpuinfo.h"
+#include "mediapipe_api/util/cache_file_util.h"
+#include "tensorflow/lite/delegates/xnnpack/weight_cache.h"
+#include "tensorflow/lite/delegates/xnnpack/xnnpack_delegate.h"
+
+namespace mp_api {
+
+namespace {
+
+// The CPU features that change the microkernels selected by XNNPACK, and therefore the layout of the packed weights.
+const std::string& GetCpuFeatures() {
+  static const auto* features = []() {
+    auto* features = new std::string();
+    if (!cpuinfo_initialize()) {
+      *features = "unknown";
+      return features;
+    }
+#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+    absl::StrAppend(features, "x86", cpuinfo_has_x86_avx() ? ":avx" : "", cpuinfo_has_x86_fma3() ? ":fma3" : "", cpuinfo_has_x86_avx2() ? ":avx2" : "",
+                    cpuinfo_has_x86_avx512f() ? ":avx512f" : "", cpuinfo_has_x86_avx512vnni() ? ":avx512vnni" : "",
+                    cpuinfo_has_x86_avxvnni() ? ":avxvnni" : "");
+#elif CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64
+    absl::StrAppend(features, "arm", cpuinfo_has_arm_neon() ? ":neon" : "", cpuinfo_has_arm_neon_fp16_arith() ? ":fp16" : "",
+                    cpuinfo_has_arm_neon_dot() ? ":dot" : "", cpuinfo_has_arm_i8mm() ? ":i8mm" : "", cpuinfo_has_arm_sve() ? ":sve" : "");
+#else
+    *features = "generic";
+#endif
+    return features;
+  }();
+  return *features;
+}
+
+// Returns the size of the cache file at `path` if it's complete, or -1 if it's missing, partially written or corrupted.
+// XNNPACK packs the weights again and overwrites the file in the latter cases, so they must not be counted as hits.
+int64_t GetValidCacheFileSize(const std::string& path) {
+  std::ifstream file(path, std::ios::binary | std::ios::ate);
+  if (!file) {
+    return -1;
+  }
+  const auto size = static_cast<uint64_t>(file.tellg());
+  tflite::xnnpack::XNNPackCacheHeader header;
+  if (size < sizeof(header) || !file.seekg(0).read(reinterpret_cast<char*>(&header), sizeof(header))) {
+    return -1;
+  }
+  // NOTE: the header is written with kInvalidHeader first, and replaced only after all the weights have been written.
+  if (header.version != tflite::xnnpack::XNNPackCacheHeader::kVersion || header.buffer_list_offset < sizeof(header) ||
+      header.buffer_list_offset > size || header.buffer_list_size > size - header.buffer_list_offset) {
+    return -1;
+  }
+  return static_cast<int64_t>(size);
+}
+
+}  // namespace
+
+XnnpackWeightCache& XnnpackWeightCache::GetInstance() {
+  static auto* cache = new XnnpackWeightCache();
+  return *cache;
+}
+
+std::string XnnpackWeightCache::directory() {
+  absl::MutexLock lock(&mutex_);
+  return directory_;
+}
+
+absl::Status XnnpackWeightCache::SetDirectory(const std::string& directory) {
+  if (!directory.empty()) {
+    struct stat st;
+    if (stat(directory.c_str(), &st) != 0 || (st.st_mode & S_IFMT) != S_IFDIR) {
+      return absl::NotFoundError(absl::StrCat(directory, " is not a directory"));
+    }
+  }
+  absl::MutexLock lock(&mutex_);
+  directory_ = directory;
+  return absl::OkStatus();
+}
+
+absl::Status XnnpackWeightCache::Apply(absl::string_view model_data, int num_threads, tflite::Interpreter* interpreter) {
+  const auto directory = this->directory();
+  if (directory.empty()) {
+    return absl::OkStatus();
+  }
+
+  const auto path = GetCacheFilePath(directory, model_data);
+  // NOTE: XNNPACK loads the weights from a complete cache file, and packs them to a new one otherwise.
+  const auto cached_size = GetValidCacheFileSize(path);
+
+  auto options = TfLiteXNNPackDelegateOptionsDefault();
+  options.num_threads = num_threads;
+  options.weight_cache_file_path = path.c_str();
+  tflite::Interpreter::TfLiteDelegatePtr delegate(TfLiteXNNPackDelegateCreate(&options), &TfLiteXNNPackDelegateDelete);
+  if (delegate == nullptr) {
+    return absl::InternalError("Failed to create the XNNPACK delegate");
+  }
+  // NOTE: the default delegates are not applied once a delegate is applied explicitly.
+  if (interpreter->ModifyGraphWithDelegate(std::move(delegate)) != kTfLiteOk) {
+    return absl::InternalError("Failed to apply the XNNPACK delegate");
+  }
+
+  absl::MutexLock lock(&mutex_);
+  if (cached_size > 0) {
+    ++stats_.hits;
+    stats_.bytes_saved += cached_size;
+  } else {
+    ++stats_.misses;
+  }
+  return absl::OkStatus();
+}
+
+XnnpackWeightCacheStats XnnpackWeightCache::GetStats() {
+  absl::MutexLock lock(&mutex_);
+  return stats_;
+}
+
+void XnnpackWeightCache::ResetStats() {
+  absl::MutexLock lock(&mutex_);
+  stats_ = {};
+}
+
+std::string XnnpackWeightCache::GetCacheFilePath(const std::string& directory, absl::string_view model_data) {
+  return absl::StrCat(directory, "/", absl::Hex(FastFingerprint(model_data), absl::kZeroPad16), "_", absl::Hex(Fingerprint(GetCpuFeatures()), absl::kZeroPad16),
+                      ".xnnpack_cache");
+}
+
+}  // namespace mp_api
+
+MpReturnCode mp_XnnpackWeightCache__SetDirectory__PKc(const char* directory, absl::Status** status_out) {
+  TRY
+    *status_out = new absl::Status{mp_api::XnnpackWeightCache::GetInstance().SetDirectory(directory)};
+    RETURN_CODE(MpReturnCode::Success);
+  CATCH_EXCEPTION
+}
+
+void mp_XnnpackWeightCache__GetStats(mp_api::XnnpackWeightCacheStats* stats_out) { *stats_out = mp_api::XnnpackWeightCache::GetInstance().GetStats(); }
+
+void mp_XnnpackWeightCache__ResetStats() { mp_api::XnnpackWeightCache::GetInstance().ResetStats(); }
@@ -0,0 +1,75 @@
+// Copyright (c) 2026 homuler
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+#ifndef MEDIAPIPE_API_UTIL_XNNPACK_WEIGHT_CACHE_H_
+#define MEDIAPIPE_API_UTIL_XNNPACK_WEIGHT_CACHE_H_
+
+#include <cstdint>
+#include <string>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/status/status.h"
+#include "absl/strings/string_view.h"
+#include "absl/synchronization/mutex.h"
+#include "mediapipe_api/common.h"
+#include "mediapipe_api/external/absl/status.h"
+#include "tensorflow/lite/interpreter.h"
+
+namespace mp_api {
+
+struct XnnpackWeightCacheStats {
+  // The number of the interpreters whose packed weights were loaded from a complete cache file.
+  int64_t hits;
+  // The number of the interpreters whose weights were packed and written to the cache file.
+  int64_t misses;
+  // The total size of the packed weights loaded from the cache files instead of being packed again.
+  int64_t bytes_saved;
+};
+
+// Persists the weights packed by XNNPACK to the files in a directory, so that the later runs memory-map them instead of packing them again.
+//
+// The cache file is keyed by the fingerprint of the model and the CPU features, because the packing depends on the selected microkernels.
+// It's disabled until the directory is set.
+//
+// NOTE: it's applied only to the interpreters created by BatchingInferenceService (i.e. BatchedInferenceCalculator).
+// The stock InferenceCalculator creates the XNNPACK delegate from its own options, so the cache has no effect on it.
+class XnnpackWeightCache {
+ public:
+  static XnnpackWeightCache& GetInstance();
+
+  std::string directory();
+  // `directory` must exist. If it's empty, the cache is disabled.
+  absl::Status SetDirectory(const std::string& directory);
+
+  // Applies the XNNPACK delegate that uses the cache file for `model_data` to `interpreter`, which must not be allocated yet.
+  // It does nothing if the cache is disabled, and then the default delegate is applied as before.
+  absl::Status Apply(absl::string_view model_data, int num_threads, tflite::Interpreter* interpreter);
+
+  XnnpackWeightCacheStats GetStats();
+  void ResetStats();
+
+  // Returns the path of the cache file for `model_data` in `directory`.
+  static std::string GetCacheFilePath(const std::string& directory, absl::string_view model_data);
+
+ private:
+  XnnpackWeightCache() = default;
+
+  absl::Mutex mutex_;
+  std::string directory_ ABSL_GUARDED_BY(mutex_);
+  XnnpackWeightCacheStats stats_ ABSL_GUARDED_BY(mutex_) = {};
+};
+
+}  // namespace mp_api
+
+extern "C" {
+
+MP_CAPI(MpReturnCode) mp_XnnpackWeightCache__SetDirectory__PKc(const char* directory, absl::Status** status_out);
+MP_CAPI(void) mp_XnnpackWeightCache__GetStats(mp_api::XnnpackWeightCacheStats* stats_out);
+MP_CAPI(void) mp_XnnpackWeightCache__ResetStats();
+
+}  // extern "C"
+
+#endif  // MEDIAPIPE_API_UTIL_XNNPACK_WEIGHT_CACHE_H_